@@ -0,0 +1,274 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-generate-fax-tables.c
+ *       Date:         Sat Oct 17 22:40:12 2026
+ *
+ *       GNU PDF Library - Generate the lookup tables of the CCITT Fax
+ *                         decoder
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Writes src/base/pdf-stm-f-fax-tables.h to the standard output:
+ *
+ *   $> ./pdf-stm-generate-fax-tables > ../src/base/pdf-stm-f-fax-tables.h
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+/* Bits looked up at once for white runs, black runs and 2-D modes, as
+ * FAX_WHITE_BITS, FAX_BLACK_BITS and FAX_MODE_BITS in pdf-stm-f-fax.c */
+#define WHITE_BITS 12
+#define BLACK_BITS 13
+#define MODE_BITS  7
+
+/* Code of a run length */
+struct fax_code_s
+{
+  unsigned code;
+  int len;
+  unsigned value;
+};
+
+/* Terminating and make-up codes of white runs */
+static const struct fax_code_s fax_white_codes[] =
+  {
+    { 0x035,  8,    0 }, { 0x007,  6,    1 }, { 0x007,  4,    2 },
+    { 0x008,  4,    3 }, { 0x00b,  4,    4 }, { 0x00c,  4,    5 },
+    { 0x00e,  4,    6 }, { 0x00f,  4,    7 }, { 0x013,  5,    8 },
+    { 0x014,  5,    9 }, { 0x007,  5,   10 }, { 0x008,  5,   11 },
+    { 0x008,  6,   12 }, { 0x003,  6,   13 }, { 0x034,  6,   14 },
+    { 0x035,  6,   15 }, { 0x02a,  6,   16 }, { 0x02b,  6,   17 },
+    { 0x027,  7,   18 }, { 0x00c,  7,   19 }, { 0x008,  7,   20 },
+    { 0x017,  7,   21 }, { 0x003,  7,   22 }, { 0x004,  7,   23 },
+    { 0x028,  7,   24 }, { 0x02b,  7,   25 }, { 0x013,  7,   26 },
+    { 0x024,  7,   27 }, { 0x018,  7,   28 }, { 0x002,  8,   29 },
+    { 0x003,  8,   30 }, { 0x01a,  8,   31 }, { 0x01b,  8,   32 },
+    { 0x012,  8,   33 }, { 0x013,  8,   34 }, { 0x014,  8,   35 },
+    { 0x015,  8,   36 }, { 0x016,  8,   37 }, { 0x017,  8,   38 },
+    { 0x028,  8,   39 }, { 0x029,  8,   40 }, { 0x02a,  8,   41 },
+    { 0x02b,  8,   42 }, { 0x02c,  8,   43 }, { 0x02d,  8,   44 },
+    { 0x004,  8,   45 }, { 0x005,  8,   46 }, { 0x00a,  8,   47 },
+    { 0x00b,  8,   48 }, { 0x052,  8,   49 }, { 0x053,  8,   50 },
+    { 0x054,  8,   51 }, { 0x055,  8,   52 }, { 0x024,  8,   53 },
+    { 0x025,  8,   54 }, { 0x058,  8,   55 }, { 0x059,  8,   56 },
+    { 0x05a,  8,   57 }, { 0x05b,  8,   58 }, { 0x04a,  8,   59 },
+    { 0x04b,  8,   60 }, { 0x032,  8,   61 }, { 0x033,  8,   62 },
+    { 0x034,  8,   63 }, { 0x01b,  5,   64 }, { 0x012,  5,  128 },
+    { 0x017,  6,  192 }, { 0x037,  7,  256 }, { 0x036,  8,  320 },
+    { 0x037,  8,  384 }, { 0x064,  8,  448 }, { 0x065,  8,  512 },
+    { 0x068,  8,  576 }, { 0x067,  8,  640 }, { 0x0cc,  9,  704 },
+    { 0x0cd,  9,  768 }, { 0x0d2,  9,  832 }, { 0x0d3,  9,  896 },
+    { 0x0d4,  9,  960 }, { 0x0d5,  9, 1024 }, { 0x0d6,  9, 1088 },
+    { 0x0d7,  9, 1152 }, { 0x0d8,  9, 1216 }, { 0x0d9,  9, 1280 },
+    { 0x0da,  9, 1344 }, { 0x0db,  9, 1408 }, { 0x098,  9, 1472 },
+    { 0x099,  9, 1536 }, { 0x09a,  9, 1600 }, { 0x018,  6, 1664 },
+    { 0x09b,  9, 1728 }
+  };
+
+/* Terminating and make-up codes of black runs */
+static const struct fax_code_s fax_black_codes[] =
+  {
+    { 0x037, 10,    0 }, { 0x002,  3,    1 }, { 0x003,  2,    2 },
+    { 0x002,  2,    3 }, { 0x003,  3,    4 }, { 0x003,  4,    5 },
+    { 0x002,  4,    6 }, { 0x003,  5,    7 }, { 0x005,  6,    8 },
+    { 0x004,  6,    9 }, { 0x004,  7,   10 }, { 0x005,  7,   11 },
+    { 0x007,  7,   12 }, { 0x004,  8,   13 }, { 0x007,  8,   14 },
+    { 0x018,  9,   15 }, { 0x017, 10,   16 }, { 0x018, 10,   17 },
+    { 0x008, 10,   18 }, { 0x067, 11,   19 }, { 0x068, 11,   20 },
+    { 0x06c, 11,   21 }, { 0x037, 11,   22 }, { 0x028, 11,   23 },
+    { 0x017, 11,   24 }, { 0x018, 11,   25 }, { 0x0ca, 12,   26 },
+    { 0x0cb, 12,   27 }, { 0x0cc, 12,   28 }, { 0x0cd, 12,   29 },
+    { 0x068, 12,   30 }, { 0x069, 12,   31 }, { 0x06a, 12,   32 },
+    { 0x06b, 12,   33 }, { 0x0d2, 12,   34 }, { 0x0d3, 12,   35 },
+    { 0x0d4, 12,   36 }, { 0x0d5, 12,   37 }, { 0x0d6, 12,   38 },
+    { 0x0d7, 12,   39 }, { 0x06c, 12,   40 }, { 0x06d, 12,   41 },
+    { 0x0da, 12,   42 }, { 0x0db, 12,   43 }, { 0x054, 12,   44 },
+    { 0x055, 12,   45 }, { 0x056, 12,   46 }, { 0x057, 12,   47 },
+    { 0x064, 12,   48 }, { 0x065, 12,   49 }, { 0x052, 12,   50 },
+    { 0x053, 12,   51 }, { 0x024, 12,   52 }, { 0x037, 12,   53 },
+    { 0x038, 12,   54 }, { 0x027, 12,   55 }, { 0x028, 12,   56 },
+    { 0x058, 12,   57 }, { 0x059, 12,   58 }, { 0x02b, 12,   59 },
+    { 0x02c, 12,   60 }, { 0x05a, 12,   61 }, { 0x066, 12,   62 },
+    { 0x067, 12,   63 }, { 0x00f, 10,   64 }, { 0x0c8, 12,  128 },
+    { 0x0c9, 12,  192 }, { 0x05b, 12,  256 }, { 0x033, 12,  320 },
+    { 0x034, 12,  384 }, { 0x035, 12,  448 }, { 0x06c, 13,  512 },
+    { 0x06d, 13,  576 }, { 0x04a, 13,  640 }, { 0x04b, 13,  704 },
+    { 0x04c, 13,  768 }, { 0x04d, 13,  832 }, { 0x072, 13,  896 },
+    { 0x073, 13,  960 }, { 0x074, 13, 1024 }, { 0x075, 13, 1088 },
+    { 0x076, 13, 1152 }, { 0x077, 13, 1216 }, { 0x052, 13, 1280 },
+    { 0x053, 13, 1344 }, { 0x054, 13, 1408 }, { 0x055, 13, 1472 },
+    { 0x05a, 13, 1536 }, { 0x05b, 13, 1600 }, { 0x064, 13, 1664 },
+    { 0x065, 13, 1728 }
+  };
+
+/* Make-up codes of long runs, shared by both colours */
+static const struct fax_code_s fax_ext_codes[] =
+  {
+    { 0x008, 11, 1792 }, { 0x00c, 11, 1856 }, { 0x00d, 11, 1920 },
+    { 0x012, 12, 1984 }, { 0x013, 12, 2048 }, { 0x014, 12, 2112 },
+    { 0x015, 12, 2176 }, { 0x016, 12, 2240 }, { 0x017, 12, 2304 },
+    { 0x01c, 12, 2368 }, { 0x01d, 12, 2432 }, { 0x01e, 12, 2496 },
+    { 0x01f, 12, 2560 }
+  };
+
+/* Code of a 2-D mode, named as in enum fax_mode_e of pdf-stm-f-fax.c */
+struct fax_mode_code_s
+{
+  unsigned code;
+  int len;
+  const char *value;
+};
+
+static const struct fax_mode_code_s fax_mode_codes[] =
+  {
+    { 0x01, 1, "FAX_MODE_V0" }, { 0x03, 3, "FAX_MODE_VR1" },
+    { 0x02, 3, "FAX_MODE_VL1" }, { 0x01, 3, "FAX_MODE_HORIZONTAL" },
+    { 0x01, 4, "FAX_MODE_PASS" }, { 0x03, 6, "FAX_MODE_VR2" },
+    { 0x02, 6, "FAX_MODE_VL2" }, { 0x03, 7, "FAX_MODE_VR3" },
+    { 0x02, 7, "FAX_MODE_VL3" }
+  };
+
+#define N_CODES(codes) (sizeof (codes) / sizeof (codes[0]))
+
+/* Entry of a lookup table, as the arguments of FAX_ENTRY */
+struct entry_s
+{
+  char text[48];
+};
+
+static struct entry_s white[1 << WHITE_BITS];
+static struct entry_s black[1 << BLACK_BITS];
+static struct entry_s mode[1 << MODE_BITS];
+
+/* Every index starting with the bits of a code maps to it */
+static void
+fill (struct entry_s *table,
+      int             bits,
+      unsigned        code,
+      int             len,
+      const char     *value)
+{
+  unsigned first = code << (bits - len);
+  unsigned i;
+
+  for (i = 0; i < (1u << (bits - len)); i++)
+    sprintf (table[first + i].text, "FAX_ENTRY (%s, %d)", value, len);
+}
+
+static void
+fill_runs (struct entry_s          *table,
+           int                      bits,
+           const struct fax_code_s *codes,
+           size_t                   n_codes)
+{
+  char value[16];
+  size_t i;
+
+  for (i = 0; i < n_codes; i++)
+    {
+      sprintf (value, "%u", codes[i].value);
+      fill (table, bits, codes[i].code, codes[i].len, value);
+    }
+}
+
+static void
+print_table (const char           *name,
+             const char           *bits,
+             const struct entry_s *table,
+             size_t                size,
+             size_t                per_line)
+{
+  size_t i;
+
+  printf ("static const pdf_u16_t %s[1 << %s] =\n  {\n", name, bits);
+  for (i = 0; i < size; i++)
+    printf ("%s%s%s",
+            (i % per_line == 0 ? "    " : " "),
+            (table[i].text[0] ? table[i].text : "0"),
+            (i + 1 == size ? "\n" :
+             (i % per_line == per_line - 1 ? ",\n" : ",")));
+  printf ("  };\n");
+}
+
+int
+main (void)
+{
+  size_t i;
+
+  /* The tables of white runs and black runs both have the codes of
+   * long runs */
+  fill_runs (white, WHITE_BITS, fax_white_codes, N_CODES (fax_white_codes));
+  fill_runs (white, WHITE_BITS, fax_ext_codes, N_CODES (fax_ext_codes));
+  fill_runs (black, BLACK_BITS, fax_black_codes, N_CODES (fax_black_codes));
+  fill_runs (black, BLACK_BITS, fax_ext_codes, N_CODES (fax_ext_codes));
+  for (i = 0; i < N_CODES (fax_mode_codes); i++)
+    fill (mode, MODE_BITS,
+          fax_mode_codes[i].code, fax_mode_codes[i].len,
+          fax_mode_codes[i].value);
+
+  printf ("/* -*- mode: C -*-\n"
+          " *\n"
+          " *       File:         pdf-stm-f-fax-tables.h\n"
+          " *\n"
+          " *       GNU PDF Library - Lookup tables of the CCITT Fax decoder\n"
+          " *\n"
+          " *       Generated by build-aux/pdf-stm-generate-fax-tables.c\n"
+          " *       from the codes of ITU-T T.4. Do not edit.\n"
+          " *\n"
+          " */\n"
+          "\n"
+          "/* Copyright (C) 2026 Free Software Foundation, Inc. */\n"
+          "\n"
+          "/* This program is free software: you can redistribute it and/or modify\n"
+          " * it under the terms of the GNU General Public License as published by\n"
+          " * the Free Software Foundation, either version 3 of the License, or\n"
+          " * (at your option) any later version.\n"
+          " *\n"
+          " * This program is distributed in the hope that it will be useful,\n"
+          " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+          " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+          " * GNU General Public License for more details.\n"
+          " *\n"
+          " * You should have received a copy of the GNU General Public License\n"
+          " * along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+          " */\n"
+          "\n"
+          "#ifndef PDF_STM_F_FAX_TABLES_H\n"
+          "#define PDF_STM_F_FAX_TABLES_H\n"
+          "\n"
+          "/* Lookup tables of white runs, black runs and 2-D modes, indexed by\n"
+          " * the next bits of the encoded data; 0 for invalid codes */\n"
+          "\n");
+  print_table ("fax_white_table", "FAX_WHITE_BITS", white, N_CODES (white), 3);
+  printf ("\n");
+  print_table ("fax_black_table", "FAX_BLACK_BITS", black, N_CODES (black), 3);
+  printf ("\n");
+  print_table ("fax_mode_table", "FAX_MODE_BITS", mode, N_CODES (mode), 2);
+  printf ("\n"
+          "#endif /* !PDF_STM_F_FAX_TABLES_H */\n"
+          "\n"
+          "/* End of pdf-stm-f-fax-tables.h */\n");
+
+  return 0;
+}
+
+/* End of pdf-stm-generate-fax-tables.c */
@@ -34,14 +34,17 @@
 #include <pdf-error.h>
 #include <pdf-crypt-c-aesv2.h>
 
-#define AESV2_BLKSIZE 16	/* Size of a block in AES128 */
+#define AESV2_BLKSIZE 16	/* Size of a block in AES128 and AES256 */
 
+/* AESV2 (AES-128) and AESV3 (AES-256) ciphers only differ in the
+ * size of their key */
 struct pdf_crypt_cipher_aesv2_s {
   /* Implementation */
   struct pdf_crypt_cipher_s parent;
   /* Implementation-specific private data */
   gcry_cipher_hd_t hd;
   pdf_bool_t first_block;
+  const pdf_char_t *name;
 };
 
 static pdf_bool_t
@@ -59,11 +62,15 @@ aesv2_set_key (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_EBADAESKEY,
-                     "cannot set key in AESv2 cipher: '%s/%s'",
+                     "cannot set key in %s cipher: '%s/%s'",
+                     aesv2->name,
                      gcry_strsource (gcry_error),
                      gcry_strerror (gcry_error));
       return PDF_FALSE;
     }
+
+  /* The IV comes in the first block of the next message */
+  aesv2->first_block = PDF_TRUE;
   return PDF_TRUE;
 }
 
@@ -89,9 +96,10 @@ aesv2_encrypt (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_EBADDATA,
-                     "cannot encrypt in AESv2 cipher: "
+                     "cannot encrypt in %s cipher: "
                      "invalid input size (%lu), "
                      "must be multiple of block size (%lu)",
+                     aesv2->name,
                      (unsigned long)in_size,
                      (unsigned long)AESV2_BLKSIZE);
       return PDF_FALSE;
@@ -102,8 +110,9 @@ aesv2_encrypt (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_EBADDATA,
-                     "cannot encrypt in AESv2 cipher: "
+                     "cannot encrypt in %s cipher: "
                      "output size (%lu) cannot be smaller than input size (%lu)",
+                     aesv2->name,
                      (unsigned long)out_size,
                      (unsigned long)in_size);
       return PDF_FALSE;
@@ -139,7 +148,8 @@ aesv2_encrypt (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
-                     "cannot encrypt with AESv2 cipher: '%s/%s'",
+                     "cannot encrypt with %s cipher: '%s/%s'",
+                     aesv2->name,
                      gcry_strsource (gcry_error),
                      gcry_strerror (gcry_error));
       return PDF_FALSE;
@@ -173,9 +183,10 @@ aesv2_decrypt (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_EBADDATA,
-                     "cannot decrypt in AESv2 cipher: "
+                     "cannot decrypt in %s cipher: "
                      "invalid input size (%lu), "
                      "must be multiple of block size (%lu)",
+                     aesv2->name,
                      (unsigned long)in_size,
                      (unsigned long)AESV2_BLKSIZE);
       return PDF_FALSE;
@@ -186,8 +197,9 @@ aesv2_decrypt (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_EBADDATA,
-                     "cannot decrypt in AESv2 cipher: "
+                     "cannot decrypt in %s cipher: "
                      "output size (%lu) cannot be smaller than input size (%lu)",
+                     aesv2->name,
                      (unsigned long)out_size,
                      (unsigned long)in_size);
       return PDF_FALSE;
@@ -223,7 +235,8 @@ aesv2_decrypt (pdf_crypt_cipher_t  *cipher,
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
-                     "cannot decrypt with AESv2 cipher: '%s/%s'",
+                     "cannot decrypt with %s cipher: '%s/%s'",
+                     aesv2->name,
                      gcry_strsource (gcry_error),
                      gcry_strerror (gcry_error));
       return PDF_FALSE;
@@ -244,16 +257,27 @@ aesv2_destroy (pdf_crypt_cipher_t *cipher)
   pdf_dealloc (aesv2);
 }
 
+static void
+aesv2_reset (pdf_crypt_cipher_t *cipher)
+{
+  struct pdf_crypt_cipher_aesv2_s *aesv2 = (struct pdf_crypt_cipher_aesv2_s *)cipher;
+
+  aesv2->first_block = PDF_TRUE;
+}
+
 /* Implementation of the cipher module */
 static const struct pdf_crypt_cipher_s implementation = {
   .set_key = aesv2_set_key,
   .encrypt = aesv2_encrypt,
   .decrypt = aesv2_decrypt,
-  .destroy = aesv2_destroy
+  .destroy = aesv2_destroy,
+  .reset   = aesv2_reset
 };
 
-pdf_crypt_cipher_t *
-pdf_crypt_cipher_aesv2_new (pdf_error_t **error)
+static pdf_crypt_cipher_t *
+aes_cipher_new (int                algo,
+                const pdf_char_t  *name,
+                pdf_error_t      **error)
 {
   gcry_error_t gcry_error;
   struct pdf_crypt_cipher_aesv2_s *cipher;
@@ -264,8 +288,9 @@ pdf_crypt_cipher_aesv2_new (pdf_error_t **error)
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
-                     "cannot create new AESv2 cipher object: "
+                     "cannot create new %s cipher object: "
                      "couldn't allocate %lu bytes",
+                     name,
                      (unsigned long)sizeof (struct pdf_crypt_cipher_aesv2_s));
       return NULL;
     }
@@ -275,8 +300,9 @@ pdf_crypt_cipher_aesv2_new (pdf_error_t **error)
 
   /* Initialize cipher object */
   cipher->first_block = PDF_TRUE;
+  cipher->name = name;
   gcry_error = gcry_cipher_open (&(cipher->hd),
-                                 GCRY_CIPHER_AES128,
+                                 algo,
                                  GCRY_CIPHER_MODE_CBC,
                                  0);
   if (gcry_error != GPG_ERR_NO_ERROR)
@@ -284,7 +310,8 @@ pdf_crypt_cipher_aesv2_new (pdf_error_t **error)
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
-                     "cannot initialize AESv2 cipher: '%s/%s'",
+                     "cannot initialize %s cipher: '%s/%s'",
+                     name,
                      gcry_strsource (gcry_error),
                      gcry_strerror (gcry_error));
       pdf_dealloc (cipher);
@@ -294,4 +321,16 @@ pdf_crypt_cipher_aesv2_new (pdf_error_t **error)
   return (pdf_crypt_cipher_t *)cipher;
 }
 
+pdf_crypt_cipher_t *
+pdf_crypt_cipher_aesv2_new (pdf_error_t **error)
+{
+  return aes_cipher_new (GCRY_CIPHER_AES128, "AESv2", error);
+}
+
+pdf_crypt_cipher_t *
+pdf_crypt_cipher_aesv3_new (pdf_error_t **error)
+{
+  return aes_cipher_new (GCRY_CIPHER_AES256, "AESv3", error);
+}
+
 /* End of pdf-crypt-c-aesv2.c */
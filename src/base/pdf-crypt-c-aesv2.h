@@ -31,6 +31,8 @@
 
 pdf_crypt_cipher_t *pdf_crypt_cipher_aesv2_new (pdf_error_t **error);
 
+pdf_crypt_cipher_t *pdf_crypt_cipher_aesv3_new (pdf_error_t **error);
+
 #endif	/* PDF_CRYPT_C_AESV2_H */
 
 /* End of pdf-crypt-c-aesv2.h */
@@ -27,20 +27,107 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <gcrypt.h>
+#include <pthread.h>
 
 #include <pdf-alloc.h>
 #include <pdf-types.h>
 #include <pdf-error.h>
 #include <pdf-crypt-c-v2.h>
 
+/* V2 is RC4, implemented here instead of going through a gcrypt handle:
+ * the ciphers of encrypted documents are created for every stream and
+ * string, with short keys, so that setting them up costs more than
+ * processing the data. */
+
+#define V2_KEY_MIN_SIZE 5   /* 40 bits */
+#define V2_KEY_MAX_SIZE 256
+
 struct pdf_crypt_cipher_v2_s {
   /* Implementation */
   struct pdf_crypt_cipher_s parent;
   /* Implementation-specific private data */
-  gcry_cipher_hd_t hd;
+  pdf_bool_t keyed;
+  /* S-box just after the key setup, to start again from the key */
+  pdf_u8_t schedule[256];
+  /* Current S-box, in words to avoid partial register accesses in the
+   * swaps, and indexes */
+  pdf_u32_t s[256];
+  unsigned int i;
+  unsigned int j;
 };
 
+/* Key schedules of the last keys set, shared by all the V2 ciphers. Each
+ * object of a document has its own key, used again whenever one of its
+ * strings or streams is read, so the S-box of a known key is copied
+ * instead of being expanded again. Direct-mapped on a hash of the key. */
+
+#define V2_SCHEDULE_CACHE_BITS   7
+#define V2_SCHEDULE_CACHE_SIZE   (1 << V2_SCHEDULE_CACHE_BITS)
+#define V2_SCHEDULE_KEY_MAX_SIZE 16
+
+struct v2_schedule_s {
+  pdf_size_t key_size; /* 0 if the entry is free */
+  pdf_u8_t key[V2_SCHEDULE_KEY_MAX_SIZE];
+  pdf_u8_t s[256];
+};
+
+static struct v2_schedule_s v2_schedules[V2_SCHEDULE_CACHE_SIZE];
+static pthread_mutex_t v2_schedules_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static pdf_u32_t
+v2_key_hash (const pdf_u8_t *key,
+             pdf_size_t      size)
+{
+  pdf_u32_t hash = 2166136261U;
+  pdf_size_t n;
+
+  /* FNV-1a, keeping the upper bits: the lower ones only depend on the
+   * lower bits of the key octets */
+  for (n = 0; n < size; n++)
+    hash = (hash ^ key[n]) * 16777619U;
+  return hash >> (32 - V2_SCHEDULE_CACHE_BITS);
+}
+
+/* RC4 key-scheduling algorithm */
+static void
+v2_expand_key (pdf_u8_t       *s,
+               const pdf_u8_t *key,
+               pdf_size_t      size)
+{
+  pdf_size_t k;
+  pdf_u8_t j;
+  int i;
+
+  for (i = 0; i < 256; i++)
+    s[i] = i;
+
+  j = 0;
+  k = 0;
+  for (i = 0; i < 256; i++)
+    {
+      pdf_u8_t si = s[i];
+
+      j += si + key[k];
+      s[i] = s[j];
+      s[j] = si;
+
+      if (++k == size)
+        k = 0;
+    }
+}
+
+/* Start the keystream from the key schedule */
+static void
+v2_load_schedule (struct pdf_crypt_cipher_v2_s *v2)
+{
+  int n;
+
+  for (n = 0; n < 256; n++)
+    v2->s[n] = v2->schedule[n];
+  v2->i = 0;
+  v2->j = 0;
+}
+
 static pdf_bool_t
 v2_set_key (pdf_crypt_cipher_t  *cipher,
             const pdf_char_t    *key,
@@ -48,76 +135,104 @@ v2_set_key (pdf_crypt_cipher_t  *cipher,
             pdf_error_t        **error)
 {
   struct pdf_crypt_cipher_v2_s *v2 = (struct pdf_crypt_cipher_v2_s *)cipher;
-  gcry_error_t gcry_error;
+  const pdf_u8_t *k = (const pdf_u8_t *)key;
 
-  gcry_error = gcry_cipher_setkey (v2->hd, key, size);
-  if (gcry_error != GPG_ERR_NO_ERROR)
+  if (size < V2_KEY_MIN_SIZE || size > V2_KEY_MAX_SIZE)
     {
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_EBADV2KEY,
-                     "cannot set key in V2 cipher: '%s/%s'",
-                     gcry_strsource (gcry_error),
-                     gcry_strerror (gcry_error));
+                     "cannot set key in V2 cipher: "
+                     "%lu bytes given, should be between %d and %d",
+                     (unsigned long)size,
+                     V2_KEY_MIN_SIZE,
+                     V2_KEY_MAX_SIZE);
       return PDF_FALSE;
     }
+
+  if (size <= V2_SCHEDULE_KEY_MAX_SIZE)
+    {
+      struct v2_schedule_s *entry;
+
+      entry = &v2_schedules[v2_key_hash (k, size)];
+
+      pthread_mutex_lock (&v2_schedules_mutex);
+      if (entry->key_size != size ||
+          memcmp (entry->key, k, size) != 0)
+        {
+          v2_expand_key (entry->s, k, size);
+          memcpy (entry->key, k, size);
+          entry->key_size = size;
+        }
+      memcpy (v2->schedule, entry->s, 256);
+      pthread_mutex_unlock (&v2_schedules_mutex);
+    }
+  else
+    v2_expand_key (v2->schedule, k, size);
+
+  v2_load_schedule (v2);
+  v2->keyed = PDF_TRUE;
+
   return PDF_TRUE;
 }
 
+/* RC4 pseudo-random generation, XORed to the data. Both directions are
+ * the same operation. */
 static pdf_bool_t
-v2_encrypt (pdf_crypt_cipher_t  *cipher,
-            pdf_char_t          *out,
-            pdf_size_t           out_size,
-            const pdf_char_t    *in,
-            pdf_size_t           in_size,
-            pdf_size_t          *result_size,
-            pdf_error_t        **error)
+v2_crypt (pdf_crypt_cipher_t  *cipher,
+          pdf_char_t          *out,
+          pdf_size_t           out_size,
+          const pdf_char_t    *in,
+          pdf_size_t           in_size,
+          pdf_size_t          *result_size,
+          pdf_error_t        **error)
 {
   struct pdf_crypt_cipher_v2_s *v2 = (struct pdf_crypt_cipher_v2_s *)cipher;
-  gcry_error_t gcry_error;
+  const pdf_u8_t *src = (const pdf_u8_t *)in;
+  pdf_u8_t *dst = (pdf_u8_t *)out;
+  pdf_u32_t *s = v2->s;
+  unsigned int i = v2->i;
+  unsigned int j = v2->j;
+  pdf_size_t n;
 
-  gcry_error = gcry_cipher_encrypt (v2->hd, out, out_size, in, in_size);
-  if (gcry_error != GPG_ERR_NO_ERROR)
+  if (!v2->keyed)
     {
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
-                     PDF_ENOMEM,
-                     "cannot set key in V2 cipher: '%s/%s'",
-                     gcry_strsource (gcry_error),
-                     gcry_strerror (gcry_error));
+                     PDF_EBADV2KEY,
+                     "cannot process data in V2 cipher: no key set");
       return PDF_FALSE;
     }
 
-  if (result_size)
-    *result_size = in_size;
-
-  return PDF_TRUE;
-}
-
-static pdf_bool_t
-v2_decrypt (pdf_crypt_cipher_t  *cipher,
-            pdf_char_t          *out,
-            pdf_size_t           out_size,
-            const pdf_char_t    *in,
-            pdf_size_t           in_size,
-            pdf_size_t          *result_size,
-            pdf_error_t        **error)
-{
-  struct pdf_crypt_cipher_v2_s *v2 = (struct pdf_crypt_cipher_v2_s *)cipher;
-  gcry_error_t gcry_error;
-
-  gcry_error = gcry_cipher_decrypt (v2->hd, out, out_size, in, in_size);
-  if (gcry_error != GPG_ERR_NO_ERROR)
+  if (out_size < in_size)
     {
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
-                     PDF_ENOMEM,
-                     "cannot set key in V2 cipher: '%s/%s'",
-                     gcry_strsource (gcry_error),
-                     gcry_strerror (gcry_error));
+                     PDF_EBADDATA,
+                     "cannot process data in V2 cipher: "
+                     "need at least %lu bytes in output (%lu given)",
+                     (unsigned long)in_size,
+                     (unsigned long)out_size);
       return PDF_FALSE;
     }
 
+  for (n = 0; n < in_size; n++)
+    {
+      pdf_u32_t si;
+      pdf_u32_t sj;
+
+      i = (i + 1) & 0xFF;
+      si = s[i];
+      j = (j + si) & 0xFF;
+      sj = s[j];
+      s[i] = sj;
+      s[j] = si;
+      dst[n] = src[n] ^ s[(si + sj) & 0xFF];
+    }
+
+  v2->i = i;
+  v2->j = j;
+
   if (result_size)
     *result_size = in_size;
 
@@ -129,22 +244,36 @@ v2_destroy (pdf_crypt_cipher_t *cipher)
 {
   struct pdf_crypt_cipher_v2_s *v2 = (struct pdf_crypt_cipher_v2_s *)cipher;
 
-  gcry_cipher_close (v2->hd);
-  pdf_dealloc (v2);
+  /* Don't leave the key schedule and the keystream state around */
+  memset (v2->schedule, 0, sizeof (v2->schedule));
+  memset (v2->s, 0, sizeof (v2->s));
+  v2->i = 0;
+  v2->j = 0;
+
+  pdf_dealloc (cipher);
+}
+
+static void
+v2_reset (pdf_crypt_cipher_t *cipher)
+{
+  struct pdf_crypt_cipher_v2_s *v2 = (struct pdf_crypt_cipher_v2_s *)cipher;
+
+  /* Back to the key schedule got in the last set_key */
+  v2_load_schedule (v2);
 }
 
 /* Implementation of the cipher module */
 static const struct pdf_crypt_cipher_s implementation = {
   .set_key = v2_set_key,
-  .encrypt = v2_encrypt,
-  .decrypt = v2_decrypt,
-  .destroy = v2_destroy
+  .encrypt = v2_crypt,
+  .decrypt = v2_crypt,
+  .destroy = v2_destroy,
+  .reset   = v2_reset
 };
 
 pdf_crypt_cipher_t *
 pdf_crypt_cipher_v2_new (pdf_error_t **error)
 {
-  gcry_error_t gcry_error;
   struct pdf_crypt_cipher_v2_s *cipher;
 
   cipher = pdf_alloc (sizeof (struct pdf_crypt_cipher_v2_s));
@@ -161,25 +290,18 @@ pdf_crypt_cipher_v2_new (pdf_error_t **error)
 
   /* Set implementation API */
   cipher->parent = implementation;
-
-  /* Initialize cipher object */
-  gcry_error = gcry_cipher_open (&(cipher->hd),
-                                 GCRY_CIPHER_ARCFOUR,
-                                 GCRY_CIPHER_MODE_STREAM,
-                                 0);
-  if (gcry_error != GPG_ERR_NO_ERROR)
-    {
-      pdf_set_error (error,
-                     PDF_EDOMAIN_BASE_ENCRYPTION,
-                     PDF_ENOMEM,
-                     "cannot initialize V2 cipher: '%s/%s'",
-                     gcry_strsource (gcry_error),
-                     gcry_strerror (gcry_error));
-      pdf_dealloc (cipher);
-      return NULL;
-    }
+  cipher->keyed = PDF_FALSE;
 
   return (pdf_crypt_cipher_t *)cipher;
 }
 
+void
+pdf_crypt_cipher_v2_finish (void)
+{
+  /* The cache holds keys and their schedules */
+  pthread_mutex_lock (&v2_schedules_mutex);
+  memset (v2_schedules, 0, sizeof (v2_schedules));
+  pthread_mutex_unlock (&v2_schedules_mutex);
+}
+
 /* End of pdf-crypt-c-v2.c */
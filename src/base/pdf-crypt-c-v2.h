@@ -31,6 +31,9 @@
 
 pdf_crypt_cipher_t *pdf_crypt_cipher_v2_new (pdf_error_t **error);
 
+/* Forget the keys set in all the V2 ciphers */
+void pdf_crypt_cipher_v2_finish (void);
+
 #endif	/* PDF_CRYPT_C_V2_H */
 
 /* End of pdf-crypt-c-v2.h */
@@ -34,11 +34,15 @@
 #include <pdf-error.h>
 #include <pdf-crypt-md-md5.h>
 
+/* MD5, SHA-1 and SHA-256 message digests only differ in the gcrypt
+ * algorithm */
 struct pdf_crypt_md_md5_s {
   /* Implementation */
   struct pdf_crypt_md_s parent;
   /* Implementation-specific private data */
   gcry_md_hd_t hd;
+  int algo;
+  const pdf_char_t *name;
 };
 
 static pdf_bool_t
@@ -65,7 +69,7 @@ md5_read (pdf_crypt_md_t  *md,
   pdf_size_t required_size;
 
   /* Check required size for output */
-  required_size = gcry_md_get_algo_dlen (GCRY_MD_MD5);
+  required_size = gcry_md_get_algo_dlen (md5->algo);
   if (out_size < required_size)
     {
       pdf_set_error (error,
@@ -91,14 +95,15 @@ md5_read (pdf_crypt_md_t  *md,
       return PDF_FALSE;
     }
 
-  hash = gcry_md_read (md5->hd, GCRY_MD_MD5);
+  hash = gcry_md_read (md5->hd, md5->algo);
   if (!hash)
     {
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
                      "cannot read message digest: "
-                     "MD5 algorithm not enabled");
+                     "%s algorithm not enabled",
+                     md5->name);
       return PDF_FALSE;
     }
 
@@ -125,8 +130,10 @@ static const struct pdf_crypt_md_s implementation = {
   .destroy = md5_destroy
 };
 
-pdf_crypt_md_t *
-pdf_crypt_md_md5_new (pdf_error_t **error)
+static pdf_crypt_md_t *
+md_gcrypt_new (int                algo,
+               const pdf_char_t  *name,
+               pdf_error_t      **error)
 {
   gcry_error_t gcry_error;
   struct pdf_crypt_md_md5_s *md;
@@ -137,8 +144,9 @@ pdf_crypt_md_md5_new (pdf_error_t **error)
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
-                     "cannot create new MD5 message digest object: "
+                     "cannot create new %s message digest object: "
                      "couldn't allocate %lu bytes",
+                     name,
                      (unsigned long)sizeof (struct pdf_crypt_md_md5_s));
       return NULL;
     }
@@ -147,13 +155,16 @@ pdf_crypt_md_md5_new (pdf_error_t **error)
   md->parent = implementation;
 
   /* Initialize message digest object */
-  gcry_error = gcry_md_open (&(md->hd), GCRY_MD_MD5, 0);
+  md->algo = algo;
+  md->name = name;
+  gcry_error = gcry_md_open (&(md->hd), algo, 0);
   if (gcry_error != GPG_ERR_NO_ERROR)
     {
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_ENCRYPTION,
                      PDF_ENOMEM,
-                     "cannot initialize MD5 message digest: '%s/%s'",
+                     "cannot initialize %s message digest: '%s/%s'",
+                     name,
                      gcry_strsource (gcry_error),
                      gcry_strerror (gcry_error));
       pdf_dealloc (md);
@@ -163,4 +174,22 @@ pdf_crypt_md_md5_new (pdf_error_t **error)
   return (pdf_crypt_md_t *)md;
 }
 
+pdf_crypt_md_t *
+pdf_crypt_md_md5_new (pdf_error_t **error)
+{
+  return md_gcrypt_new (GCRY_MD_MD5, "MD5", error);
+}
+
+pdf_crypt_md_t *
+pdf_crypt_md_sha1_new (pdf_error_t **error)
+{
+  return md_gcrypt_new (GCRY_MD_SHA1, "SHA-1", error);
+}
+
+pdf_crypt_md_t *
+pdf_crypt_md_sha256_new (pdf_error_t **error)
+{
+  return md_gcrypt_new (GCRY_MD_SHA256, "SHA-256", error);
+}
+
 /* End of pdf-crypt-md-md5.c */
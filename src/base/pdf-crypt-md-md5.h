@@ -30,6 +30,10 @@
 
 pdf_crypt_md_t *pdf_crypt_md_md5_new (pdf_error_t **error);
 
+pdf_crypt_md_t *pdf_crypt_md_sha1_new (pdf_error_t **error);
+
+pdf_crypt_md_t *pdf_crypt_md_sha256_new (pdf_error_t **error);
+
 #endif /* PDF_CRYPT_MD_MD5_H */
 
 /* End of pdf-crypt-md-md5.h */
@@ -0,0 +1,385 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-crypt-objkeys.c
+ *       Date:         Sat Oct 17 22:10:45 2026
+ *
+ *       GNU PDF Library - Per-object keys of encrypted documents
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <gcrypt.h>
+
+#include <pdf-alloc.h>
+#include <pdf-types.h>
+#include <pdf-error.h>
+#include <pdf-crypt.h>
+
+/* Longest file key of the V2 and AESV2 algorithms, and longest key
+ * derived from it */
+#define OBJKEYS_MAX_FILE_KEY 16
+#define OBJKEYS_MAX_DERIVED  16
+
+/* Key and cipher of an object.  Entries are chained in a bucket of
+ * the hash table and in the LRU list by their indices, -1 ending the
+ * chains. */
+struct objkeys_entry_s
+{
+  pdf_u32_t number;
+  pdf_u32_t generation;
+  pdf_char_t key[PDF_CRYPT_OBJKEY_MAX_SIZE];
+
+  /* Created the first time the cipher of the object is asked for,
+   * and kept for the objects that later reuse the entry */
+  pdf_crypt_cipher_t *cipher;
+  pdf_bool_t keyed;         /* CIPHER has got KEY */
+
+  int bucket_next;
+  int lru_prev;             /* Used more recently */
+  int lru_next;             /* Used less recently */
+};
+
+struct pdf_crypt_objkeys_s
+{
+  enum pdf_crypt_cipher_algo_e algorithm;
+
+  /* ISO 32000-1 algorithm 1 hashes the file key, the three low-order
+   * bytes of the object number, the two low-order bytes of the
+   * generation and, for AESV2, "sAlT".  SEED has all but the object
+   * bytes in place.  AESV3 uses the file key for all the objects. */
+  pdf_bool_t derive;
+  pdf_char_t seed[PDF_CRYPT_OBJKEY_MAX_SIZE + 5 + 4];
+  pdf_size_t seed_size;
+  pdf_size_t file_key_size;
+  pdf_size_t key_size;
+
+  struct objkeys_entry_s *entries;
+  int n_entries;
+  int n_used;
+  int *buckets;
+  unsigned int buckets_mask;
+  int lru_first;
+  int lru_last;
+};
+
+pdf_crypt_objkeys_t *
+pdf_crypt_objkeys_new (enum pdf_crypt_cipher_algo_e   algorithm,
+                       const pdf_char_t              *file_key,
+                       pdf_size_t                     file_key_size,
+                       pdf_size_t                     cache_size,
+                       pdf_error_t                  **error)
+{
+  pdf_crypt_objkeys_t *objkeys;
+  pdf_size_t max_file_key;
+  pdf_size_t n_buckets;
+  int i;
+
+  PDF_ASSERT_RETURN_VAL (algorithm >= PDF_CRYPT_CIPHER_ALGO_AESV2 &&
+                         algorithm <= PDF_CRYPT_CIPHER_ALGO_AESV3,
+                         NULL);
+  PDF_ASSERT_POINTER_RETURN_VAL (file_key, NULL);
+  PDF_ASSERT_RETURN_VAL (cache_size > 0 && cache_size <= 1 << 20, NULL);
+
+  max_file_key = (algorithm == PDF_CRYPT_CIPHER_ALGO_AESV3 ?
+                  PDF_CRYPT_OBJKEY_MAX_SIZE :
+                  OBJKEYS_MAX_FILE_KEY);
+  if (file_key_size == 0 || file_key_size > max_file_key)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_ENCRYPTION,
+                     PDF_EBADDATA,
+                     "cannot create object keys: "
+                     "invalid file key size (%lu), must be at most %lu",
+                     (unsigned long)file_key_size,
+                     (unsigned long)max_file_key);
+      return NULL;
+    }
+
+  objkeys = pdf_alloc (sizeof (struct pdf_crypt_objkeys_s));
+  if (!objkeys)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_ENCRYPTION,
+                     PDF_ENOMEM,
+                     "cannot create object keys: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long)sizeof (struct pdf_crypt_objkeys_s));
+      return NULL;
+    }
+
+  /* Twice as many buckets as entries, at least */
+  for (n_buckets = 2; n_buckets < 2 * cache_size; n_buckets *= 2)
+    ;
+
+  objkeys->algorithm = algorithm;
+  objkeys->n_entries = cache_size;
+  objkeys->n_used = 0;
+  objkeys->buckets_mask = n_buckets - 1;
+  objkeys->lru_first = -1;
+  objkeys->lru_last = -1;
+  objkeys->entries = pdf_alloc (cache_size * sizeof (struct objkeys_entry_s));
+  objkeys->buckets = pdf_alloc (n_buckets * sizeof (int));
+  if (!objkeys->entries || !objkeys->buckets)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_ENCRYPTION,
+                     PDF_ENOMEM,
+                     "cannot create object keys: "
+                     "couldn't allocate a cache of %lu entries",
+                     (unsigned long)cache_size);
+      pdf_dealloc (objkeys->entries);
+      pdf_dealloc (objkeys->buckets);
+      pdf_dealloc (objkeys);
+      return NULL;
+    }
+  for (i = 0; i < n_buckets; i++)
+    objkeys->buckets[i] = -1;
+
+  objkeys->file_key_size = file_key_size;
+  memcpy (objkeys->seed, file_key, file_key_size);
+  objkeys->seed_size = file_key_size + 5;
+  objkeys->derive = (algorithm != PDF_CRYPT_CIPHER_ALGO_AESV3);
+  if (algorithm == PDF_CRYPT_CIPHER_ALGO_AESV2)
+    {
+      memcpy (objkeys->seed + objkeys->seed_size, "sAlT", 4);
+      objkeys->seed_size += 4;
+    }
+  objkeys->key_size = (objkeys->derive ?
+                       PDF_MIN (file_key_size + 5, OBJKEYS_MAX_DERIVED) :
+                       file_key_size);
+
+  return objkeys;
+}
+
+static unsigned int
+objkeys_bucket (const pdf_crypt_objkeys_t *objkeys,
+                pdf_u32_t                  number,
+                pdf_u32_t                  generation)
+{
+  pdf_u32_t h;
+
+  h = (number ^ (generation << 24)) * 0x9E3779B1U;
+  return (h >> 16) & objkeys->buckets_mask;
+}
+
+static void
+objkeys_lru_unlink (pdf_crypt_objkeys_t *objkeys,
+                    int                  i)
+{
+  struct objkeys_entry_s *entry = &objkeys->entries[i];
+
+  if (entry->lru_prev >= 0)
+    objkeys->entries[entry->lru_prev].lru_next = entry->lru_next;
+  else
+    objkeys->lru_first = entry->lru_next;
+
+  if (entry->lru_next >= 0)
+    objkeys->entries[entry->lru_next].lru_prev = entry->lru_prev;
+  else
+    objkeys->lru_last = entry->lru_prev;
+}
+
+static void
+objkeys_lru_push (pdf_crypt_objkeys_t *objkeys,
+                  int                  i)
+{
+  struct objkeys_entry_s *entry = &objkeys->entries[i];
+
+  entry->lru_prev = -1;
+  entry->lru_next = objkeys->lru_first;
+  if (objkeys->lru_first >= 0)
+    objkeys->entries[objkeys->lru_first].lru_prev = i;
+  else
+    objkeys->lru_last = i;
+  objkeys->lru_first = i;
+}
+
+/* Remove the entry I from its bucket */
+static void
+objkeys_bucket_unlink (pdf_crypt_objkeys_t *objkeys,
+                       int                  i)
+{
+  struct objkeys_entry_s *entry = &objkeys->entries[i];
+  int *link;
+
+  link = &objkeys->buckets[objkeys_bucket (objkeys,
+                                           entry->number,
+                                           entry->generation)];
+  while (*link != i)
+    link = &objkeys->entries[*link].bucket_next;
+  *link = entry->bucket_next;
+}
+
+/* Entry of an object, made the most recently used, deriving its key
+ * in the least recently used entry if not in the cache */
+static struct objkeys_entry_s *
+objkeys_lookup (pdf_crypt_objkeys_t *objkeys,
+                pdf_u32_t            number,
+                pdf_u32_t            generation)
+{
+  struct objkeys_entry_s *entry;
+  pdf_uchar_t digest[16];
+  unsigned int bucket;
+  int i;
+
+  bucket = objkeys_bucket (objkeys, number, generation);
+  for (i = objkeys->buckets[bucket]; i >= 0; i = entry->bucket_next)
+    {
+      entry = &objkeys->entries[i];
+      if (entry->number == number &&
+          entry->generation == generation)
+        {
+          if (i != objkeys->lru_first)
+            {
+              objkeys_lru_unlink (objkeys, i);
+              objkeys_lru_push (objkeys, i);
+            }
+          return entry;
+        }
+    }
+
+  /* Miss: take a new entry while there are, the least recently used
+   * one afterwards */
+  if (objkeys->n_used < objkeys->n_entries)
+    {
+      i = objkeys->n_used++;
+      objkeys->entries[i].cipher = NULL;
+    }
+  else
+    {
+      i = objkeys->lru_last;
+      objkeys_bucket_unlink (objkeys, i);
+      objkeys_lru_unlink (objkeys, i);
+    }
+
+  entry = &objkeys->entries[i];
+  entry->number = number;
+  entry->generation = generation;
+  entry->keyed = PDF_FALSE;
+  entry->bucket_next = objkeys->buckets[bucket];
+  objkeys->buckets[bucket] = i;
+  objkeys_lru_push (objkeys, i);
+
+  if (objkeys->derive)
+    {
+      pdf_char_t *p = objkeys->seed + objkeys->file_key_size;
+
+      /* The whole seed fits in a single MD5 block, so hashing it at
+       * once costs no more than resuming from the file key */
+      p[0] = number & 0xFF;
+      p[1] = (number >> 8) & 0xFF;
+      p[2] = (number >> 16) & 0xFF;
+      p[3] = generation & 0xFF;
+      p[4] = (generation >> 8) & 0xFF;
+      gcry_md_hash_buffer (GCRY_MD_MD5,
+                           digest,
+                           objkeys->seed,
+                           objkeys->seed_size);
+      memcpy (entry->key, digest, objkeys->key_size);
+    }
+  else
+    memcpy (entry->key, objkeys->seed, objkeys->key_size);
+
+  return entry;
+}
+
+pdf_bool_t
+pdf_crypt_objkeys_get_key (pdf_crypt_objkeys_t  *objkeys,
+                           pdf_u32_t             number,
+                           pdf_u32_t             generation,
+                           pdf_char_t           *key,
+                           pdf_size_t           *key_size,
+                           pdf_error_t         **error)
+{
+  struct objkeys_entry_s *entry;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (objkeys, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (key, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (key_size, PDF_FALSE);
+
+  entry = objkeys_lookup (objkeys, number, generation);
+  memcpy (key, entry->key, objkeys->key_size);
+  *key_size = objkeys->key_size;
+  return PDF_TRUE;
+}
+
+pdf_crypt_cipher_t *
+pdf_crypt_objkeys_get_cipher (pdf_crypt_objkeys_t  *objkeys,
+                              pdf_u32_t             number,
+                              pdf_u32_t             generation,
+                              pdf_error_t         **error)
+{
+  struct objkeys_entry_s *entry;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (objkeys, NULL);
+
+  entry = objkeys_lookup (objkeys, number, generation);
+
+  if (!entry->cipher)
+    {
+      entry->cipher = pdf_crypt_cipher_new (objkeys->algorithm, error);
+      if (!entry->cipher)
+        return NULL;
+    }
+
+  if (entry->keyed)
+    {
+      /* Ready for a new string or stream of the same object */
+      pdf_crypt_cipher_reset (entry->cipher);
+    }
+  else
+    {
+      if (!pdf_crypt_cipher_set_key (entry->cipher,
+                                     entry->key,
+                                     objkeys->key_size,
+                                     error))
+        return NULL;
+      entry->keyed = PDF_TRUE;
+    }
+
+  return entry->cipher;
+}
+
+void
+pdf_crypt_objkeys_destroy (pdf_crypt_objkeys_t *objkeys)
+{
+  int i;
+
+  if (!objkeys)
+    return;
+
+  for (i = 0; i < objkeys->n_used; i++)
+    {
+      if (objkeys->entries[i].cipher)
+        pdf_crypt_cipher_destroy (objkeys->entries[i].cipher);
+    }
+
+  /* The file key was kept in the seed */
+  memset (objkeys->seed, 0, sizeof (objkeys->seed));
+  memset (objkeys->entries, 0,
+          objkeys->n_entries * sizeof (struct objkeys_entry_s));
+
+  pdf_dealloc (objkeys->entries);
+  pdf_dealloc (objkeys->buckets);
+  pdf_dealloc (objkeys);
+}
+
+/* End of pdf-crypt-objkeys.c */
@@ -25,6 +25,7 @@
 
 #include <config.h>
 
+#include <string.h>
 #include <gcrypt.h>
 
 #include <pdf-crypt.h>
@@ -49,6 +50,12 @@ pdf_crypt_init (pdf_error_t **error)
   return PDF_TRUE;
 }
 
+void
+pdf_crypt_finish (void)
+{
+  pdf_crypt_cipher_v2_finish ();
+}
+
 pdf_char_t *
 pdf_crypt_nonce (pdf_char_t *buffer,
                  pdf_size_t  size)
@@ -62,7 +69,7 @@ pdf_crypt_cipher_new (enum pdf_crypt_cipher_algo_e   algorithm,
                       pdf_error_t                  **error)
 {
   PDF_ASSERT_RETURN_VAL (algorithm >= PDF_CRYPT_CIPHER_ALGO_AESV2 &&
-                         algorithm <= PDF_CRYPT_CIPHER_ALGO_V2,
+                         algorithm <= PDF_CRYPT_CIPHER_ALGO_AESV3,
                          NULL);
 
   switch (algorithm)
@@ -71,6 +78,8 @@ pdf_crypt_cipher_new (enum pdf_crypt_cipher_algo_e   algorithm,
       return pdf_crypt_cipher_aesv2_new (error);
     case PDF_CRYPT_CIPHER_ALGO_V2:
       return pdf_crypt_cipher_v2_new (error);
+    case PDF_CRYPT_CIPHER_ALGO_AESV3:
+      return pdf_crypt_cipher_aesv3_new (error);
     }
 }
 
@@ -78,10 +87,275 @@ pdf_crypt_md_t *
 pdf_crypt_md_new (enum pdf_crypt_md_algo_e   algorithm,
                   pdf_error_t              **error)
 {
-  /* So far, only MD5 supported */
-  PDF_ASSERT_RETURN_VAL (algorithm == PDF_CRYPT_MD_MD5, NULL);
+  PDF_ASSERT_RETURN_VAL (algorithm >= PDF_CRYPT_MD_MD5 &&
+                         algorithm <= PDF_CRYPT_MD_SHA256,
+                         NULL);
+
+  switch (algorithm)
+    {
+    case PDF_CRYPT_MD_MD5:
+      return pdf_crypt_md_md5_new (error);
+    case PDF_CRYPT_MD_SHA1:
+      return pdf_crypt_md_sha1_new (error);
+    case PDF_CRYPT_MD_SHA256:
+      return pdf_crypt_md_sha256_new (error);
+    }
+
+  return NULL;
+}
+
+/* Revision 6 of the standard security handler */
+
+/* Passwords are UTF-8 strings of up to 127 bytes */
+#define R6_MAX_PASSWORD 127
+
+/* Check that a gcrypt call succeeded */
+static pdf_bool_t
+r6_check (gcry_error_t   gcry_error,
+          pdf_error_t  **error)
+{
+  if (gcry_error == GPG_ERR_NO_ERROR)
+    return PDF_TRUE;
+
+  pdf_set_error (error,
+                 PDF_EDOMAIN_BASE_ENCRYPTION,
+                 PDF_ERROR,
+                 "cannot compute revision 6 password hash: '%s/%s'",
+                 gcry_strsource (gcry_error),
+                 gcry_strerror (gcry_error));
+  return PDF_FALSE;
+}
+
+/* Hash of PASSWORD and SALT, and of the 48 bytes of UDATA if not
+ * NULL, as ISO 32000-2 algorithm 2.B: a SHA-256 hash refined by at
+ * least 64 rounds of AES-128 encryption and SHA-2 hashing.  HASH gets
+ * PDF_CRYPT_R6_HASH_SIZE bytes. */
+pdf_bool_t
+pdf_crypt_r6_hash (const pdf_char_t  *password,
+                   pdf_size_t         password_size,
+                   const pdf_char_t  *salt,
+                   const pdf_char_t  *udata,
+                   pdf_char_t        *hash,
+                   pdf_error_t      **error)
+{
+  /* K is the output of SHA-256, SHA-384 or SHA-512 */
+  pdf_uchar_t k[64];
+  pdf_size_t k_size = 32;
+  pdf_size_t udata_size = (udata ? PDF_CRYPT_R6_OU_SIZE : 0);
+  pdf_size_t k1_size;
+  pdf_uchar_t *k1;
+  pdf_uchar_t *e;
+  gcry_md_hd_t md;
+  gcry_cipher_hd_t aes;
+  pdf_bool_t ret = PDF_FALSE;
+  unsigned int sum;
+  int algo;
+  int round;
+  int i;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (salt, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (hash, PDF_FALSE);
+
+  password_size = PDF_MIN (password_size, R6_MAX_PASSWORD);
+
+  /* Initial hash, SHA-256 (password . salt . udata) */
+  if (!r6_check (gcry_md_open (&md, GCRY_MD_SHA256, 0), error))
+    return PDF_FALSE;
+  gcry_md_write (md, password, password_size);
+  gcry_md_write (md, salt, PDF_CRYPT_R6_SALT_SIZE);
+  if (udata)
+    gcry_md_write (md, udata, udata_size);
+  memcpy (k, gcry_md_read (md, GCRY_MD_SHA256), k_size);
+  gcry_md_close (md);
+
+  /* K1 is 64 copies of (password . K . udata), at most 64 * 239
+   * bytes, and E its encryption */
+  k1 = pdf_alloc (2 * 64 * (R6_MAX_PASSWORD + 64 + PDF_CRYPT_R6_OU_SIZE));
+  if (!k1)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_ENCRYPTION,
+                     PDF_ENOMEM,
+                     "cannot compute revision 6 password hash: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) (2 * 64 * (R6_MAX_PASSWORD + 64
+                                                + PDF_CRYPT_R6_OU_SIZE)));
+      return PDF_FALSE;
+    }
+  e = k1 + 64 * (R6_MAX_PASSWORD + 64 + PDF_CRYPT_R6_OU_SIZE);
+
+  if (!r6_check (gcry_cipher_open (&aes,
+                                   GCRY_CIPHER_AES128,
+                                   GCRY_CIPHER_MODE_CBC,
+                                   0),
+                 error))
+    {
+      pdf_dealloc (k1);
+      return PDF_FALSE;
+    }
+
+  for (round = 0; ; round++)
+    {
+      /* The block repeated in K1 is a multiple of 16 bytes long only
+       * when it's 64 times as long */
+      k1_size = password_size + k_size + udata_size;
+      memcpy (k1, password, password_size);
+      memcpy (k1 + password_size, k, k_size);
+      if (udata)
+        memcpy (k1 + password_size + k_size, udata, udata_size);
+      for (i = 1; i < 64; i++)
+        memcpy (k1 + i * k1_size, k1, k1_size);
+      k1_size *= 64;
+
+      /* E is K1 encrypted with the first 16 bytes of K as key and the
+       * next 16 bytes as IV */
+      if (!r6_check (gcry_cipher_setkey (aes, k, 16), error)
+          || !r6_check (gcry_cipher_setiv (aes, k + 16, 16), error)
+          || !r6_check (gcry_cipher_encrypt (aes, e, k1_size, k1, k1_size),
+                        error))
+        goto out;
+
+      /* The first 16 bytes of E taken as a big number, modulo 3, tell
+       * the next hash function.  256 is 1 modulo 3. */
+      for (i = 0, sum = 0; i < 16; i++)
+        sum += e[i];
+      switch (sum % 3)
+        {
+        case 0:
+          algo = GCRY_MD_SHA256;
+          k_size = 32;
+          break;
+        case 1:
+          algo = GCRY_MD_SHA384;
+          k_size = 48;
+          break;
+        default:
+          algo = GCRY_MD_SHA512;
+          k_size = 64;
+          break;
+        }
+      gcry_md_hash_buffer (algo, k, e, k1_size);
+
+      /* At least 64 rounds, and then until the last byte of E is at
+       * most the round number minus 32 */
+      if (round + 1 >= 64 && e[k1_size - 1] <= round + 1 - 32)
+        break;
+    }
+
+  memcpy (hash, k, PDF_CRYPT_R6_HASH_SIZE);
+  ret = PDF_TRUE;
+
+ out:
+  gcry_cipher_close (aes);
+  pdf_dealloc (k1);
+  return ret;
+}
+
+/* Decrypt the file encryption key in the OE or UE entry ENCRYPTED_KEY
+ * with the hash of the password and the key salt of the O or U entry
+ * HASHED */
+static pdf_bool_t
+r6_decrypt_key (const pdf_char_t  *password,
+                pdf_size_t         password_size,
+                const pdf_char_t  *hashed,
+                const pdf_char_t  *udata,
+                const pdf_char_t  *encrypted_key,
+                pdf_char_t        *key,
+                pdf_error_t      **error)
+{
+  pdf_char_t intermediate[PDF_CRYPT_R6_HASH_SIZE];
+  gcry_cipher_hd_t aes;
+  pdf_bool_t ret;
+
+  if (!pdf_crypt_r6_hash (password,
+                          password_size,
+                          hashed + PDF_CRYPT_R6_HASH_SIZE + PDF_CRYPT_R6_SALT_SIZE,
+                          udata,
+                          intermediate,
+                          error))
+    return PDF_FALSE;
+
+  /* AES-256 without padding, and a zero IV */
+  if (!r6_check (gcry_cipher_open (&aes,
+                                   GCRY_CIPHER_AES256,
+                                   GCRY_CIPHER_MODE_CBC,
+                                   0),
+                 error))
+    return PDF_FALSE;
+  ret = (r6_check (gcry_cipher_setkey (aes, intermediate, sizeof (intermediate)),
+                   error)
+         && r6_check (gcry_cipher_decrypt (aes,
+                                           key,
+                                           PDF_CRYPT_R6_KEY_SIZE,
+                                           encrypted_key,
+                                           PDF_CRYPT_R6_OEUE_SIZE),
+                      error));
+  gcry_cipher_close (aes);
+  return ret;
+}
+
+/* File encryption key of a document using revision 6 of the standard
+ * security handler, given its owner or its user PASSWORD and the O, U,
+ * OE and UE entries of its encryption dictionary (ISO 32000-2
+ * algorithm 2.A).  KEY gets PDF_CRYPT_R6_KEY_SIZE bytes, and OWNER,
+ * if not NULL, whether PASSWORD is the owner password.  Fails with
+ * PDF_EBADPASSWD if PASSWORD is neither. */
+pdf_bool_t
+pdf_crypt_r6_file_key (const pdf_char_t  *password,
+                       pdf_size_t         password_size,
+                       const pdf_char_t  *o,
+                       const pdf_char_t  *u,
+                       const pdf_char_t  *oe,
+                       const pdf_char_t  *ue,
+                       pdf_char_t        *key,
+                       pdf_bool_t        *owner,
+                       pdf_error_t      **error)
+{
+  pdf_char_t hash[PDF_CRYPT_R6_HASH_SIZE];
+
+  PDF_ASSERT_POINTER_RETURN_VAL (o, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (u, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (oe, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (ue, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (key, PDF_FALSE);
+
+  /* The O and U entries are the hash of the password with a
+   * validation salt, followed by that salt and a key salt.  The owner
+   * password is hashed with the U entry. */
+  if (!pdf_crypt_r6_hash (password,
+                          password_size,
+                          o + PDF_CRYPT_R6_HASH_SIZE,
+                          u,
+                          hash,
+                          error))
+    return PDF_FALSE;
+  if (memcmp (hash, o, PDF_CRYPT_R6_HASH_SIZE) == 0)
+    {
+      if (owner)
+        *owner = PDF_TRUE;
+      return r6_decrypt_key (password, password_size, o, u, oe, key, error);
+    }
+
+  if (!pdf_crypt_r6_hash (password,
+                          password_size,
+                          u + PDF_CRYPT_R6_HASH_SIZE,
+                          NULL,
+                          hash,
+                          error))
+    return PDF_FALSE;
+  if (memcmp (hash, u, PDF_CRYPT_R6_HASH_SIZE) == 0)
+    {
+      if (owner)
+        *owner = PDF_FALSE;
+      return r6_decrypt_key (password, password_size, u, NULL, ue, key, error);
+    }
 
-  return pdf_crypt_md_md5_new (error);
+  pdf_set_error (error,
+                 PDF_EDOMAIN_BASE_ENCRYPTION,
+                 PDF_EBADPASSWD,
+                 "cannot compute revision 6 file key: "
+                 "password is neither the owner nor the user one");
+  return PDF_FALSE;
 }
 
 /* End of pdf-crypt.c */
@@ -42,7 +42,8 @@
 enum pdf_crypt_cipher_algo_e
 {
   PDF_CRYPT_CIPHER_ALGO_AESV2,
-  PDF_CRYPT_CIPHER_ALGO_V2
+  PDF_CRYPT_CIPHER_ALGO_V2,
+  PDF_CRYPT_CIPHER_ALGO_AESV3
 };
 
 typedef struct pdf_crypt_cipher_s pdf_crypt_cipher_t;
@@ -71,7 +72,10 @@ struct pdf_crypt_cipher_s
 
   void (*destroy) (pdf_crypt_cipher_t *cipher);
 
-  void *padding[4];
+  /* Start a new message with the same key */
+  void (*reset) (pdf_crypt_cipher_t *cipher);
+
+  void *padding[3];
 };
 
 pdf_crypt_cipher_t *pdf_crypt_cipher_new (enum pdf_crypt_cipher_algo_e   algorithm,
@@ -101,14 +105,25 @@ pdf_crypt_cipher_t *pdf_crypt_cipher_new (enum pdf_crypt_cipher_algo_e   algorit
 #define pdf_crypt_cipher_destroy(cipher)        \
   ((pdf_crypt_cipher_t *)(cipher))->destroy (cipher)
 
+#define pdf_crypt_cipher_reset(cipher)          \
+  ((pdf_crypt_cipher_t *)(cipher))->reset (cipher)
+
 /* ------------------ Crypt Module Message Digest API ---------------------- */
 
 /* Hashing types */
 enum pdf_crypt_md_algo_e
 {
   PDF_CRYPT_MD_MD5,
+  PDF_CRYPT_MD_SHA1,
+  PDF_CRYPT_MD_SHA256
 };
 
+/* Sizes of the digests */
+#define PDF_CRYPT_MD_MD5_SIZE    16
+#define PDF_CRYPT_MD_SHA1_SIZE   20
+#define PDF_CRYPT_MD_SHA256_SIZE 32
+#define PDF_CRYPT_MD_MAX_SIZE    32
+
 typedef struct pdf_crypt_md_s pdf_crypt_md_t;
 struct pdf_crypt_md_s
 {
@@ -150,10 +165,69 @@ pdf_crypt_md_t *pdf_crypt_md_new (enum pdf_crypt_md_algo_e   algorithm,
 pdf_char_t *pdf_crypt_nonce (pdf_char_t *buffer,
                              pdf_size_t  size);
 
+/* Revision 6 of the standard security handler (AESV3) */
+
+/* Sizes of the hashes and salts of the O and U entries, of the OE and
+ * UE entries, and of the file encryption key */
+#define PDF_CRYPT_R6_HASH_SIZE 32
+#define PDF_CRYPT_R6_SALT_SIZE 8
+#define PDF_CRYPT_R6_OU_SIZE   48
+#define PDF_CRYPT_R6_OEUE_SIZE 32
+#define PDF_CRYPT_R6_KEY_SIZE  32
+
+pdf_bool_t pdf_crypt_r6_hash (const pdf_char_t  *password,
+                              pdf_size_t         password_size,
+                              const pdf_char_t  *salt,
+                              const pdf_char_t  *udata,
+                              pdf_char_t        *hash,
+                              pdf_error_t      **error);
+
+pdf_bool_t pdf_crypt_r6_file_key (const pdf_char_t  *password,
+                                  pdf_size_t         password_size,
+                                  const pdf_char_t  *o,
+                                  const pdf_char_t  *u,
+                                  const pdf_char_t  *oe,
+                                  const pdf_char_t  *ue,
+                                  pdf_char_t        *key,
+                                  pdf_bool_t        *owner,
+                                  pdf_error_t      **error);
+
+/* ------------------ Crypt Module Object Keys API ---------------------- */
+
+/* Keys of the strings and streams of the objects of an encrypted
+ * document, derived from its file key, with a cache of the keys and
+ * ciphers of the objects used last */
+typedef struct pdf_crypt_objkeys_s pdf_crypt_objkeys_t;
+
+/* Longest key of an object */
+#define PDF_CRYPT_OBJKEY_MAX_SIZE 32
+
+pdf_crypt_objkeys_t *pdf_crypt_objkeys_new (enum pdf_crypt_cipher_algo_e   algorithm,
+                                            const pdf_char_t              *file_key,
+                                            pdf_size_t                     file_key_size,
+                                            pdf_size_t                     cache_size,
+                                            pdf_error_t                  **error);
+
+pdf_bool_t pdf_crypt_objkeys_get_key (pdf_crypt_objkeys_t  *objkeys,
+                                      pdf_u32_t             number,
+                                      pdf_u32_t             generation,
+                                      pdf_char_t           *key,
+                                      pdf_size_t           *key_size,
+                                      pdf_error_t         **error);
+
+pdf_crypt_cipher_t *pdf_crypt_objkeys_get_cipher (pdf_crypt_objkeys_t  *objkeys,
+                                                  pdf_u32_t             number,
+                                                  pdf_u32_t             generation,
+                                                  pdf_error_t         **error);
+
+void pdf_crypt_objkeys_destroy (pdf_crypt_objkeys_t *objkeys);
+
 /* END PUBLIC */
 
 pdf_bool_t pdf_crypt_init (pdf_error_t **error);
 
+void pdf_crypt_finish (void);
+
 #endif /* PDF_CRYPT_H */
 
 /* End of pdf-crypt.h */
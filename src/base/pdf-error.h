@@ -79,7 +79,8 @@
   ERROR_ENTRY (PDF_ETYPE3,      "/FunctionType 3: Error"),            \
   ERROR_ENTRY (PDF_ETYPE4,      "/FunctionType 4: Error"),            \
   ERROR_ENTRY (PDF_EBADFILE,    "file violates PDF specifications"),  \
-  ERROR_ENTRY (PDF_EIMPLLIMIT,  "implementation limit exceeded")
+  ERROR_ENTRY (PDF_EIMPLLIMIT,  "implementation limit exceeded"),       \
+  ERROR_ENTRY (PDF_EBADPASSWD,  "the password doesn't match the document")
 
 typedef enum pdf_status_e pdf_status_t;
 #define ERROR_ENTRY(id,string) id
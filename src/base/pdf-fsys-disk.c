@@ -48,6 +48,11 @@
 #include <dirent.h>
 #include <unistd.h>
 
+#if defined HAVE_SYS_MMAN_H && defined HAVE_MMAP
+#   define PDF_FSYS_DISK_MMAP 1
+#   include <sys/mman.h>
+#endif /* HAVE_SYS_MMAN_H && HAVE_MMAP */
+
 #include <pdf-types.h>
 #include <pdf-error.h>
 #include <pdf-fsys-disk.h>
@@ -1663,6 +1668,70 @@ file_flush (pdf_fsys_file_t  *file,
   return PDF_TRUE;
 }
 
+#if defined HAVE_PREAD
+
+static pdf_bool_t
+file_pread (pdf_fsys_file_t  *file,
+            pdf_char_t       *buf,
+            pdf_size_t        bytes,
+            pdf_off_t         offset,
+            pdf_size_t       *read_bytes,
+            pdf_error_t     **error)
+{
+  struct pdf_fsys_disk_file_s *disk_file = (struct pdf_fsys_disk_file_s *)file;
+  int fd;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (file, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (buf, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (read_bytes, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (disk_file->file_descriptor > 0, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (offset >= 0, PDF_FALSE);
+
+  /* Pending buffered writes must reach the file before reading it
+   * directly. Read-only files are left alone, so that they can be
+   * read concurrently. */
+  if (disk_file->common.mode != PDF_FSYS_OPEN_MODE_READ &&
+      !file_flush (file, error))
+    return PDF_FALSE;
+
+  /* Go straight to the descriptor: the stdio buffer and file position
+   * are shared state, this is not */
+  fd = fileno (disk_file->file_descriptor);
+
+  *read_bytes = 0;
+  while (*read_bytes < bytes)
+    {
+      ssize_t n;
+
+      n = pread (fd,
+                 buf + *read_bytes,
+                 bytes - *read_bytes,
+                 offset + *read_bytes);
+      if (n < 0)
+        {
+          if (errno == EINTR)
+            continue;
+
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_FSYS,
+                         get_status_from_errno (errno),
+                         "cannot read from file: '%s'",
+                         strerror (errno));
+          return PDF_FALSE;
+        }
+
+      /* On EOF, PDF_FALSE without error */
+      if (n == 0)
+        return PDF_FALSE;
+
+      *read_bytes += n;
+    }
+
+  return PDF_TRUE;
+}
+
+#endif /* HAVE_PREAD */
+
 static pdf_u32_t
 file_request_ria (pdf_fsys_file_t  *file,
                   pdf_off_t         offset,
@@ -1695,6 +1764,74 @@ file_cancel_ria (pdf_fsys_file_t  *file,
   return PDF_TRUE;
 }
 
+#if defined PDF_FSYS_DISK_MMAP
+
+static const pdf_char_t *
+file_map (pdf_fsys_file_t              *file,
+          pdf_off_t                     offset,
+          pdf_size_t                    size,
+          enum pdf_fsys_file_access_e   access,
+          pdf_error_t                 **error)
+{
+  struct pdf_fsys_disk_file_s *disk_file = (struct pdf_fsys_disk_file_s *)file;
+  pdf_off_t delta;
+  void *addr;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (file, NULL);
+  PDF_ASSERT_RETURN_VAL (disk_file->file_descriptor > 0, NULL);
+  PDF_ASSERT_RETURN_VAL (offset >= 0, NULL);
+  PDF_ASSERT_RETURN_VAL (size > 0, NULL);
+
+  /* Pending writes in the stdio buffer must reach the file before it
+   * gets mapped */
+  if (!file_flush (file, error))
+    return NULL;
+
+  /* The offset given to mmap() must be page-aligned */
+  delta = offset % sysconf (_SC_PAGESIZE);
+
+  addr = mmap (NULL,
+               size + delta,
+               PROT_READ,
+               MAP_SHARED,
+               fileno (disk_file->file_descriptor),
+               offset - delta);
+  if (addr == MAP_FAILED)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_FSYS,
+                     get_status_from_errno (errno),
+                     "cannot map file: '%s'",
+                     strerror (errno));
+      return NULL;
+    }
+
+#if defined HAVE_MADVISE
+  /* The advice is just a hint, so errors are ignored */
+  if (access == PDF_FSYS_ACCESS_SEQUENTIAL)
+    madvise (addr, size + delta, MADV_SEQUENTIAL);
+  else if (access == PDF_FSYS_ACCESS_RANDOM)
+    madvise (addr, size + delta, MADV_RANDOM);
+#endif /* HAVE_MADVISE */
+
+  return (const pdf_char_t *)addr + delta;
+}
+
+static void
+file_unmap (pdf_fsys_file_t  *file,
+            const pdf_char_t *data,
+            pdf_off_t         offset,
+            pdf_size_t        size)
+{
+  pdf_off_t delta;
+
+  PDF_ASSERT_POINTER_RETURN (data);
+
+  delta = offset % sysconf (_SC_PAGESIZE);
+  munmap ((void *)(data - delta), size + delta);
+}
+
+#endif /* PDF_FSYS_DISK_MMAP */
 
 /* Host-dependent freopen() */
 #ifdef PDF_HOST_WIN32
@@ -2002,6 +2139,13 @@ static struct pdf_fsys_disk_s pdf_fsys_disk_implementation =
     .common.file_request_ria_fn    = file_request_ria,
     .common.file_has_ria_fn        = file_has_ria,
     .common.file_cancel_ria_fn     = file_cancel_ria,
+#if defined PDF_FSYS_DISK_MMAP
+    .common.file_map_fn            = file_map,
+    .common.file_unmap_fn          = file_unmap,
+#endif /* PDF_FSYS_DISK_MMAP */
+#if defined HAVE_PREAD
+    .common.file_pread_fn          = file_pread,
+#endif /* HAVE_PREAD */
   };
 
 static void
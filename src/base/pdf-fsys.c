@@ -97,6 +97,10 @@ validate_implementation (const pdf_char_t         *id,
   VALIDATE_METHOD (file_has_ria_fn);
   VALIDATE_METHOD (file_cancel_ria_fn);
 
+  /* Mapping is optional, but if provided it must be complete */
+  if (implementation->file_map_fn)
+    VALIDATE_METHOD (file_unmap_fn);
+
 #undef VALIDATE_METHOD
 
   return PDF_TRUE;
@@ -90,6 +90,17 @@ enum pdf_fsys_file_mode_e
     PDF_FSYS_OPEN_MODE_MAX,
   };
 
+/* Expected access pattern over a mapped region of a file */
+enum pdf_fsys_file_access_e
+  {
+    /* No special treatment */
+    PDF_FSYS_ACCESS_NORMAL = 0,
+    /* The region will be read from start to end */
+    PDF_FSYS_ACCESS_SEQUENTIAL,
+    /* The region will be read at random offsets */
+    PDF_FSYS_ACCESS_RANDOM
+  };
+
 /* ---------------------- Filesystem Implementation API --------------------- */
 
 typedef struct pdf_fsys_s pdf_fsys_t;
@@ -213,6 +224,14 @@ typedef pdf_bool_t (*pdf_fsys_file_write_fn_t) (pdf_fsys_file_t  *file,
 typedef pdf_bool_t (*pdf_fsys_file_flush_fn_t) (pdf_fsys_file_t  *file,
                                                 pdf_error_t     **error);
 
+/* Positional read, neither using nor modifying the file position (optional) */
+typedef pdf_bool_t (*pdf_fsys_file_pread_fn_t) (pdf_fsys_file_t  *file,
+                                                pdf_char_t       *buf,
+                                                pdf_size_t        bytes,
+                                                pdf_off_t         offset,
+                                                pdf_size_t       *read_bytes,
+                                                pdf_error_t     **error);
+
 /* ------ (File) Read In Advance */
 
 typedef pdf_u32_t (*pdf_fsys_file_request_ria_fn_t) (pdf_fsys_file_t  *file,
@@ -226,6 +245,19 @@ typedef pdf_bool_t (*pdf_fsys_file_cancel_ria_fn_t) (pdf_fsys_file_t  *file,
                                                      pdf_u32_t         ria_id,
                                                      pdf_error_t     **error);
 
+/* ------ (File) Memory Mapping (optional) */
+
+typedef const pdf_char_t * (*pdf_fsys_file_map_fn_t) (pdf_fsys_file_t              *file,
+                                                      pdf_off_t                     offset,
+                                                      pdf_size_t                    size,
+                                                      enum pdf_fsys_file_access_e   access,
+                                                      pdf_error_t                 **error);
+
+typedef void (*pdf_fsys_file_unmap_fn_t) (pdf_fsys_file_t  *file,
+                                          const pdf_char_t *data,
+                                          pdf_off_t         offset,
+                                          pdf_size_t        size);
+
 /* Filesystem implementation */
 struct pdf_fsys_s
 {
@@ -264,8 +296,12 @@ struct pdf_fsys_s
   pdf_fsys_file_request_ria_fn_t file_request_ria_fn;
   pdf_fsys_file_has_ria_fn_t file_has_ria_fn;
   pdf_fsys_file_cancel_ria_fn_t file_cancel_ria_fn;
+  /* Optional methods, may be NULL */
+  pdf_fsys_file_map_fn_t file_map_fn;
+  pdf_fsys_file_unmap_fn_t file_unmap_fn;
+  pdf_fsys_file_pread_fn_t file_pread_fn;
   /*    <Padding> */
-  void *fsys_file_padding[32];
+  void *fsys_file_padding[29];
 };
 
 /* File implementation */
@@ -391,6 +427,12 @@ pdf_hash_t *pdf_fsys_item_props_to_hash (const struct pdf_fsys_item_props_s  *it
 #define pdf_fsys_file_flush(file, error)        \
   file->fsys->file_flush_fn (file, error)
 
+#define pdf_fsys_file_can_pread_p(file)         \
+  (file->fsys->file_pread_fn != NULL)
+
+#define pdf_fsys_file_pread(file, buf, bytes, offset, read_bytes, error) \
+  file->fsys->file_pread_fn (file, buf, bytes, offset, read_bytes, error)
+
 #define pdf_fsys_file_request_ria(file, offset, size, error)    \
   file->fsys->file_request_ria_fn (file, offset, size, error)
 
@@ -400,6 +442,15 @@ pdf_hash_t *pdf_fsys_item_props_to_hash (const struct pdf_fsys_item_props_s  *it
 #define pdf_fsys_file_cancel_ria(file, ria_id, error)   \
   file->fsys->file_cancel_ria_fn (file, ria_id, error)
 
+#define pdf_fsys_file_can_map_p(file)           \
+  (file->fsys->file_map_fn != NULL)
+
+#define pdf_fsys_file_map(file, offset, size, access, error)    \
+  file->fsys->file_map_fn (file, offset, size, access, error)
+
+#define pdf_fsys_file_unmap(file, data, offset, size)   \
+  file->fsys->file_unmap_fn (file, data, offset, size)
+
 /* Common for all proper filesystem implementations... */
 
 #define pdf_fsys_file_get_filesystem(file)      \
@@ -238,7 +238,7 @@ pdf_hash_add_i32 (pdf_hash_t        *table,
 }
 
 pdf_i32_t
-pdf_hash_get_i32 (pdf_hash_t       *table,
+pdf_hash_get_i32 (const pdf_hash_t *table,
                   const pdf_char_t *key)
 {
   return (pdf_i32_t) ((long) pdf_hash_get_value (table, key));
@@ -258,7 +258,7 @@ pdf_hash_add_u32 (pdf_hash_t        *table,
 }
 
 pdf_u32_t
-pdf_hash_get_u32 (pdf_hash_t       *table,
+pdf_hash_get_u32 (const pdf_hash_t *table,
                   const pdf_char_t *key)
 {
   return (pdf_u32_t) ((unsigned long)pdf_hash_get_value (table, key));
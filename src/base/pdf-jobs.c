@@ -0,0 +1,443 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-jobs.c
+ *       Date:         Sat Oct 17 13:07:40 2026
+ *
+ *       GNU PDF Library - Job pool
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <pdf-alloc.h>
+#include <pdf-jobs.h>
+
+/* Initial number of slots in a worker queue */
+#define PDF_JOBS_QUEUE_SIZE 64
+
+/* A batch of jobs submitted with pdf_jobs_run */
+struct pdf_jobs_batch_s
+{
+  pdf_jobs_fn_t fn;
+  pdf_char_t *jobs;
+  pdf_size_t job_size;
+
+  /* Number of jobs not finished yet, protected by the pool lock */
+  pdf_size_t pending;
+  pthread_cond_t done;
+};
+
+/* A single job of a batch */
+struct pdf_jobs_task_s
+{
+  struct pdf_jobs_batch_s *batch;
+  pdf_size_t index;
+};
+
+/* Double-ended queue of tasks of a worker. The owner takes tasks from
+ * the bottom, and other threads steal them from the top. */
+struct pdf_jobs_queue_s
+{
+  pthread_mutex_t lock;
+  struct pdf_jobs_task_s *tasks;
+  pdf_size_t capacity;
+  pdf_size_t top;
+  pdf_size_t count;
+};
+
+struct pdf_jobs_pool_s
+{
+  pthread_mutex_t lock;
+  pthread_cond_t work;
+
+  pdf_bool_t initialized;
+  pdf_bool_t started;
+  pdf_bool_t stop;
+
+  /* Worker threads, and one queue per worker (at least one) */
+  pdf_size_t n_workers;
+  pdf_size_t n_started;
+  pthread_t *threads;
+  pdf_size_t n_queues;
+  struct pdf_jobs_queue_s *queues;
+
+  /* Upper bound of the tasks waiting in the queues */
+  pdf_size_t queued;
+  /* Queue receiving the first task of the next batch */
+  pdf_size_t next_queue;
+};
+
+static struct pdf_jobs_pool_s pool = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .work = PTHREAD_COND_INITIALIZER,
+};
+
+static pdf_bool_t
+queue_push (struct pdf_jobs_queue_s *queue,
+            struct pdf_jobs_task_s  *task)
+{
+  pdf_bool_t pushed = PDF_TRUE;
+
+  pthread_mutex_lock (&queue->lock);
+
+  /* Grow the ring if full, unrolling it in the new array */
+  if (queue->count == queue->capacity)
+    {
+      struct pdf_jobs_task_s *tasks;
+      pdf_size_t i;
+
+      tasks = pdf_alloc (2 * queue->capacity * sizeof (struct pdf_jobs_task_s));
+      if (!tasks)
+        pushed = PDF_FALSE;
+      else
+        {
+          for (i = 0; i < queue->count; i++)
+            tasks[i] = queue->tasks[(queue->top + i) % queue->capacity];
+          pdf_dealloc (queue->tasks);
+          queue->tasks = tasks;
+          queue->capacity *= 2;
+          queue->top = 0;
+        }
+    }
+
+  if (pushed)
+    {
+      queue->tasks[(queue->top + queue->count) % queue->capacity] = *task;
+      queue->count++;
+    }
+
+  pthread_mutex_unlock (&queue->lock);
+  return pushed;
+}
+
+static pdf_bool_t
+queue_pop (struct pdf_jobs_queue_s *queue,
+           pdf_bool_t               bottom,
+           struct pdf_jobs_task_s  *task)
+{
+  pdf_bool_t popped = PDF_FALSE;
+
+  pthread_mutex_lock (&queue->lock);
+
+  if (queue->count > 0)
+    {
+      if (bottom)
+        *task = queue->tasks[(queue->top + queue->count - 1) % queue->capacity];
+      else
+        {
+          *task = queue->tasks[queue->top];
+          queue->top = (queue->top + 1) % queue->capacity;
+        }
+      queue->count--;
+      popped = PDF_TRUE;
+    }
+
+  pthread_mutex_unlock (&queue->lock);
+  return popped;
+}
+
+/* Take a task, first from the given queue and then stealing from the
+ * other ones. Only a worker takes from the bottom of its own queue. */
+static pdf_bool_t
+take_task (pdf_size_t               first,
+           pdf_bool_t               own,
+           struct pdf_jobs_task_s  *task)
+{
+  pdf_size_t i;
+
+  for (i = 0; i < pool.n_queues; i++)
+    {
+      if (queue_pop (&pool.queues[(first + i) % pool.n_queues],
+                     (own && i == 0),
+                     task))
+        {
+          pthread_mutex_lock (&pool.lock);
+          pool.queued--;
+          pthread_mutex_unlock (&pool.lock);
+          return PDF_TRUE;
+        }
+    }
+
+  return PDF_FALSE;
+}
+
+static void
+run_task (struct pdf_jobs_task_s *task)
+{
+  struct pdf_jobs_batch_s *batch = task->batch;
+
+  batch->fn (batch->jobs + task->index * batch->job_size);
+
+  pthread_mutex_lock (&pool.lock);
+  if (--batch->pending == 0)
+    pthread_cond_broadcast (&batch->done);
+  pthread_mutex_unlock (&pool.lock);
+}
+
+static void *
+worker_main (void *arg)
+{
+  pdf_size_t self = (pdf_size_t)arg;
+  struct pdf_jobs_task_s task;
+
+  while (PDF_TRUE)
+    {
+      pdf_bool_t stop;
+
+      if (take_task (self, PDF_TRUE, &task))
+        {
+          run_task (&task);
+          continue;
+        }
+
+      /* Nothing to do, sleep until new tasks are queued */
+      pthread_mutex_lock (&pool.lock);
+      while (pool.queued == 0 && !pool.stop)
+        pthread_cond_wait (&pool.work, &pool.lock);
+      stop = (pool.stop && pool.queued == 0);
+      pthread_mutex_unlock (&pool.lock);
+
+      if (stop)
+        break;
+    }
+
+  return NULL;
+}
+
+/* Start the worker threads. Must be called with the pool lock held. */
+static void
+start_workers (void)
+{
+  pool.started = PDF_TRUE;
+
+  if (pool.n_workers == 0)
+    return;
+
+  pool.threads = pdf_alloc (pool.n_workers * sizeof (pthread_t));
+  if (!pool.threads)
+    return;
+
+  /* If some thread cannot be created, the batches will just be run by
+   * less threads */
+  for (pool.n_started = 0; pool.n_started < pool.n_workers; pool.n_started++)
+    {
+      if (pthread_create (&pool.threads[pool.n_started],
+                          NULL,
+                          worker_main,
+                          (void *)pool.n_started) != 0)
+        break;
+    }
+}
+
+pdf_bool_t
+pdf_jobs_init (pdf_error_t **error)
+{
+  pdf_bool_t ret = PDF_TRUE;
+  long n_cpus;
+  pdf_size_t i;
+
+  pthread_mutex_lock (&pool.lock);
+
+  if (!pool.initialized)
+    {
+      /* One worker less than processors, as the thread submitting a
+       * batch works on it too */
+      n_cpus = sysconf (_SC_NPROCESSORS_ONLN);
+      pool.n_workers = (n_cpus > 1 ? (pdf_size_t)n_cpus - 1 : 0);
+      pool.n_queues = PDF_MAX (pool.n_workers, 1);
+
+      pool.queues = pdf_alloc (pool.n_queues * sizeof (struct pdf_jobs_queue_s));
+      if (!pool.queues)
+        {
+          pdf_set_error (error,
+                         PDF_EDOMAIN_GLOBAL,
+                         PDF_ENOMEM,
+                         "cannot create the job pool: "
+                         "couldn't allocate %lu bytes",
+                         (unsigned long) (pool.n_queues *
+                                          sizeof (struct pdf_jobs_queue_s)));
+          ret = PDF_FALSE;
+        }
+      else
+        {
+          memset (pool.queues, 0, pool.n_queues * sizeof (struct pdf_jobs_queue_s));
+          for (i = 0; i < pool.n_queues && ret; i++)
+            {
+              pthread_mutex_init (&pool.queues[i].lock, NULL);
+              pool.queues[i].capacity = PDF_JOBS_QUEUE_SIZE;
+              pool.queues[i].tasks = pdf_alloc (PDF_JOBS_QUEUE_SIZE *
+                                                sizeof (struct pdf_jobs_task_s));
+              if (!pool.queues[i].tasks)
+                {
+                  pdf_set_error (error,
+                                 PDF_EDOMAIN_GLOBAL,
+                                 PDF_ENOMEM,
+                                 "cannot create the job pool: "
+                                 "couldn't allocate %lu bytes",
+                                 (unsigned long) (PDF_JOBS_QUEUE_SIZE *
+                                                  sizeof (struct pdf_jobs_task_s)));
+                  ret = PDF_FALSE;
+                }
+            }
+
+          if (!ret)
+            {
+              for (i = 0; i < pool.n_queues; i++)
+                {
+                  pthread_mutex_destroy (&pool.queues[i].lock);
+                  pdf_dealloc (pool.queues[i].tasks);
+                }
+              pdf_dealloc (pool.queues);
+              pool.queues = NULL;
+            }
+        }
+
+      pool.initialized = ret;
+    }
+
+  pthread_mutex_unlock (&pool.lock);
+
+  return ret;
+}
+
+void
+pdf_jobs_deinit (void)
+{
+  pdf_size_t i;
+
+  pthread_mutex_lock (&pool.lock);
+  if (!pool.initialized)
+    {
+      pthread_mutex_unlock (&pool.lock);
+      return;
+    }
+  pool.stop = PDF_TRUE;
+  pthread_cond_broadcast (&pool.work);
+  pthread_mutex_unlock (&pool.lock);
+
+  for (i = 0; i < pool.n_started; i++)
+    pthread_join (pool.threads[i], NULL);
+
+  for (i = 0; i < pool.n_queues; i++)
+    {
+      pthread_mutex_destroy (&pool.queues[i].lock);
+      pdf_dealloc (pool.queues[i].tasks);
+    }
+  pdf_dealloc (pool.queues);
+  pdf_dealloc (pool.threads);
+
+  pool.queues = NULL;
+  pool.threads = NULL;
+  pool.n_started = 0;
+  pool.started = PDF_FALSE;
+  pool.stop = PDF_FALSE;
+  pool.initialized = PDF_FALSE;
+}
+
+pdf_size_t
+pdf_jobs_get_concurrency (void)
+{
+  return (pool.initialized ? pool.n_workers + 1 : 1);
+}
+
+pdf_bool_t
+pdf_jobs_run (pdf_jobs_fn_t   fn,
+              void           *jobs,
+              pdf_size_t      job_size,
+              pdf_size_t      n_jobs,
+              pdf_error_t   **error)
+{
+  struct pdf_jobs_batch_s batch;
+  struct pdf_jobs_task_s task;
+  pdf_size_t first;
+  pdf_size_t i;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (fn, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (jobs || n_jobs == 0, PDF_FALSE);
+
+  if (n_jobs == 0)
+    return PDF_TRUE;
+
+  batch.fn = fn;
+  batch.jobs = (pdf_char_t *)jobs;
+  batch.job_size = job_size;
+  batch.pending = n_jobs;
+
+  pthread_mutex_lock (&pool.lock);
+
+  /* Without pool, just run the jobs in this thread */
+  if (!pool.initialized)
+    {
+      pthread_mutex_unlock (&pool.lock);
+      for (i = 0; i < n_jobs; i++)
+        fn (batch.jobs + i * job_size);
+      return PDF_TRUE;
+    }
+
+  if (!pool.started)
+    start_workers ();
+
+  /* Account the tasks before queueing them, so that the counter is
+   * never lower than the number of queued tasks */
+  pool.queued += n_jobs;
+  first = pool.next_queue;
+  pool.next_queue = (first + n_jobs) % pool.n_queues;
+  pthread_cond_init (&batch.done, NULL);
+
+  pthread_mutex_unlock (&pool.lock);
+
+  /* Spread the tasks among the workers */
+  task.batch = &batch;
+  for (i = 0; i < n_jobs; i++)
+    {
+      task.index = i;
+      if (!queue_push (&pool.queues[(first + i) % pool.n_queues], &task))
+        {
+          /* Not enough memory to queue it: do it now */
+          pthread_mutex_lock (&pool.lock);
+          pool.queued--;
+          pthread_mutex_unlock (&pool.lock);
+          run_task (&task);
+        }
+    }
+
+  pthread_mutex_lock (&pool.lock);
+  pthread_cond_broadcast (&pool.work);
+  pthread_mutex_unlock (&pool.lock);
+
+  /* Help while there are tasks waiting in the queues */
+  while (take_task (first, PDF_FALSE, &task))
+    run_task (&task);
+
+  /* And wait for the ones still running in the workers */
+  pthread_mutex_lock (&pool.lock);
+  while (batch.pending > 0)
+    pthread_cond_wait (&batch.done, &pool.lock);
+  pthread_mutex_unlock (&pool.lock);
+
+  pthread_cond_destroy (&batch.done);
+
+  return PDF_TRUE;
+}
+
+/* End of pdf-jobs.c */
@@ -0,0 +1,65 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-jobs.h
+ *       Date:         Sat Oct 17 13:05:11 2026
+ *
+ *       GNU PDF Library - Job pool
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The job pool runs batches of independent jobs in a set of worker
+ * threads shared by the whole library. Each worker owns a queue of
+ * jobs; idle workers steal jobs from the queues of busy ones, and the
+ * thread submitting a batch works on it too until it is finished.
+ *
+ * The worker threads are only started when the first batch is
+ * submitted, so that programs not using the pool (or forking after
+ * pdf_init) don't pay for them. */
+
+#ifndef PDF_JOBS_H
+#define PDF_JOBS_H
+
+#include <config.h>
+
+#include <pdf-types.h>
+#include <pdf-error.h>
+
+/* Function run for each job of a batch */
+typedef void (*pdf_jobs_fn_t) (void *job);
+
+/* Initializes the job pool. Called from pdf_init. */
+pdf_bool_t pdf_jobs_init (pdf_error_t **error);
+
+/* Stops the worker threads, if started. Called from pdf_finish. */
+void pdf_jobs_deinit (void);
+
+/* Number of threads (workers plus the caller) running a batch */
+pdf_size_t pdf_jobs_get_concurrency (void);
+
+/* Run FN on each of the N_JOBS elements, JOB_SIZE octets long, of the
+ * JOBS array, and wait for all of them to finish. */
+pdf_bool_t pdf_jobs_run (pdf_jobs_fn_t   fn,
+                         void           *jobs,
+                         pdf_size_t      job_size,
+                         pdf_size_t      n_jobs,
+                         pdf_error_t   **error);
+
+#endif /* !PDF_JOBS_H */
+
+/* End of pdf-jobs.h */
@@ -90,6 +90,7 @@ pdf_stm_be_new_cfile (FILE         *file,
 
   /* Initialization */
   ((pdf_stm_be_t *)new)->vtable = &stm_be_vtable;
+  ((pdf_stm_be_t *)new)->stats = NULL;
   new->file = file;
   new->pos = pos;
 
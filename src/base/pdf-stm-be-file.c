@@ -42,6 +42,15 @@ struct pdf_stm_be_file_s
   /* Current offset in the file. This offset is only valid within this stream
    * backend object, and may not be equal to the real file offset. */
   pdf_off_t pos;
+
+  /* End of the range of the file the backend works on, or -1 if it
+   * goes up to the end of the file */
+  pdf_off_t end;
+
+  /* Whether the file supports positional reads. In that case reading
+   * never touches the real file offset, so several backends can read
+   * concurrently from the same file object. */
+  pdf_bool_t use_pread;
 };
 
 typedef struct pdf_stm_be_file_s pdf_stm_be_file_t;
@@ -54,18 +63,38 @@ static pdf_ssize_t stm_be_file_write   (pdf_stm_be_t  *be,
                                         pdf_uchar_t   *buffer,
                                         pdf_size_t     bytes,
                                         pdf_error_t  **error);
+static pdf_ssize_t stm_be_file_pread   (pdf_stm_be_t *be,
+                                        pdf_uchar_t  *buffer,
+                                        pdf_size_t    bytes,
+                                        pdf_off_t     pos,
+                                        pdf_error_t **error);
 static pdf_off_t   stm_be_file_seek    (pdf_stm_be_t *be,
                                         pdf_off_t     pos);
 static pdf_off_t   stm_be_file_tell    (pdf_stm_be_t *be);
+static void        stm_be_file_set_range (pdf_stm_be_t *be,
+                                          pdf_off_t     offset,
+                                          pdf_size_t    length);
 static void        stm_be_file_destroy (pdf_stm_be_t *be);
 
 /* Vtable for virtual method implementations */
 static const pdf_stm_be_vtable_t stm_be_vtable = {
-  .read    = stm_be_file_read,
-  .write   = stm_be_file_write,
-  .seek    = stm_be_file_seek,
-  .tell    = stm_be_file_tell,
-  .destroy = stm_be_file_destroy,
+  .read      = stm_be_file_read,
+  .write     = stm_be_file_write,
+  .seek      = stm_be_file_seek,
+  .tell      = stm_be_file_tell,
+  .set_range = stm_be_file_set_range,
+  .destroy   = stm_be_file_destroy,
+};
+
+/* Vtable used when the file supports positional reads */
+static const pdf_stm_be_vtable_t stm_be_vtable_pread = {
+  .read      = stm_be_file_read,
+  .write     = stm_be_file_write,
+  .seek      = stm_be_file_seek,
+  .pread     = stm_be_file_pread,
+  .tell      = stm_be_file_tell,
+  .set_range = stm_be_file_set_range,
+  .destroy   = stm_be_file_destroy,
 };
 
 pdf_stm_be_t *
@@ -89,9 +118,14 @@ pdf_stm_be_new_file (pdf_fsys_file_t  *file,
     }
 
   /* Initialization */
-  ((pdf_stm_be_t *)new)->vtable = &stm_be_vtable;
   new->file = file;
   new->pos = pos;
+  new->end = -1;
+  new->use_pread = pdf_fsys_file_can_pread_p (file);
+  ((pdf_stm_be_t *)new)->vtable = (new->use_pread ?
+                                   &stm_be_vtable_pread :
+                                   &stm_be_vtable);
+  ((pdf_stm_be_t *)new)->stats = NULL;
 
   return (pdf_stm_be_t *)new;
 }
@@ -103,6 +137,20 @@ stm_be_file_destroy (pdf_stm_be_t *be)
   pdf_dealloc (be);
 }
 
+/* Number of the BYTES octets at POS which are in the range of the
+ * backend */
+static pdf_size_t
+stm_be_file_clip (pdf_stm_be_file_t *file_be,
+                  pdf_off_t          pos,
+                  pdf_size_t         bytes)
+{
+  if (file_be->end < 0)
+    return bytes;
+  if (pos >= file_be->end)
+    return 0;
+  return PDF_MIN (bytes, (pdf_size_t)(file_be->end - pos));
+}
+
 static pdf_bool_t
 stm_be_ensure_correct_offset (pdf_stm_be_file_t  *file_be,
                               pdf_error_t       **error)
@@ -124,6 +172,40 @@ stm_be_ensure_correct_offset (pdf_stm_be_file_t  *file_be,
   return PDF_TRUE;
 }
 
+static pdf_ssize_t
+stm_be_file_pread (pdf_stm_be_t  *be,
+                   pdf_uchar_t   *buffer,
+                   pdf_size_t     bytes,
+                   pdf_off_t      pos,
+                   pdf_error_t  **error)
+{
+  pdf_stm_be_file_t *file_be = (pdf_stm_be_file_t *)be;
+  pdf_size_t read_bytes = 0;
+  pdf_error_t *inner_error = NULL;
+
+  /* Nothing is read past the end of the range */
+  bytes = stm_be_file_clip (file_be, pos, bytes);
+
+  /* Note: bytes is unsigned */
+  if (bytes == 0)
+    return (pdf_ssize_t)0;
+
+  if (!pdf_fsys_file_pread (file_be->file,
+                            (pdf_char_t *)buffer,
+                            bytes,
+                            pos,
+                            &read_bytes,
+                            &inner_error) &&
+      inner_error)   /* Make sure EEOF is not treated as an error */
+    {
+      pdf_propagate_error (error, inner_error);
+      pdf_prefix_error (error, "cannot read from file backend: ");
+      return -2;
+    }
+
+  return (pdf_ssize_t)read_bytes;
+}
+
 static pdf_ssize_t
 stm_be_file_read (pdf_stm_be_t  *be,
                   pdf_uchar_t   *buffer,
@@ -134,10 +216,24 @@ stm_be_file_read (pdf_stm_be_t  *be,
   pdf_size_t read_bytes = 0;
   pdf_error_t *inner_error = NULL;
 
+  /* Nothing is read past the end of the range */
+  bytes = stm_be_file_clip (file_be, file_be->pos, bytes);
+
   /* Note: bytes is unsigned */
   if (bytes == 0)
     return (pdf_ssize_t)0;
 
+  /* Positional reads leave the real file offset alone */
+  if (file_be->use_pread)
+    {
+      pdf_ssize_t ret;
+
+      ret = stm_be_file_pread (be, buffer, bytes, file_be->pos, error);
+      if (ret > 0)
+        file_be->pos += ret;
+      return ret;
+    }
+
   /* Ensure we read from the correct offset */
   if (!stm_be_ensure_correct_offset (file_be, error))
     {
@@ -179,6 +275,9 @@ stm_be_file_write (pdf_stm_be_t  *be,
   pdf_stm_be_file_t *file_be = (pdf_stm_be_file_t *)be;
   pdf_size_t written_bytes = 0;
 
+  /* Nothing is written past the end of the range */
+  bytes = stm_be_file_clip (file_be, file_be->pos, bytes);
+
   /* Note: bytes is unsigned */
   if (bytes == 0)
     return (pdf_ssize_t)0;
@@ -226,6 +325,8 @@ stm_be_file_seek (pdf_stm_be_t *be,
   /* Ensure we don't go off limits. */
   if (pos < 0)
     pos = 0;
+  if (file_be->end >= 0 && pos > file_be->end)
+    pos = file_be->end;
   if (pos >= file_size)
     pos = (file_size > 0 ? file_size - 1 : 0);
 
@@ -241,4 +342,15 @@ stm_be_file_tell (pdf_stm_be_t *be)
   return file_be->pos;
 }
 
+static void
+stm_be_file_set_range (pdf_stm_be_t *be,
+                       pdf_off_t     offset,
+                       pdf_size_t    length)
+{
+  pdf_stm_be_file_t *file_be = (pdf_stm_be_file_t *)be;
+
+  file_be->pos = offset;
+  file_be->end = (length > 0 ? offset + (pdf_off_t)length : -1);
+}
+
 /* End of pdf-stm-be-file.c */
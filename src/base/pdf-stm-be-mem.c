@@ -51,6 +51,11 @@ static pdf_ssize_t stm_be_mem_write   (pdf_stm_be_t  *be,
                                        pdf_uchar_t   *buffer,
                                        pdf_size_t     bytes,
                                        pdf_error_t  **error);
+static pdf_ssize_t stm_be_mem_pread   (pdf_stm_be_t *be,
+                                       pdf_uchar_t  *buffer,
+                                       pdf_size_t    bytes,
+                                       pdf_off_t     pos,
+                                       pdf_error_t **error);
 static pdf_off_t   stm_be_mem_seek    (pdf_stm_be_t *be,
                                        pdf_off_t     pos);
 static pdf_off_t   stm_be_mem_tell    (pdf_stm_be_t *be);
@@ -61,6 +66,7 @@ static const pdf_stm_be_vtable_t stm_be_vtable = {
   .read    = stm_be_mem_read,
   .write   = stm_be_mem_write,
   .seek    = stm_be_mem_seek,
+  .pread   = stm_be_mem_pread,
   .tell    = stm_be_mem_tell,
   .destroy = stm_be_mem_destroy,
 };
@@ -88,6 +94,7 @@ pdf_stm_be_new_mem (pdf_uchar_t  *buffer,
 
   /* Initialization */
   ((pdf_stm_be_t *)new)->vtable = &stm_be_vtable;
+  ((pdf_stm_be_t *)new)->stats = NULL;
   new->buffer = buffer;
   new->size = size;
   new->pos = pos;
@@ -95,6 +102,18 @@ pdf_stm_be_new_mem (pdf_uchar_t  *buffer,
   return (pdf_stm_be_t *)new;
 }
 
+void
+pdf_stm_be_mem_set_buffer (pdf_stm_be_t *be,
+                           pdf_uchar_t  *buffer,
+                           pdf_size_t    size)
+{
+  pdf_stm_be_mem_t *mem_be = (pdf_stm_be_mem_t *)be;
+
+  mem_be->buffer = buffer;
+  mem_be->size = size;
+  mem_be->pos = 0;
+}
+
 static void
 stm_be_mem_destroy (pdf_stm_be_t *be)
 {
@@ -136,6 +155,26 @@ stm_be_mem_read (pdf_stm_be_t  *be,
   return (pdf_ssize_t)read_bytes;
 }
 
+static pdf_ssize_t
+stm_be_mem_pread (pdf_stm_be_t  *be,
+                  pdf_uchar_t   *buffer,
+                  pdf_size_t     bytes,
+                  pdf_off_t      pos,
+                  pdf_error_t  **error)
+{
+  pdf_stm_be_mem_t *mem_be = (pdf_stm_be_mem_t *)be;
+  pdf_size_t read_bytes;
+
+  /* Nothing to read outside the buffer */
+  if (pos < 0 || pos >= (pdf_off_t)mem_be->size)
+    return (pdf_ssize_t)0;
+
+  read_bytes = PDF_MIN (bytes, mem_be->size - (pdf_size_t)pos);
+  memcpy (buffer, mem_be->buffer + pos, read_bytes);
+
+  return (pdf_ssize_t)read_bytes;
+}
+
 static pdf_ssize_t
 stm_be_mem_write (pdf_stm_be_t  *be,
                   pdf_uchar_t   *buffer,
@@ -35,6 +35,11 @@ pdf_stm_be_t *pdf_stm_be_new_mem (pdf_uchar_t  *buffer,
                                   pdf_size_t    pos,
                                   pdf_error_t **error);
 
+/* Make the backend work on SIZE octets at BUFFER, from the start */
+void pdf_stm_be_mem_set_buffer (pdf_stm_be_t *be,
+                                pdf_uchar_t  *buffer,
+                                pdf_size_t    size);
+
 #endif /* !PDF_STM_BE_MEM_H */
 
 /* End of pdf-stm-be-mem.h */
@@ -0,0 +1,262 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-be-mmap.c
+ *       Date:         Sat Oct 17 10:14:02 2026
+ *
+ *       GNU PDF Library - Memory-mapped File Stream backend
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+
+#include <pdf-alloc.h>
+#include <pdf-stm-be.h>
+#include <pdf-stm-be-mmap.h>
+
+/* Memory-mapped file backend implementation. The whole file is mapped
+ * read-only when the backend is created, so reading is just copying
+ * from the page cache and seeking is just updating an offset. */
+struct pdf_stm_be_mmap_s
+{
+  struct pdf_stm_be_s parent;
+
+  /* File handler */
+  pdf_fsys_file_t *file;
+
+  /* Mapped contents of the file, NULL if the file is empty */
+  const pdf_uchar_t *data;
+  pdf_size_t size;
+
+  /* Current offset in the file */
+  pdf_off_t pos;
+
+  /* End of the range of the file the backend works on, never past the
+   * end of the mapping */
+  pdf_size_t end;
+};
+
+typedef struct pdf_stm_be_mmap_s pdf_stm_be_mmap_t;
+
+static pdf_ssize_t stm_be_mmap_read    (pdf_stm_be_t *be,
+                                        pdf_uchar_t  *buffer,
+                                        pdf_size_t    bytes,
+                                        pdf_error_t **error);
+static pdf_ssize_t stm_be_mmap_write   (pdf_stm_be_t  *be,
+                                        pdf_uchar_t   *buffer,
+                                        pdf_size_t     bytes,
+                                        pdf_error_t  **error);
+static pdf_ssize_t stm_be_mmap_pread   (pdf_stm_be_t *be,
+                                        pdf_uchar_t  *buffer,
+                                        pdf_size_t    bytes,
+                                        pdf_off_t     pos,
+                                        pdf_error_t **error);
+static pdf_off_t   stm_be_mmap_seek    (pdf_stm_be_t *be,
+                                        pdf_off_t     pos);
+static pdf_off_t   stm_be_mmap_tell    (pdf_stm_be_t *be);
+static void        stm_be_mmap_set_range (pdf_stm_be_t *be,
+                                          pdf_off_t     offset,
+                                          pdf_size_t    length);
+static void        stm_be_mmap_destroy (pdf_stm_be_t *be);
+
+/* Vtable for virtual method implementations */
+static const pdf_stm_be_vtable_t stm_be_vtable = {
+  .read      = stm_be_mmap_read,
+  .write     = stm_be_mmap_write,
+  .seek      = stm_be_mmap_seek,
+  .pread     = stm_be_mmap_pread,
+  .tell      = stm_be_mmap_tell,
+  .set_range = stm_be_mmap_set_range,
+  .destroy   = stm_be_mmap_destroy,
+};
+
+pdf_stm_be_t *
+pdf_stm_be_new_mmap (pdf_fsys_file_t              *file,
+                     pdf_off_t                     pos,
+                     enum pdf_fsys_file_access_e   access,
+                     pdf_error_t                 **error)
+{
+  pdf_stm_be_mmap_t *new;
+  pdf_off_t file_size;
+
+  if (!pdf_fsys_file_can_map_p (file))
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVOP,
+                     "cannot create new mapped file stream object: "
+                     "the filesystem doesn't support mapping files");
+      return NULL;
+    }
+
+  file_size = pdf_fsys_file_get_size (file, error);
+  if (file_size < 0)
+    {
+      pdf_prefix_error (error,
+                        "cannot create new mapped file stream object: ");
+      return NULL;
+    }
+
+  /* Allocate a new structure */
+  new = (pdf_stm_be_mmap_t *) pdf_alloc (sizeof (struct pdf_stm_be_mmap_s));
+  if (!new)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create new mapped file stream object: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) sizeof (struct pdf_stm_be_mmap_s));
+      return NULL;
+    }
+
+  /* Initialization */
+  ((pdf_stm_be_t *)new)->vtable = &stm_be_vtable;
+  ((pdf_stm_be_t *)new)->stats = NULL;
+  new->file = file;
+  new->data = NULL;
+  new->size = (pdf_size_t)file_size;
+  new->pos = pos;
+  new->end = new->size;
+
+  /* Empty files cannot be mapped, and there is nothing to read anyway */
+  if (new->size > 0)
+    {
+      new->data = (const pdf_uchar_t *) pdf_fsys_file_map (file,
+                                                           0,
+                                                           new->size,
+                                                           access,
+                                                           error);
+      if (!new->data)
+        {
+          pdf_prefix_error (error,
+                            "cannot create new mapped file stream object: ");
+          pdf_dealloc (new);
+          return NULL;
+        }
+    }
+
+  return (pdf_stm_be_t *)new;
+}
+
+static void
+stm_be_mmap_destroy (pdf_stm_be_t *be)
+{
+  pdf_stm_be_mmap_t *mmap_be = (pdf_stm_be_mmap_t *)be;
+
+  /* NOTE: We do NOT own the file, only the mapping */
+  if (mmap_be->data)
+    pdf_fsys_file_unmap (mmap_be->file,
+                         (const pdf_char_t *)mmap_be->data,
+                         0,
+                         mmap_be->size);
+  pdf_dealloc (be);
+}
+
+static pdf_ssize_t
+stm_be_mmap_pread (pdf_stm_be_t  *be,
+                   pdf_uchar_t   *buffer,
+                   pdf_size_t     bytes,
+                   pdf_off_t      pos,
+                   pdf_error_t  **error)
+{
+  pdf_stm_be_mmap_t *mmap_be = (pdf_stm_be_mmap_t *)be;
+  pdf_size_t read_bytes;
+
+  /* Nothing to read outside the range */
+  if (pos < 0 || pos >= (pdf_off_t)mmap_be->end)
+    return (pdf_ssize_t)0;
+
+  read_bytes = PDF_MIN (bytes, mmap_be->end - (pdf_size_t)pos);
+  memcpy (buffer, mmap_be->data + pos, read_bytes);
+
+  return (pdf_ssize_t)read_bytes;
+}
+
+static pdf_ssize_t
+stm_be_mmap_read (pdf_stm_be_t  *be,
+                  pdf_uchar_t   *buffer,
+                  pdf_size_t     bytes,
+                  pdf_error_t  **error)
+{
+  pdf_stm_be_mmap_t *mmap_be = (pdf_stm_be_mmap_t *)be;
+  pdf_ssize_t read_bytes;
+
+  read_bytes = stm_be_mmap_pread (be, buffer, bytes, mmap_be->pos, error);
+
+  /* Update the position of the stream */
+  mmap_be->pos += read_bytes;
+
+  return read_bytes;
+}
+
+static pdf_ssize_t
+stm_be_mmap_write (pdf_stm_be_t  *be,
+                   pdf_uchar_t   *buffer,
+                   pdf_size_t     bytes,
+                   pdf_error_t  **error)
+{
+  pdf_set_error (error,
+                 PDF_EDOMAIN_BASE_STM,
+                 PDF_EINVOP,
+                 "cannot write to mapped file backend: the mapping is read-only");
+  return -1;
+}
+
+static pdf_off_t
+stm_be_mmap_seek (pdf_stm_be_t *be,
+                  pdf_off_t     pos)
+{
+  pdf_stm_be_mmap_t *mmap_be = (pdf_stm_be_mmap_t *)be;
+
+  /* Ensure we don't go off limits. */
+  if (pos < 0)
+    pos = 0;
+  if (pos > (pdf_off_t)mmap_be->end)
+    pos = (pdf_off_t)mmap_be->end;
+  if (pos >= (pdf_off_t)mmap_be->size)
+    pos = (mmap_be->size > 0 ? (pdf_off_t)mmap_be->size - 1 : 0);
+
+  mmap_be->pos = pos;
+  return pos;
+}
+
+static pdf_off_t
+stm_be_mmap_tell (pdf_stm_be_t *be)
+{
+  pdf_stm_be_mmap_t *mmap_be = (pdf_stm_be_mmap_t *)be;
+
+  return mmap_be->pos;
+}
+
+static void
+stm_be_mmap_set_range (pdf_stm_be_t *be,
+                       pdf_off_t     offset,
+                       pdf_size_t    length)
+{
+  pdf_stm_be_mmap_t *mmap_be = (pdf_stm_be_mmap_t *)be;
+
+  mmap_be->pos = offset;
+  mmap_be->end = mmap_be->size;
+  if (length > 0 && (pdf_size_t)offset < mmap_be->size)
+    mmap_be->end = PDF_MIN (mmap_be->size, (pdf_size_t)offset + length);
+}
+
+/* End of pdf-stm-be-mmap.c */
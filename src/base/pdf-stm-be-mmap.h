@@ -0,0 +1,41 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-be-mmap.h
+ *       Date:         Sat Oct 17 10:12:40 2026
+ *
+ *       GNU PDF Library - Memory-mapped File Stream backend
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PDF_STM_BE_MMAP_H
+#define PDF_STM_BE_MMAP_H
+
+#include <config.h>
+
+#include <pdf-fsys.h>
+#include <pdf-stm-be.h>
+
+pdf_stm_be_t *pdf_stm_be_new_mmap (pdf_fsys_file_t              *file,
+                                   pdf_off_t                     pos,
+                                   enum pdf_fsys_file_access_e   access,
+                                   pdf_error_t                 **error);
+
+#endif /* !PDF_STM_BE_MMAP_H */
+
+/* End of pdf-stm-be-mmap.h */
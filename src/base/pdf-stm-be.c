@@ -0,0 +1,102 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-be.c
+ *       Date:         Sat Oct 17 18:02:37 2026
+ *
+ *       GNU PDF Library - Stream backend
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <sys/time.h>
+
+#include <pdf-stm-be.h>
+
+pdf_ssize_t
+pdf_stm_be_counted_read (pdf_stm_be_t  *be,
+                         pdf_uchar_t   *buffer,
+                         pdf_size_t     bytes,
+                         pdf_error_t  **error)
+{
+  pdf_u64_t start;
+  pdf_ssize_t read_bytes;
+
+  start = pdf_stm_be_clock ();
+  read_bytes = be->vtable->read (be, buffer, bytes, error);
+  be->stats->usecs += pdf_stm_be_clock () - start;
+
+  be->stats->n_reads++;
+  if (read_bytes > 0)
+    be->stats->read_bytes += read_bytes;
+
+  return read_bytes;
+}
+
+pdf_ssize_t
+pdf_stm_be_counted_write (pdf_stm_be_t  *be,
+                          pdf_uchar_t   *buffer,
+                          pdf_size_t     bytes,
+                          pdf_error_t  **error)
+{
+  pdf_u64_t start;
+  pdf_ssize_t written_bytes;
+
+  start = pdf_stm_be_clock ();
+  written_bytes = be->vtable->write (be, buffer, bytes, error);
+  be->stats->usecs += pdf_stm_be_clock () - start;
+
+  be->stats->n_writes++;
+  if (written_bytes > 0)
+    be->stats->written_bytes += written_bytes;
+
+  return written_bytes;
+}
+
+pdf_ssize_t
+pdf_stm_be_counted_pread (pdf_stm_be_t  *be,
+                          pdf_uchar_t   *buffer,
+                          pdf_size_t     bytes,
+                          pdf_off_t      pos,
+                          pdf_error_t  **error)
+{
+  pdf_u64_t start;
+  pdf_ssize_t read_bytes;
+
+  start = pdf_stm_be_clock ();
+  read_bytes = be->vtable->pread (be, buffer, bytes, pos, error);
+  be->stats->usecs += pdf_stm_be_clock () - start;
+
+  be->stats->n_reads++;
+  if (read_bytes > 0)
+    be->stats->read_bytes += read_bytes;
+
+  return read_bytes;
+}
+
+pdf_u64_t
+pdf_stm_be_clock (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return (pdf_u64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/* End of pdf-stm-be.c */
@@ -47,29 +47,89 @@ typedef struct {
   /* Seek operation in the backend */
   pdf_off_t   (* seek)    (pdf_stm_be_t  *be,
                            pdf_off_t      pos);
+  /* Positional read in the backend, neither using nor modifying the
+   * backend position. Optional, may be NULL. */
+  pdf_ssize_t (* pread)   (pdf_stm_be_t  *be,
+                           pdf_uchar_t   *buffer,
+                           pdf_size_t     bytes,
+                           pdf_off_t      pos,
+                           pdf_error_t  **error);
   /* Tell operation in the backend */
   pdf_off_t   (* tell)    (pdf_stm_be_t  *be);
+  /* Restrict the backend to LENGTH octets from OFFSET, or to the rest
+   * of the medium if LENGTH is 0, and move it to OFFSET. Optional, may
+   * be NULL. */
+  void        (* set_range) (pdf_stm_be_t  *be,
+                             pdf_off_t      offset,
+                             pdf_size_t     length);
   /* Destroy the backend */
   void        (* destroy) (pdf_stm_be_t  *be);
 } pdf_stm_be_vtable_t;
 
+/* Performance counters of a backend */
+struct pdf_stm_be_stats_s
+{
+  pdf_size_t n_reads;
+  pdf_size_t read_bytes;
+  pdf_size_t n_writes;
+  pdf_size_t written_bytes;
+  pdf_u64_t usecs;          /* Time spent reading and writing */
+};
+
 /* Generic struct for the backend, implementations will subclass this */
 struct pdf_stm_be_s
 {
   const pdf_stm_be_vtable_t *vtable;
+  /* Performance counters, or NULL if they are not collected */
+  struct pdf_stm_be_stats_s *stats;
 };
 
-#define pdf_stm_be_read(be,buffer,bytes,error)  \
-  be->vtable->read (be, buffer, bytes, error)
-#define pdf_stm_be_write(be,buffer,bytes,error) \
-  be->vtable->write (be, buffer, bytes, error)
+/* Reads and writes are counted only if the backend has counters */
+#define pdf_stm_be_read(be,buffer,bytes,error)                  \
+  (be->stats ?                                                  \
+   pdf_stm_be_counted_read (be, buffer, bytes, error) :         \
+   be->vtable->read (be, buffer, bytes, error))
+#define pdf_stm_be_write(be,buffer,bytes,error)                 \
+  (be->stats ?                                                  \
+   pdf_stm_be_counted_write (be, buffer, bytes, error) :        \
+   be->vtable->write (be, buffer, bytes, error))
 #define pdf_stm_be_seek(be,pos)                 \
   be->vtable->seek (be, pos)
+#define pdf_stm_be_can_pread_p(be)              \
+  (be->vtable->pread != NULL)
+#define pdf_stm_be_pread(be,buffer,bytes,pos,error)             \
+  (be->stats ?                                                  \
+   pdf_stm_be_counted_pread (be, buffer, bytes, pos, error) :   \
+   be->vtable->pread (be, buffer, bytes, pos, error))
 #define pdf_stm_be_tell(be)                     \
   be->vtable->tell (be)
+#define pdf_stm_be_can_set_range_p(be)          \
+  (be->vtable->set_range != NULL)
+#define pdf_stm_be_set_range(be,offset,length)  \
+  be->vtable->set_range (be, offset, length)
 #define pdf_stm_be_destroy(be)                  \
   be->vtable->destroy (be)
 
+pdf_ssize_t pdf_stm_be_counted_read (pdf_stm_be_t  *be,
+                                     pdf_uchar_t   *buffer,
+                                     pdf_size_t     bytes,
+                                     pdf_error_t  **error);
+
+pdf_ssize_t pdf_stm_be_counted_write (pdf_stm_be_t  *be,
+                                      pdf_uchar_t   *buffer,
+                                      pdf_size_t     bytes,
+                                      pdf_error_t  **error);
+
+pdf_ssize_t pdf_stm_be_counted_pread (pdf_stm_be_t  *be,
+                                      pdf_uchar_t   *buffer,
+                                      pdf_size_t     bytes,
+                                      pdf_off_t      pos,
+                                      pdf_error_t  **error);
+
+/* Clock for the performance counters of the stream layer, in
+ * microseconds */
+pdf_u64_t pdf_stm_be_clock (void);
+
 #endif /* !PDF_STM_BE_H */
 
 /* End of pdf-stm-be.h */
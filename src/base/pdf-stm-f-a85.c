@@ -33,16 +33,18 @@
 #include <pdf-hash.h>
 
 /* Define A85 encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_a85enc_get,
-                       stm_f_a85_init,
-                       stm_f_a85enc_apply,
-                       stm_f_a85_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_a85enc_get,
+                             stm_f_a85_init,
+                             stm_f_a85enc_apply,
+                             stm_f_a85_deinit,
+                             stm_f_a85_reset);
 
 /* Define A85 decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_a85dec_get,
-                       stm_f_a85_init,
-                       stm_f_a85dec_apply,
-                       stm_f_a85_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_a85dec_get,
+                             stm_f_a85_init,
+                             stm_f_a85dec_apply,
+                             stm_f_a85_deinit,
+                             stm_f_a85_reset);
 
 /* If something goes wrong in writing out data, 5 bytes could be leftover */
 #define A85_SPARE_BYTES_LEN 5
@@ -88,10 +90,7 @@ stm_f_a85_init (const pdf_hash_t  *params,
     }
 
   /* Initialization */
-  filter_state->line_length = 0;
-  filter_state->spare_count = 0;
-  filter_state->output_count = 0;
-  filter_state->terminated = PDF_FALSE;
+  stm_f_a85_reset (filter_state, NULL);
 
   *state = (void *) filter_state;
   return PDF_TRUE;
@@ -103,6 +102,20 @@ stm_f_a85_deinit (void *state)
   pdf_dealloc (state);
 }
 
+static pdf_bool_t
+stm_f_a85_reset (void         *state,
+                 pdf_error_t **error)
+{
+  struct pdf_stm_f_a85_s *filter_state = state;
+
+  filter_state->line_length = 0;
+  filter_state->spare_count = 0;
+  filter_state->output_count = 0;
+  filter_state->terminated = PDF_FALSE;
+
+  return PDF_TRUE;
+}
+
 /* pdf_stm_f_a85_write_out helps deal with the possibility of extremely
  * small output buffer sizes - like 1 byte for example.  Since this
  * filter needs to work with 4 to 5 input bytes at a time, and since it
@@ -271,6 +284,80 @@ stm_f_a85enc_wr_tuple (pdf_u32_t     tuple,
   return PDF_OK;
 }
 
+/* Encode whole tuples straight from the input buffer into the output
+ * buffer, while there is room for the largest output of a tuple: five
+ * characters and a newline.  Produces the same output as
+ * stm_f_a85enc_wr_tuple. */
+static void
+a85enc_bulk (struct pdf_stm_f_a85_s *filter_state,
+             pdf_buffer_t           *in,
+             pdf_buffer_t           *out)
+{
+  const pdf_uchar_t *src = in->data + in->rp;
+  const pdf_uchar_t *src_end = in->data + in->wp;
+  pdf_uchar_t *dst = out->data + out->wp;
+  pdf_uchar_t *dst_end = out->data + out->size;
+  pdf_size_t line_length = filter_state->line_length;
+  pdf_uchar_t chars[5];
+  pdf_u32_t tuple;
+  int i;
+
+  while (src_end - src >= 4 &&
+         dst_end - dst >= 6)
+    {
+      tuple = (((pdf_u32_t) src[0] << 24) |
+               ((pdf_u32_t) src[1] << 16) |
+               ((pdf_u32_t) src[2] << 8) |
+               (pdf_u32_t) src[3]);
+      src += 4;
+
+      if (tuple == 0)
+        {
+          *dst++ = 'z';
+          if (++line_length >= A85_ENC_LINE_LENGTH)
+            {
+              *dst++ = '\n';
+              line_length = 0;
+            }
+          continue;
+        }
+
+      /* Divisions by a constant, done with multiplications */
+      chars[4] = (pdf_uchar_t) (tuple % 85) + '!';
+      tuple /= 85;
+      chars[3] = (pdf_uchar_t) (tuple % 85) + '!';
+      tuple /= 85;
+      chars[2] = (pdf_uchar_t) (tuple % 85) + '!';
+      tuple /= 85;
+      chars[1] = (pdf_uchar_t) (tuple % 85) + '!';
+      chars[0] = (pdf_uchar_t) (tuple / 85) + '!';
+
+      if (line_length + 5 < A85_ENC_LINE_LENGTH)
+        {
+          memcpy (dst, chars, 5);
+          dst += 5;
+          line_length += 5;
+        }
+      else
+        {
+          /* The line ends within this tuple */
+          for (i = 0; i < 5; i++)
+            {
+              *dst++ = chars[i];
+              if (++line_length >= A85_ENC_LINE_LENGTH)
+                {
+                  *dst++ = '\n';
+                  line_length = 0;
+                }
+            }
+        }
+    }
+
+  in->rp = src - in->data;
+  out->wp = dst - out->data;
+  filter_state->line_length = line_length;
+}
+
 static pdf_status_t
 a85enc_apply (void         *state,
               pdf_buffer_t *in,
@@ -373,7 +460,9 @@ a85enc_apply (void         *state,
       return retval;
     }
 
-  /* Now do all normal tuples */
+  /* Now do all normal tuples, most of them in bulk */
+
+  a85enc_bulk (filter_state, in, out);
 
   in_size = in->wp - in->rp;
 
@@ -633,6 +722,60 @@ stm_f_a85dec_getnext (pdf_buffer_t *in,
   return retval;
 }
 
+/* Decode runs of complete tuples and 'z' characters straight from the
+ * input buffer into the output buffer.  Stops at anything else, like
+ * whitespace, the EOD marker or invalid tuples, to be handled by
+ * a85dec_apply. */
+static void
+a85dec_bulk (pdf_buffer_t *in,
+             pdf_buffer_t *out)
+{
+  const pdf_uchar_t *src = in->data + in->rp;
+  const pdf_uchar_t *src_end = in->data + in->wp;
+  pdf_uchar_t *dst = out->data + out->wp;
+  pdf_uchar_t *dst_end = out->data + out->size;
+  pdf_u32_t d0, d1, d2, d3, d4;
+  pdf_u64_t quad;
+
+  while (dst_end - dst >= 4 &&
+         src < src_end)
+    {
+      if (*src == 'z')
+        {
+          memset (dst, 0, 4);
+          dst += 4;
+          src++;
+          continue;
+        }
+
+      if (src_end - src < 5)
+        break;
+
+      /* Digits out of range wrap around and are rejected too */
+      d0 = (pdf_u32_t) src[0] - '!';
+      d1 = (pdf_u32_t) src[1] - '!';
+      d2 = (pdf_u32_t) src[2] - '!';
+      d3 = (pdf_u32_t) src[3] - '!';
+      d4 = (pdf_u32_t) src[4] - '!';
+      if ((d0 > 84) | (d1 > 84) | (d2 > 84) | (d3 > 84) | (d4 > 84))
+        break;
+
+      quad = ((((pdf_u64_t) d0 * 85 + d1) * 85 + d2) * 85 + d3) * 85 + d4;
+      if (quad > UINT32_MAX)
+        break;
+
+      dst[0] = (pdf_uchar_t) (quad >> 24);
+      dst[1] = (pdf_uchar_t) (quad >> 16);
+      dst[2] = (pdf_uchar_t) (quad >> 8);
+      dst[3] = (pdf_uchar_t) quad;
+      dst += 4;
+      src += 5;
+    }
+
+  in->rp = src - in->data;
+  out->wp = dst - out->data;
+}
+
 #define A85_INVALID_TERM_IDX 255
 
 static pdf_status_t
@@ -671,6 +814,10 @@ a85dec_apply (void         *state,
       q_idx = 0;
       term_idx = A85_INVALID_TERM_IDX;
 
+      /* Most tuples are decoded in bulk */
+      if (filter_state->spare_count == 0)
+        a85dec_bulk (in, out);
+
       /* First pull any leftover bytes from last _apply(...) and prepend here */
       if (filter_state->spare_count)
         {
@@ -36,35 +36,55 @@
 #include <pdf-stm-f-aesv2.h>
 #include <pdf-hash-helper.h>
 
+#define AESV2_CACHE_SIZE     16
+
 /* Define AESv2 encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_aesv2enc_get,
-                       stm_f_aesv2_init,
-                       stm_f_aesv2enc_apply,
-                       stm_f_aesv2_deinit);
+PDF_STM_FILTER_DEFINE_FULL (pdf_stm_f_aesv2enc_get,
+                            stm_f_aesv2_init,
+                            stm_f_aesv2enc_apply,
+                            stm_f_aesv2_deinit,
+                            stm_f_aesv2_reset,
+                            AESV2_CACHE_SIZE);
 
 /* Define AESv2 decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_aesv2dec_get,
-                       stm_f_aesv2_init,
-                       stm_f_aesv2dec_apply,
-                       stm_f_aesv2_deinit);
+PDF_STM_FILTER_DEFINE_FULL (pdf_stm_f_aesv2dec_get,
+                            stm_f_aesv2_init,
+                            stm_f_aesv2dec_apply,
+                            stm_f_aesv2_deinit,
+                            stm_f_aesv2_reset,
+                            AESV2_CACHE_SIZE);
+
+/* Define AESv3 encoder and decoder, which only differ from the AESv2
+ * ones in the size of the key */
+PDF_STM_FILTER_DEFINE_FULL (pdf_stm_f_aesv3enc_get,
+                            stm_f_aesv3_init,
+                            stm_f_aesv2enc_apply,
+                            stm_f_aesv2_deinit,
+                            stm_f_aesv2_reset,
+                            AESV2_CACHE_SIZE);
+
+PDF_STM_FILTER_DEFINE_FULL (pdf_stm_f_aesv3dec_get,
+                            stm_f_aesv3_init,
+                            stm_f_aesv2dec_apply,
+                            stm_f_aesv2_deinit,
+                            stm_f_aesv2_reset,
+                            AESV2_CACHE_SIZE);
 
-#define AESV2_CACHE_SIZE     16
 #define AESv2_PARAM_KEY      "Key"
 #define AESv2_PARAM_KEY_SIZE "KeySize"
 
-/* Encryption and decryption  */
-typedef enum {
-    PDF_STM_F_AESV2_MODE_ENCODE,
-    PDF_STM_F_AESV2_MODE_DECODE
-} pdf_stm_f_aesv2_mode_e;
-
 /* Internal state */
 struct pdf_stm_f_aesv2_s
 {
   pdf_crypt_cipher_t *cipher;
 
+  /* Partial block of the input, and block of the output not written
+   * yet */
   pdf_buffer_t *in_cache;
   pdf_buffer_t *out_cache;
+  pdf_bool_t padded;      /* The last block was padded (encoder) */
+  pdf_bool_t held;        /* OUT_CACHE holds the last block decrypted
+                           * so far, which may be padded (decoder) */
 
   pdf_char_t *key;
   pdf_size_t keysize;
@@ -73,9 +93,10 @@ struct pdf_stm_f_aesv2_s
 /* Common implementation */
 
 static pdf_bool_t
-stm_f_aesv2_init (const pdf_hash_t  *params,
-                  void             **state,
-                  pdf_error_t      **error)
+stm_f_aes_init (const pdf_hash_t               *params,
+                enum pdf_crypt_cipher_algo_e    algorithm,
+                void                          **state,
+                pdf_error_t                   **error)
 {
   struct pdf_stm_f_aesv2_s *filter_state;
   const pdf_char_t *key;
@@ -124,6 +145,9 @@ stm_f_aesv2_init (const pdf_hash_t  *params,
       return PDF_FALSE;
     }
 
+  filter_state->padded = PDF_FALSE;
+  filter_state->held = PDF_FALSE;
+
   /* Note that Key may NOT be NUL-terminated */
   key = pdf_hash_get_value (params, AESv2_PARAM_KEY);
   keysize = pdf_hash_get_size (params, AESv2_PARAM_KEY_SIZE);
@@ -144,7 +168,7 @@ stm_f_aesv2_init (const pdf_hash_t  *params,
   filter_state->keysize = keysize;
   memcpy (filter_state->key, key, keysize);
 
-  filter_state->cipher = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_AESV2, error);
+  filter_state->cipher = pdf_crypt_cipher_new (algorithm, error);
   if (!filter_state->cipher)
     {
       stm_f_aesv2_deinit (filter_state);
@@ -164,6 +188,22 @@ stm_f_aesv2_init (const pdf_hash_t  *params,
   return PDF_TRUE;
 }
 
+static pdf_bool_t
+stm_f_aesv2_init (const pdf_hash_t  *params,
+                  void             **state,
+                  pdf_error_t      **error)
+{
+  return stm_f_aes_init (params, PDF_CRYPT_CIPHER_ALGO_AESV2, state, error);
+}
+
+static pdf_bool_t
+stm_f_aesv3_init (const pdf_hash_t  *params,
+                  void             **state,
+                  pdf_error_t      **error)
+{
+  return stm_f_aes_init (params, PDF_CRYPT_CIPHER_ALGO_AESV3, state, error);
+}
+
 static void
 stm_f_aesv2_deinit (void *state)
 {
@@ -180,202 +220,241 @@ stm_f_aesv2_deinit (void *state)
   pdf_dealloc (state);
 }
 
+static pdf_bool_t
+stm_f_aesv2_reset (void         *state,
+                   pdf_error_t **error)
+{
+  struct pdf_stm_f_aesv2_s *filter_state = state;
+
+  /* The cipher generates (encoder) or expects (decoder) a new IV */
+  pdf_crypt_cipher_reset (filter_state->cipher);
+  pdf_buffer_rewind (filter_state->in_cache);
+  pdf_buffer_rewind (filter_state->out_cache);
+  filter_state->padded = PDF_FALSE;
+  filter_state->held = PDF_FALSE;
+
+  return PDF_TRUE;
+}
+
+/* Write out what is left of OUT_CACHE.  Returns PDF_TRUE if it's
+ * empty. */
+static pdf_bool_t
+stm_f_aesv2_flush (pdf_buffer_t *out_cache,
+                   pdf_buffer_t *out)
+{
+  pdf_size_t bytes_to_write;
+
+  bytes_to_write = PDF_MIN (out->size - out->wp,
+                            out_cache->wp - out_cache->rp);
+  memcpy (out->data + out->wp,
+          out_cache->data + out_cache->rp,
+          bytes_to_write);
+  out_cache->rp += bytes_to_write;
+  out->wp += bytes_to_write;
+
+  if (!pdf_buffer_eob_p (out_cache))
+    return PDF_FALSE;
+  pdf_buffer_rewind (out_cache);
+  return PDF_TRUE;
+}
+
+/* Fill IN_CACHE with the start of IN.  Returns PDF_TRUE if it holds a
+ * whole block. */
+static pdf_bool_t
+stm_f_aesv2_fill (pdf_buffer_t *in_cache,
+                  pdf_buffer_t *in)
+{
+  pdf_size_t bytes_to_read;
+
+  bytes_to_read = PDF_MIN (in->wp - in->rp,
+                           in_cache->size - in_cache->wp);
+  memcpy (in_cache->data + in_cache->wp,
+          in->data + in->rp,
+          bytes_to_read);
+  in_cache->wp += bytes_to_read;
+  in->rp += bytes_to_read;
+
+  return pdf_buffer_full_p (in_cache);
+}
+
+/* Encode filter */
+
 static enum pdf_stm_filter_apply_status_e
-stm_f_aesv2_apply (pdf_stm_f_aesv2_mode_e   mode,
-                   void                    *state,
-                   pdf_buffer_t            *in,
-                   pdf_buffer_t            *out,
-                   pdf_bool_t               finish,
-                   pdf_error_t            **error)
+stm_f_aesv2enc_apply (void          *state,
+                      pdf_buffer_t  *in,
+                      pdf_buffer_t  *out,
+                      pdf_bool_t     finish,
+                      pdf_error_t  **error)
 {
   struct pdf_stm_f_aesv2_s *filter_state = state;
   pdf_crypt_cipher_t *cipher = filter_state->cipher;
   pdf_buffer_t *in_cache = filter_state->in_cache;
   pdf_buffer_t *out_cache = filter_state->out_cache;
+  pdf_size_t bytes;
+
+  PDF_ASSERT (in->wp >= in->rp);
+  PDF_ASSERT (out->size >= out->wp);
 
   while (PDF_TRUE)
     {
-      pdf_size_t in_size;
-      pdf_size_t out_size;
-      pdf_size_t in_cache_size;
-      pdf_size_t out_cache_size;
-      pdf_size_t bytes_to_read;
-      pdf_size_t bytes_to_write;
-
-      PDF_ASSERT (in->wp >= in->rp);
-      PDF_ASSERT (out->size >= out->wp);
-
-      /* TODO: Shouldn't this be like this?
-       *   in_size = in->size - in->rp;
-       */
-      in_size = in->wp - in->rp;
-      in_cache_size = in_cache->size - in_cache->wp;
-      bytes_to_read = PDF_MIN (in_size, in_cache_size);
-
-      /* Read bytes from IN and fill IN_CACHE */
-      memcpy (in_cache->data + in_cache->wp,
-              in->data       + in->rp,
-              bytes_to_read);
-
-      in_cache->wp += bytes_to_read;
-      in->rp       += bytes_to_read;
-
-      /* If we cannot fill all IN_CACHE... */
-      if (!pdf_buffer_full_p (in_cache))
+      if (!stm_f_aesv2_flush (out_cache, out))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+
+      /* Encrypt as many whole blocks as fit in OUT at once, straight
+       * from IN */
+      bytes = PDF_MIN (in->wp - in->rp, out->size - out->wp);
+      bytes -= bytes % AESV2_CACHE_SIZE;
+      if (in_cache->wp == 0 && bytes > 0)
         {
-          if (finish &&
-              mode == PDF_STM_F_AESV2_MODE_DECODE &&
-              in_cache->wp > 0)
-            {
-              /* TODO: Better error explanation */
-              pdf_set_error (error,
-                             PDF_EDOMAIN_BASE_STM,
-                             PDF_ERROR,
-                             "");
-              return PDF_STM_FILTER_APPLY_STATUS_ERROR;
-            }
+          if (!pdf_crypt_cipher_encrypt (cipher,
+                                         (pdf_char_t *)out->data + out->wp,
+                                         bytes,
+                                         (const pdf_char_t *)in->data + in->rp,
+                                         bytes,
+                                         NULL,
+                                         error))
+            return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+          in->rp += bytes;
+          out->wp += bytes;
+          continue;
+        }
 
-          /* ...pad the cache if we have reached EOD */
-          if (finish &&
-              mode == PDF_STM_F_AESV2_MODE_ENCODE &&
-              !pdf_buffer_full_p (in_cache))
-            {
-              pdf_size_t padding;
+      /* Otherwise go through the caches: for a block split across
+       * calls, a block which doesn't fit in OUT, or the padded last
+       * block */
+      if (!stm_f_aesv2_fill (in_cache, in))
+        {
+          if (!finish)
+            return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+          if (filter_state->padded)
+            return PDF_STM_FILTER_APPLY_STATUS_EOF;
 
-              padding = in_cache->size - in_cache->wp;
-              memset (in_cache->data + in_cache->wp,
-                      padding,
-                      padding);
+          bytes = in_cache->size - in_cache->wp;
+          memset (in_cache->data + in_cache->wp, bytes, bytes);
+          in_cache->wp += bytes;
+          filter_state->padded = PDF_TRUE;
+        }
 
-              in_cache->wp += padding;
-            }
-          else
-            {
-              if (pdf_buffer_eob_p (out_cache))
-                return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT; /* ...ask more input */
-            }
+      if (!pdf_crypt_cipher_encrypt (cipher,
+                                     (pdf_char_t *)out_cache->data,
+                                     out_cache->size,
+                                     (const pdf_char_t *)in_cache->data,
+                                     in_cache->size,
+                                     NULL,
+                                     error))
+        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+      pdf_buffer_rewind (in_cache);
+      out_cache->wp = out_cache->size;
+    }
+}
+
+/* Decode filter  */
+
+static enum pdf_stm_filter_apply_status_e
+stm_f_aesv2dec_apply (void          *state,
+                      pdf_buffer_t  *in,
+                      pdf_buffer_t  *out,
+                      pdf_bool_t     finish,
+                      pdf_error_t  **error)
+{
+  struct pdf_stm_f_aesv2_s *filter_state = state;
+  pdf_crypt_cipher_t *cipher = filter_state->cipher;
+  pdf_buffer_t *in_cache = filter_state->in_cache;
+  pdf_buffer_t *out_cache = filter_state->out_cache;
+  pdf_size_t bytes;
+
+  PDF_ASSERT (in->wp >= in->rp);
+  PDF_ASSERT (out->size >= out->wp);
+
+  while (PDF_TRUE)
+    {
+      if (!filter_state->held &&
+          !stm_f_aesv2_flush (out_cache, out))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+
+      /* The last block decrypted isn't padded if more blocks follow */
+      if (filter_state->held &&
+          (in_cache->wp + in->wp - in->rp >= in_cache->size))
+        {
+          filter_state->held = PDF_FALSE;
+          continue;
         }
 
-      /* If OUT_CACHE is empty and IN_CACHE is full, then it is ready
-       * to be processed. */
-      if (pdf_buffer_full_p (in_cache) &&
-          pdf_buffer_eob_p (out_cache))
+      /* Decrypt as many whole blocks as fit in OUT at once, straight
+       * from IN, but the last one if nothing follows it */
+      bytes = in->wp - in->rp;
+      if (!filter_state->held && in_cache->wp == 0 && bytes > 0)
         {
-          switch (mode)
+          bytes = PDF_MIN (bytes - 1, out->size - out->wp);
+          bytes -= bytes % AESV2_CACHE_SIZE;
+          if (bytes > 0)
             {
-            case PDF_STM_F_AESV2_MODE_ENCODE:
-              if (!pdf_crypt_cipher_encrypt (cipher,
-                                             (pdf_char_t *)out_cache->data,
-                                             out_cache->size,
-                                             (const pdf_char_t *)in_cache->data,
-                                             in_cache->size,
-                                             NULL,
-                                             error))
-                return PDF_STM_FILTER_APPLY_STATUS_ERROR;
-              break;
-
-            case PDF_STM_F_AESV2_MODE_DECODE:
               if (!pdf_crypt_cipher_decrypt (cipher,
-                                             (pdf_char_t *)out_cache->data,
-                                             out_cache->size,
-                                             (const pdf_char_t *)in_cache->data,
-                                             in_cache->size,
+                                             (pdf_char_t *)out->data + out->wp,
+                                             bytes,
+                                             (const pdf_char_t *)in->data + in->rp,
+                                             bytes,
                                              NULL,
                                              error))
                 return PDF_STM_FILTER_APPLY_STATUS_ERROR;
-              break;
+              in->rp += bytes;
+              out->wp += bytes;
+              continue;
             }
+        }
 
-          /* Both cache are full now */
+      /* Otherwise decrypt the next block into OUT_CACHE and hold it
+       * until we know whether it's the last one.  IN can't complete a
+       * block while another one is held. */
+      if (stm_f_aesv2_fill (in_cache, in))
+        {
+          PDF_ASSERT (!filter_state->held);
+
+          if (!pdf_crypt_cipher_decrypt (cipher,
+                                         (pdf_char_t *)out_cache->data,
+                                         out_cache->size,
+                                         (const pdf_char_t *)in_cache->data,
+                                         in_cache->size,
+                                         NULL,
+                                         error))
+            return PDF_STM_FILTER_APPLY_STATUS_ERROR;
           pdf_buffer_rewind (in_cache);
+          out_cache->rp = 0;
           out_cache->wp = out_cache->size;
+          filter_state->held = PDF_TRUE;
+          continue;
         }
 
-      /* When we are decrypting data, we need know what block is the
-       * last. If both IN and IN_CACHE are empty, then OUT_CACHE could
-       * hold it. So, we ask more input to we make sure.*/
-      if (mode == PDF_STM_F_AESV2_MODE_DECODE &&
-          pdf_buffer_eob_p (in) &&
-          pdf_buffer_eob_p (in_cache))
+      if (!finish)
+        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+
+      if (in_cache->wp > 0)
         {
-          /* When we know it is the last, remove the padding. */
-          if (finish)
-            {
-              pdf_size_t padding;
-
-              padding = out_cache->data[out_cache->size - 1];
-              if (padding > AESV2_CACHE_SIZE)
-                {
-                  pdf_set_error (error,
-                                 PDF_EDOMAIN_BASE_STM,
-                                 PDF_ERROR,
-                                 "Padding longer than AESv2 cache (%lu > %lu)",
-                                 (unsigned long)padding,
-                                 (unsigned long)AESV2_CACHE_SIZE);
-                  return PDF_STM_FILTER_APPLY_STATUS_ERROR;
-                }
-
-              out_cache->wp = out_cache->size - padding;
-            }
-          else /* Ask for more input */
-            return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_ERROR,
+                         "AESv2 encrypted data not made of whole blocks");
+          return PDF_STM_FILTER_APPLY_STATUS_ERROR;
         }
 
-      /* Finally, we fill the OUT buffer */
-      out_size = out->size - out->wp;
-      out_cache_size = out_cache->wp - out_cache->rp;
-      bytes_to_write = PDF_MIN (out_size, out_cache_size);
-
-      memcpy (out->data + out->wp,
-              out_cache->data + out_cache->rp,
-              bytes_to_write);
-
-      out_cache->rp += bytes_to_write;
-      out->wp       += bytes_to_write;
-
-      if (finish)
+      if (!filter_state->held)
         return PDF_STM_FILTER_APPLY_STATUS_EOF;
 
-      if (pdf_buffer_full_p (out))
-        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-
-      /* Continue loop */
-      pdf_buffer_rewind (out_cache);
+      /* Remove the padding of the last block */
+      bytes = out_cache->data[out_cache->size - 1];
+      if (bytes > AESV2_CACHE_SIZE)
+        {
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_ERROR,
+                         "Padding longer than AESv2 cache (%lu > %lu)",
+                         (unsigned long)bytes,
+                         (unsigned long)AESV2_CACHE_SIZE);
+          return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+        }
+      out_cache->wp = out_cache->size - bytes;
+      filter_state->held = PDF_FALSE;
     }
 }
 
-/* Encode filter */
-
-static enum pdf_stm_filter_apply_status_e
-stm_f_aesv2enc_apply (void          *state,
-                      pdf_buffer_t  *in,
-                      pdf_buffer_t  *out,
-                      pdf_bool_t     finish,
-                      pdf_error_t  **error)
-{
-  return stm_f_aesv2_apply (PDF_STM_F_AESV2_MODE_ENCODE,
-                            state,
-                            in,
-                            out,
-                            finish,
-                            error);
-}
-
-/* Decode filter  */
-
-static enum pdf_stm_filter_apply_status_e
-stm_f_aesv2dec_apply (void          *state,
-                      pdf_buffer_t  *in,
-                      pdf_buffer_t  *out,
-                      pdf_bool_t     finish,
-                      pdf_error_t  **error)
-{
-  return stm_f_aesv2_apply (PDF_STM_F_AESV2_MODE_DECODE,
-                            state,
-                            in,
-                            out,
-                            finish,
-                            error);
-}
-
 /* End of pdf_stm_f_aesv2.c */
@@ -34,6 +34,10 @@ const pdf_stm_filter_impl_t *pdf_stm_f_aesv2dec_get (void);
 
 const pdf_stm_filter_impl_t *pdf_stm_f_aesv2enc_get (void);
 
+const pdf_stm_filter_impl_t *pdf_stm_f_aesv3dec_get (void);
+
+const pdf_stm_filter_impl_t *pdf_stm_f_aesv3enc_get (void);
+
 #endif /* PDF_STM_F_AESV2_H */
 
 /* End of pdf_stm_f_aesv2.h */
@@ -30,25 +30,54 @@
 #include <pdf-hash.h>
 #include <pdf-stm-f-ahex.h>
 
+/* SSE2 is always there in x86-64, while AVX2 is only used if the CPU
+ * running the library supports it */
+#if defined __SSE2__
+# include <emmintrin.h>
+# define AHEX_SSE2 1
+#endif /* __SSE2__ */
+#if defined AHEX_SSE2 && defined __x86_64__ \
+  && (defined __clang__ || (defined __GNUC__ && __GNUC__ >= 5))
+# include <immintrin.h>
+# define AHEX_AVX2 1
+#endif
+
 /* Define AHEX encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_ahexenc_get,
-                       stm_f_ahex_init,
-                       stm_f_ahexenc_apply,
-                       stm_f_ahex_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_ahexenc_get,
+                             stm_f_ahex_init,
+                             stm_f_ahexenc_apply,
+                             stm_f_ahex_deinit,
+                             stm_f_ahex_reset);
 
 /* Define AHEX decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_ahexdec_get,
-                       stm_f_ahex_init,
-                       stm_f_ahexdec_apply,
-                       stm_f_ahex_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_ahexdec_get,
+                             stm_f_ahex_init,
+                             stm_f_ahexdec_apply,
+                             stm_f_ahex_deinit,
+                             stm_f_ahex_reset);
 
 #define PDF_STM_F_AHEX_LINE_WIDTH 60
 
+/* Bulk kernels, run while neither the input nor the output can get
+ * exhausted, and the filter state can't change.  The decoder kernels
+ * pair the hex digits across white characters, and stop at the first
+ * other character, leaving an unpaired digit for the filter.  They
+ * return the number of decoded bytes, and set IN_USED to the number
+ * of characters used. */
+
+typedef pdf_size_t (*ahex_decode_fn_t) (const pdf_uchar_t *in,
+                                        pdf_size_t         in_size,
+                                        pdf_size_t        *in_used,
+                                        pdf_uchar_t       *out,
+                                        pdf_size_t         out_size);
+
 /* Internal state, same for encoder and decoder */
 struct pdf_stm_f_ahex_s
 {
   pdf_i32_t last_nibble;
   pdf_size_t written_bytes;
+  /* Decoder kernel, selected for the running CPU */
+  ahex_decode_fn_t decode_fn;
 };
 
 static pdf_u32_t pdf_stm_f_ahex_white_p (pdf_u32_t hex);
@@ -59,6 +88,24 @@ static pdf_u32_t pdf_stm_f_ahex_hex2int (pdf_u32_t hex);
 
 static pdf_uchar_t pdf_stm_f_ahex_int2hex (pdf_u32_t n);
 
+static void ahex_encode (const pdf_uchar_t *in,
+                         pdf_size_t         in_size,
+                         pdf_uchar_t       *out);
+
+static pdf_size_t ahex_decode (const pdf_uchar_t *in,
+                               pdf_size_t         in_size,
+                               pdf_size_t        *in_used,
+                               pdf_uchar_t       *out,
+                               pdf_size_t         out_size);
+
+#if defined AHEX_AVX2
+static pdf_size_t ahex_decode_avx2 (const pdf_uchar_t *in,
+                                    pdf_size_t         in_size,
+                                    pdf_size_t        *in_used,
+                                    pdf_uchar_t       *out,
+                                    pdf_size_t         out_size);
+#endif /* AHEX_AVX2 */
+
 /* Common implementation */
 
 static pdf_bool_t
@@ -83,8 +130,16 @@ stm_f_ahex_init (const pdf_hash_t  *params,
     }
 
   /* Initialize fields */
-  filter_state->last_nibble = -1;
-  filter_state->written_bytes = 0;
+  stm_f_ahex_reset (filter_state, NULL);
+
+  /* Each filter keeps its own kernel, so that no state is shared
+   * between threads */
+#if defined AHEX_AVX2
+  if (__builtin_cpu_supports ("avx2"))
+    filter_state->decode_fn = ahex_decode_avx2;
+  else
+#endif /* AHEX_AVX2 */
+    filter_state->decode_fn = ahex_decode;
 
   *state = (void *)filter_state;
 
@@ -97,6 +152,18 @@ stm_f_ahex_deinit (void *state)
   pdf_dealloc (state);
 }
 
+static pdf_bool_t
+stm_f_ahex_reset (void         *state,
+                  pdf_error_t **error)
+{
+  struct pdf_stm_f_ahex_s *filter_state = state;
+
+  filter_state->last_nibble = -1;
+  filter_state->written_bytes = 0;
+
+  return PDF_TRUE;
+}
+
 /* Encoder implementation */
 
 static enum pdf_stm_filter_apply_status_e
@@ -121,6 +188,33 @@ stm_f_ahexenc_apply (void          *state,
 
   filter_state = (struct pdf_stm_f_ahex_s *) state;
 
+  /* Encode whole runs of the current line, while no nibble is
+   * pending */
+  while (filter_state->last_nibble == -1)
+    {
+      pdf_size_t n;
+
+      if (filter_state->written_bytes == PDF_STM_F_AHEX_LINE_WIDTH)
+        {
+          if (pdf_buffer_full_p (out))
+            break;
+          out->data[out->wp++] = '\n';
+          filter_state->written_bytes = 0;
+        }
+
+      n = PDF_MIN (in->wp - in->rp,
+                   PDF_MIN (PDF_STM_F_AHEX_LINE_WIDTH
+                            - filter_state->written_bytes,
+                            out->size - out->wp) / 2);
+      if (n == 0)
+        break;
+
+      ahex_encode (in->data + in->rp, n, out->data + out->wp);
+      in->rp += n;
+      out->wp += 2 * n;
+      filter_state->written_bytes += 2 * n;
+    }
+
   while (!pdf_buffer_full_p (out))
     {
       if ((filter_state->written_bytes != 0) &&
@@ -215,6 +309,23 @@ stm_f_ahexdec_apply (void          *state,
           break;
         }
 
+      /* Decode runs of hex digits in bulk */
+      if (filter_state->last_nibble == -1)
+        {
+          pdf_size_t n;
+          pdf_size_t used;
+
+          n = filter_state->decode_fn (in->data + in->rp,
+                                       in->wp - in->rp,
+                                       &used,
+                                       out->data + out->wp,
+                                       out->size - out->wp);
+          in->rp += used;
+          out->wp += n;
+          if (used > 0)
+            continue;
+        }
+
       /* Skip white characters */
       if (pdf_stm_f_ahex_white_p ((pdf_u32_t) in->data[in->rp]))
         {
@@ -335,4 +446,362 @@ pdf_stm_f_ahex_hex2int (pdf_u32_t hex)
   return -1;
 }
 
+/* Bulk kernels */
+
+/* Value of every hex digit, AHEX_WHITE for the white characters and
+ * AHEX_NOT_HEX for any other character */
+#define AHEX_NOT_HEX 0xff
+#define AHEX_WHITE   0xfe
+
+static const pdf_uchar_t hex_values[256] = {
+#define X AHEX_NOT_HEX
+#define W AHEX_WHITE
+  W, X, X, X, X, X, X, X, X, W, W, X, W, W, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  W, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, X, X, X, X, X, X,
+  X, 10, 11, 12, 13, 14, 15, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, 10, 11, 12, 13, 14, 15, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X,
+  X, X, X, X, X, X, X, X, X, X, X, X, X, X, X, X
+#undef W
+#undef X
+};
+
+/* Scalar decoding of the pairs of hex digits not handled by the vector
+ * kernels */
+static pdf_size_t
+ahex_decode_tail (const pdf_uchar_t *in,
+                  pdf_size_t         in_size,
+                  pdf_size_t        *in_used,
+                  pdf_uchar_t       *out,
+                  pdf_size_t         out_size)
+{
+  pdf_size_t n = 0;
+  pdf_size_t i = 0;
+  pdf_size_t j;
+
+  while (n < out_size)
+    {
+      /* Skip white characters up to the first digit... */
+      while (i < in_size && hex_values[in[i]] == AHEX_WHITE)
+        i++;
+      if (i == in_size || hex_values[in[i]] == AHEX_NOT_HEX)
+        break;
+
+      /* ...and up to the second one */
+      j = i + 1;
+      while (j < in_size && hex_values[in[j]] == AHEX_WHITE)
+        j++;
+      if (j == in_size || hex_values[in[j]] == AHEX_NOT_HEX)
+        break;
+
+      out[n++] = (hex_values[in[i]] << 4) | hex_values[in[j]];
+      i = j + 1;
+    }
+
+  *in_used = i;
+  return n;
+}
+
+#if defined AHEX_SSE2
+
+/* Decode the pairs of hex digits of a block of WIDTH hex digits and
+ * white characters, given the mask of the digits.  An unpaired digit
+ * is left for the next block.  Returns the number of characters
+ * used. */
+static inline pdf_size_t
+ahex_decode_mixed (const pdf_uchar_t *in,
+                   pdf_u32_t          hex_mask,
+                   pdf_size_t         width,
+                   pdf_uchar_t       *out,
+                   pdf_size_t        *n)
+{
+  int hi;
+  int lo;
+
+  while (hex_mask & (hex_mask - 1))
+    {
+      hi = __builtin_ctz (hex_mask);
+      hex_mask &= hex_mask - 1;
+      lo = __builtin_ctz (hex_mask);
+      hex_mask &= hex_mask - 1;
+      out[(*n)++] = (hex_values[in[hi]] << 4) | hex_values[in[lo]];
+    }
+
+  return hex_mask ? __builtin_ctz (hex_mask) : width;
+}
+
+#endif /* AHEX_SSE2 */
+
+#if defined AHEX_SSE2
+
+/* Values of 16 hex digits, and the mask of the characters being hex
+ * digits */
+static inline __m128i
+ahex_values_sse2 (__m128i chars,
+                  int    *mask)
+{
+  __m128i digits;
+  __m128i letters;
+  __m128i digit_p;
+  __m128i letter_p;
+
+  /* Unsigned range checks, done as MIN (x, bound) == x */
+  digits = _mm_sub_epi8 (chars, _mm_set1_epi8 ('0'));
+  letters = _mm_sub_epi8 (_mm_or_si128 (chars, _mm_set1_epi8 (0x20)),
+                          _mm_set1_epi8 ('a'));
+  digit_p = _mm_cmpeq_epi8 (_mm_min_epu8 (digits, _mm_set1_epi8 (9)),
+                            digits);
+  letter_p = _mm_cmpeq_epi8 (_mm_min_epu8 (letters, _mm_set1_epi8 (5)),
+                             letters);
+
+  *mask = _mm_movemask_epi8 (_mm_or_si128 (digit_p, letter_p));
+  return _mm_or_si128 (_mm_and_si128 (digit_p, digits),
+                       _mm_and_si128 (letter_p,
+                                      _mm_add_epi8 (letters,
+                                                    _mm_set1_epi8 (10))));
+}
+
+/* Mask of the white characters among 16 ones */
+static inline int
+ahex_white_mask_sse2 (__m128i chars)
+{
+  __m128i white;
+
+  white = _mm_cmpeq_epi8 (chars, _mm_setzero_si128 ());
+  white = _mm_or_si128 (white, _mm_cmpeq_epi8 (chars, _mm_set1_epi8 ('\t')));
+  white = _mm_or_si128 (white, _mm_cmpeq_epi8 (chars, _mm_set1_epi8 ('\n')));
+  white = _mm_or_si128 (white, _mm_cmpeq_epi8 (chars, _mm_set1_epi8 ('\f')));
+  white = _mm_or_si128 (white, _mm_cmpeq_epi8 (chars, _mm_set1_epi8 ('\r')));
+  white = _mm_or_si128 (white, _mm_cmpeq_epi8 (chars, _mm_set1_epi8 (' ')));
+  return _mm_movemask_epi8 (white);
+}
+
+static pdf_size_t
+ahex_decode (const pdf_uchar_t *in,
+             pdf_size_t         in_size,
+             pdf_size_t        *in_used,
+             pdf_uchar_t       *out,
+             pdf_size_t         out_size)
+{
+  const pdf_uchar_t *start = in;
+  pdf_size_t n = 0;
+  pdf_size_t used;
+  __m128i chars;
+  __m128i values;
+  __m128i bytes;
+  int mask;
+
+  while (in_size >= 16 && out_size - n >= 8)
+    {
+      chars = _mm_loadu_si128 ((const __m128i *) in);
+      values = ahex_values_sse2 (chars, &mask);
+      if (mask != 0xffff)
+        {
+          /* Pair the digits across the white characters, and stop at
+           * any other character */
+          if ((mask | ahex_white_mask_sse2 (chars)) != 0xffff)
+            break;
+
+          used = ahex_decode_mixed (in, mask, 16, out, &n);
+          if (used == 0)
+            {
+              /* A lone digit followed by white characters */
+              if (ahex_decode_tail (in, in_size, &used, out + n, 1) == 0)
+                break;
+              n++;
+            }
+          in += used;
+          in_size -= used;
+          continue;
+        }
+
+      /* Join each pair of nibbles in the low byte of 16-bit lanes */
+      bytes = _mm_or_si128 (_mm_slli_epi16 (values, 4),
+                            _mm_srli_epi16 (values, 8));
+      bytes = _mm_and_si128 (bytes, _mm_set1_epi16 (0xff));
+      _mm_storel_epi64 ((__m128i *) (out + n),
+                        _mm_packus_epi16 (bytes, bytes));
+      in += 16;
+      in_size -= 16;
+      n += 8;
+    }
+
+  n += ahex_decode_tail (in, in_size, &used, out + n, out_size - n);
+  *in_used = (in - start) + used;
+  return n;
+}
+
+static void
+ahex_encode (const pdf_uchar_t *in,
+             pdf_size_t         in_size,
+             pdf_uchar_t       *out)
+{
+  __m128i bytes;
+  __m128i hi;
+  __m128i lo;
+  __m128i nine = _mm_set1_epi8 (9);
+  __m128i zero = _mm_set1_epi8 ('0');
+  __m128i gap = _mm_set1_epi8 ('A' - '0' - 10);
+
+  while (in_size >= 16)
+    {
+      bytes = _mm_loadu_si128 ((const __m128i *) in);
+      hi = _mm_and_si128 (_mm_srli_epi16 (bytes, 4), _mm_set1_epi8 (0x0f));
+      lo = _mm_and_si128 (bytes, _mm_set1_epi8 (0x0f));
+
+      /* '0' + n, plus the gap up to 'A' for n > 9 */
+      hi = _mm_add_epi8 (_mm_add_epi8 (hi, zero),
+                         _mm_and_si128 (_mm_cmpgt_epi8 (hi, nine), gap));
+      lo = _mm_add_epi8 (_mm_add_epi8 (lo, zero),
+                         _mm_and_si128 (_mm_cmpgt_epi8 (lo, nine), gap));
+
+      _mm_storeu_si128 ((__m128i *) out, _mm_unpacklo_epi8 (hi, lo));
+      _mm_storeu_si128 ((__m128i *) (out + 16), _mm_unpackhi_epi8 (hi, lo));
+      in += 16;
+      in_size -= 16;
+      out += 32;
+    }
+
+  while (in_size-- > 0)
+    {
+      *out++ = to_hex[*in >> 4];
+      *out++ = to_hex[*in++ & 0x0f];
+    }
+}
+
+#else /* !AHEX_SSE2 */
+
+static pdf_size_t
+ahex_decode (const pdf_uchar_t *in,
+             pdf_size_t         in_size,
+             pdf_size_t        *in_used,
+             pdf_uchar_t       *out,
+             pdf_size_t         out_size)
+{
+  return ahex_decode_tail (in, in_size, in_used, out, out_size);
+}
+
+static void
+ahex_encode (const pdf_uchar_t *in,
+             pdf_size_t         in_size,
+             pdf_uchar_t       *out)
+{
+  while (in_size-- > 0)
+    {
+      *out++ = to_hex[*in >> 4];
+      *out++ = to_hex[*in++ & 0x0f];
+    }
+}
+
+#endif /* !AHEX_SSE2 */
+
+#if defined AHEX_AVX2
+
+__attribute__ ((target ("avx2")))
+static pdf_size_t
+ahex_decode_avx2 (const pdf_uchar_t *in,
+                  pdf_size_t         in_size,
+                  pdf_size_t        *in_used,
+                  pdf_uchar_t       *out,
+                  pdf_size_t         out_size)
+{
+  const pdf_uchar_t *start = in;
+  pdf_size_t n = 0;
+  pdf_size_t used;
+  pdf_u32_t mask;
+  __m256i chars;
+  __m256i white;
+  __m256i digits;
+  __m256i letters;
+  __m256i digit_p;
+  __m256i letter_p;
+  __m256i values;
+  __m256i bytes;
+
+  while (in_size >= 32 && out_size - n >= 16)
+    {
+      chars = _mm256_loadu_si256 ((const __m256i *) in);
+      digits = _mm256_sub_epi8 (chars, _mm256_set1_epi8 ('0'));
+      letters = _mm256_sub_epi8 (_mm256_or_si256 (chars,
+                                                  _mm256_set1_epi8 (0x20)),
+                                 _mm256_set1_epi8 ('a'));
+      digit_p = _mm256_cmpeq_epi8 (_mm256_min_epu8 (digits,
+                                                    _mm256_set1_epi8 (9)),
+                                   digits);
+      letter_p = _mm256_cmpeq_epi8 (_mm256_min_epu8 (letters,
+                                                     _mm256_set1_epi8 (5)),
+                                    letters);
+      mask = _mm256_movemask_epi8 (_mm256_or_si256 (digit_p, letter_p));
+      if (mask != 0xffffffff)
+        {
+          /* Pair the digits across the white characters, and stop at
+           * any other character */
+          white = _mm256_cmpeq_epi8 (chars, _mm256_setzero_si256 ());
+          white = _mm256_or_si256 (white,
+                                   _mm256_cmpeq_epi8 (chars,
+                                                      _mm256_set1_epi8 ('\t')));
+          white = _mm256_or_si256 (white,
+                                   _mm256_cmpeq_epi8 (chars,
+                                                      _mm256_set1_epi8 ('\n')));
+          white = _mm256_or_si256 (white,
+                                   _mm256_cmpeq_epi8 (chars,
+                                                      _mm256_set1_epi8 ('\f')));
+          white = _mm256_or_si256 (white,
+                                   _mm256_cmpeq_epi8 (chars,
+                                                      _mm256_set1_epi8 ('\r')));
+          white = _mm256_or_si256 (white,
+                                   _mm256_cmpeq_epi8 (chars,
+                                                      _mm256_set1_epi8 (' ')));
+          if ((mask | (pdf_u32_t) _mm256_movemask_epi8 (white)) != 0xffffffff)
+            break;
+
+          used = ahex_decode_mixed (in, mask, 32, out, &n);
+          if (used == 0)
+            {
+              /* A lone digit followed by white characters */
+              if (ahex_decode_tail (in, in_size, &used, out + n, 1) == 0)
+                break;
+              n++;
+            }
+          in += used;
+          in_size -= used;
+          continue;
+        }
+
+      values = _mm256_or_si256 (_mm256_and_si256 (digit_p, digits),
+                                _mm256_and_si256 (letter_p,
+                                                  _mm256_add_epi8 (letters,
+                                                                   _mm256_set1_epi8 (10))));
+      bytes = _mm256_or_si256 (_mm256_slli_epi16 (values, 4),
+                               _mm256_srli_epi16 (values, 8));
+      bytes = _mm256_and_si256 (bytes, _mm256_set1_epi16 (0xff));
+
+      /* The packing works on each 128-bit lane, so gather the low
+       * halves of both lanes */
+      bytes = _mm256_permute4x64_epi64 (_mm256_packus_epi16 (bytes, bytes),
+                                        0x08);
+      _mm_storeu_si128 ((__m128i *) (out + n),
+                        _mm256_castsi256_si128 (bytes));
+      in += 32;
+      in_size -= 32;
+      n += 16;
+    }
+
+  n += ahex_decode (in, in_size, &used, out + n, out_size - n);
+  *in_used = (in - start) + used;
+  return n;
+}
+
+#endif /* AHEX_AVX2 */
+
 /* End of pdf_stm_f_ahex.c */
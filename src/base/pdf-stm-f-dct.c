@@ -154,7 +154,7 @@ stm_f_dctdec_deinit (void *state)
 
   if (filter_state->cinfo)
     {
-      jpeg_finish_decompress (filter_state->cinfo);
+      jpeg_abort_decompress (filter_state->cinfo);
       filter_state->cinfo->mem->free_pool ((j_common_ptr) filter_state->cinfo,
                                            JPOOL_IMAGE);
       jpeg_destroy_decompress (filter_state->cinfo);
@@ -0,0 +1,315 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-f-digest.c
+ *       Date:         Sun Oct 18 10:12:06 2026
+ *
+ *       GNU PDF Library - Message digests stream filter
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+
+#include <pdf-types.h>
+#include <pdf-types-buffer.h>
+#include <pdf-hash-helper.h>
+#include <pdf-alloc.h>
+#include <pdf-crypt.h>
+#include <pdf-stm-f-digest.h>
+
+/* The data goes through the filter unchanged, while the digests of the
+ * requested algorithms are computed in the same pass. Filled input
+ * buffers are handed over to the output by the stream layer, and the
+ * filter only gets to hash them in stm_f_digest_peek. */
+
+static pdf_bool_t stm_f_digest_init (const pdf_hash_t  *params,
+                                     void             **state,
+                                     pdf_error_t      **error);
+static void stm_f_digest_deinit (void *state);
+static enum pdf_stm_filter_apply_status_e
+stm_f_digest_apply (void          *state,
+                    pdf_buffer_t  *in,
+                    pdf_buffer_t  *out,
+                    pdf_bool_t     finish,
+                    pdf_error_t  **error);
+static pdf_bool_t stm_f_digest_reset (void         *state,
+                                      pdf_error_t **error);
+static pdf_bool_t stm_f_digest_peek (void               *state,
+                                     const pdf_uchar_t  *data,
+                                     pdf_size_t          size,
+                                     pdf_error_t       **error);
+
+/* Define message digests filter */
+static const pdf_stm_filter_impl_t pdf_stm_f_digest_impl = {
+  .init_fn     = stm_f_digest_init,
+  .apply_fn    = stm_f_digest_apply,
+  .deinit_fn   = stm_f_digest_deinit,
+  .reset_fn    = stm_f_digest_reset,
+  .peek_fn     = stm_f_digest_peek,
+  .passthrough = PDF_TRUE,
+};
+
+const pdf_stm_filter_impl_t *
+pdf_stm_f_digest_get (void)
+{
+  return &pdf_stm_f_digest_impl;
+}
+
+#define DIGEST_N_ALGOS (PDF_CRYPT_MD_SHA256 + 1)
+
+/* Parameter enabling each algorithm, and size of its digest */
+static const struct {
+  const pdf_char_t *param;
+  pdf_size_t size;
+} digest_algos[DIGEST_N_ALGOS] = {
+  { "MD5",    PDF_CRYPT_MD_MD5_SIZE    },
+  { "SHA1",   PDF_CRYPT_MD_SHA1_SIZE   },
+  { "SHA256", PDF_CRYPT_MD_SHA256_SIZE }
+};
+
+/* Internal state */
+struct pdf_stm_f_digest_s
+{
+  /* Message digests, NULL for the algorithms not requested */
+  pdf_crypt_md_t *md[DIGEST_N_ALGOS];
+  /* Digests, once all the data went through the filter */
+  pdf_char_t digest[DIGEST_N_ALGOS][PDF_CRYPT_MD_MAX_SIZE];
+  pdf_bool_t done;
+};
+
+static pdf_bool_t
+stm_f_digest_init (const pdf_hash_t  *params,
+                   void             **state,
+                   pdf_error_t      **error)
+{
+  struct pdf_stm_f_digest_s *filter_state;
+  pdf_bool_t any = PDF_FALSE;
+  int i;
+
+  filter_state = pdf_alloc (sizeof (struct pdf_stm_f_digest_s));
+  if (!filter_state)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create digest filter internal state: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long)sizeof (struct pdf_stm_f_digest_s));
+      return PDF_FALSE;
+    }
+  memset (filter_state, 0, sizeof (struct pdf_stm_f_digest_s));
+
+  for (i = 0; i < DIGEST_N_ALGOS; i++)
+    {
+      if (!params ||
+          !pdf_hash_key_p (params, digest_algos[i].param) ||
+          !pdf_hash_get_bool (params, digest_algos[i].param))
+        continue;
+
+      filter_state->md[i] = pdf_crypt_md_new (i, error);
+      if (!filter_state->md[i])
+        {
+          stm_f_digest_deinit (filter_state);
+          return PDF_FALSE;
+        }
+      any = PDF_TRUE;
+    }
+
+  if (!any)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EBADDATA,
+                     "cannot initialize digest filter: "
+                     "no digest algorithm requested");
+      stm_f_digest_deinit (filter_state);
+      return PDF_FALSE;
+    }
+
+  *state = filter_state;
+  return PDF_TRUE;
+}
+
+static void
+stm_f_digest_deinit (void *state)
+{
+  struct pdf_stm_f_digest_s *filter_state = state;
+  int i;
+
+  for (i = 0; i < DIGEST_N_ALGOS; i++)
+    {
+      if (filter_state->md[i])
+        pdf_crypt_md_destroy (filter_state->md[i]);
+    }
+  pdf_dealloc (state);
+}
+
+static pdf_bool_t
+stm_f_digest_peek (void               *state,
+                   const pdf_uchar_t  *data,
+                   pdf_size_t          size,
+                   pdf_error_t       **error)
+{
+  struct pdf_stm_f_digest_s *filter_state = state;
+  int i;
+
+  for (i = 0; i < DIGEST_N_ALGOS; i++)
+    {
+      if (filter_state->md[i] &&
+          !pdf_crypt_md_write (filter_state->md[i],
+                               (const pdf_char_t *)data,
+                               size,
+                               error))
+        return PDF_FALSE;
+    }
+
+  return PDF_TRUE;
+}
+
+static enum pdf_stm_filter_apply_status_e
+stm_f_digest_apply (void          *state,
+                    pdf_buffer_t  *in,
+                    pdf_buffer_t  *out,
+                    pdf_bool_t     finish,
+                    pdf_error_t  **error)
+{
+  struct pdf_stm_f_digest_s *filter_state = state;
+  pdf_size_t bytes_to_copy;
+  int i;
+
+  PDF_ASSERT (in->wp >= in->rp);
+  PDF_ASSERT (out->size >= out->wp);
+
+  /* Copy what could not be handed over */
+  bytes_to_copy = PDF_MIN (in->wp - in->rp, out->size - out->wp);
+  if (bytes_to_copy > 0)
+    {
+      if (!stm_f_digest_peek (state,
+                              in->data + in->rp,
+                              bytes_to_copy,
+                              error))
+        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+
+      memcpy (out->data + out->wp, in->data + in->rp, bytes_to_copy);
+      in->rp += bytes_to_copy;
+      out->wp += bytes_to_copy;
+    }
+
+  if (!pdf_buffer_eob_p (in))
+    return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+
+  if (!finish)
+    return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+
+  /* All the data went through, read the digests */
+  for (i = 0; i < DIGEST_N_ALGOS; i++)
+    {
+      if (filter_state->md[i] &&
+          !pdf_crypt_md_read (filter_state->md[i],
+                              filter_state->digest[i],
+                              digest_algos[i].size,
+                              error))
+        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+    }
+  filter_state->done = PDF_TRUE;
+
+  return PDF_STM_FILTER_APPLY_STATUS_EOF;
+}
+
+static pdf_bool_t
+stm_f_digest_reset (void         *state,
+                    pdf_error_t **error)
+{
+  struct pdf_stm_f_digest_s *filter_state = state;
+  int i;
+
+  /* Reading a digest starts it again, so that the data hashed before
+   * the reset is dropped */
+  if (!filter_state->done)
+    {
+      for (i = 0; i < DIGEST_N_ALGOS; i++)
+        {
+          if (filter_state->md[i] &&
+              !pdf_crypt_md_read (filter_state->md[i],
+                                  filter_state->digest[i],
+                                  digest_algos[i].size,
+                                  error))
+            return PDF_FALSE;
+        }
+    }
+
+  filter_state->done = PDF_FALSE;
+  return PDF_TRUE;
+}
+
+pdf_bool_t
+pdf_stm_f_digest_read (void                      *state,
+                       enum pdf_crypt_md_algo_e   algorithm,
+                       pdf_char_t                *digest,
+                       pdf_size_t                 size,
+                       pdf_size_t                *digest_size,
+                       pdf_error_t              **error)
+{
+  struct pdf_stm_f_digest_s *filter_state = state;
+
+  if ((int)algorithm < 0 ||
+      algorithm >= DIGEST_N_ALGOS ||
+      !filter_state->md[algorithm])
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMATCH,
+                     "cannot read digest: "
+                     "algorithm not computed by the filter");
+      return PDF_FALSE;
+    }
+
+  if (!filter_state->done)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EAGAIN,
+                     "cannot read digest: "
+                     "the end of the data was not reached yet");
+      return PDF_FALSE;
+    }
+
+  if (size < digest_algos[algorithm].size)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EBADDATA,
+                     "cannot read digest: "
+                     "need at least %lu bytes in output (%lu given)",
+                     (unsigned long)digest_algos[algorithm].size,
+                     (unsigned long)size);
+      return PDF_FALSE;
+    }
+
+  memcpy (digest,
+          filter_state->digest[algorithm],
+          digest_algos[algorithm].size);
+  if (digest_size)
+    *digest_size = digest_algos[algorithm].size;
+
+  return PDF_TRUE;
+}
+
+/* End of pdf_stm_f_digest.c */
@@ -0,0 +1,47 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-f-digest.h
+ *       Date:         Sun Oct 18 10:12:06 2026
+ *
+ *       GNU PDF Library - Message digests stream filter
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PDF_STM_F_DIGEST_H
+#define PDF_STM_F_DIGEST_H
+
+#include <config.h>
+
+#include <pdf-crypt.h>
+#include <pdf-stm-filter.h>
+
+const pdf_stm_filter_impl_t *pdf_stm_f_digest_get (void);
+
+/* Copy the digest computed with ALGORITHM to DIGEST, once the filter
+ * reached EOF */
+pdf_bool_t pdf_stm_f_digest_read (void                      *state,
+                                  enum pdf_crypt_md_algo_e   algorithm,
+                                  pdf_char_t                *digest,
+                                  pdf_size_t                 size,
+                                  pdf_size_t                *digest_size,
+                                  pdf_error_t              **error);
+
+#endif /* !PDF_STM_F_DIGEST_H */
+
+/* End of pdf_stm_f_digest.h */
@@ -0,0 +1,4209 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-f-fax-tables.h
+ *
+ *       GNU PDF Library - Lookup tables of the CCITT Fax decoder
+ *
+ *       Generated by build-aux/pdf-stm-generate-fax-tables.c
+ *       from the codes of ITU-T T.4. Do not edit.
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PDF_STM_F_FAX_TABLES_H
+#define PDF_STM_F_FAX_TABLES_H
+
+/* Lookup tables of white runs, black runs and 2-D modes, indexed by
+ * the next bits of the encoded data; 0 for invalid codes */
+
+static const pdf_u16_t fax_white_table[1 << FAX_WHITE_BITS] =
+  {
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, FAX_ENTRY (1792, 11), FAX_ENTRY (1792, 11),
+    FAX_ENTRY (1984, 12), FAX_ENTRY (2048, 12), FAX_ENTRY (2112, 12),
+    FAX_ENTRY (2176, 12), FAX_ENTRY (2240, 12), FAX_ENTRY (2304, 12),
+    FAX_ENTRY (1856, 11), FAX_ENTRY (1856, 11), FAX_ENTRY (1920, 11),
+    FAX_ENTRY (1920, 11), FAX_ENTRY (2368, 12), FAX_ENTRY (2432, 12),
+    FAX_ENTRY (2496, 12), FAX_ENTRY (2560, 12), FAX_ENTRY (29, 8),
+    FAX_ENTRY (29, 8), FAX_ENTRY (29, 8), FAX_ENTRY (29, 8),
+    FAX_ENTRY (29, 8), FAX_ENTRY (29, 8), FAX_ENTRY (29, 8),
+    FAX_ENTRY (29, 8), FAX_ENTRY (29, 8), FAX_ENTRY (29, 8),
+    FAX_ENTRY (29, 8), FAX_ENTRY (29, 8), FAX_ENTRY (29, 8),
+    FAX_ENTRY (29, 8), FAX_ENTRY (29, 8), FAX_ENTRY (29, 8),
+    FAX_ENTRY (30, 8), FAX_ENTRY (30, 8), FAX_ENTRY (30, 8),
+    FAX_ENTRY (30, 8), FAX_ENTRY (30, 8), FAX_ENTRY (30, 8),
+    FAX_ENTRY (30, 8), FAX_ENTRY (30, 8), FAX_ENTRY (30, 8),
+    FAX_ENTRY (30, 8), FAX_ENTRY (30, 8), FAX_ENTRY (30, 8),
+    FAX_ENTRY (30, 8), FAX_ENTRY (30, 8), FAX_ENTRY (30, 8),
+    FAX_ENTRY (30, 8), FAX_ENTRY (45, 8), FAX_ENTRY (45, 8),
+    FAX_ENTRY (45, 8), FAX_ENTRY (45, 8), FAX_ENTRY (45, 8),
+    FAX_ENTRY (45, 8), FAX_ENTRY (45, 8), FAX_ENTRY (45, 8),
+    FAX_ENTRY (45, 8), FAX_ENTRY (45, 8), FAX_ENTRY (45, 8),
+    FAX_ENTRY (45, 8), FAX_ENTRY (45, 8), FAX_ENTRY (45, 8),
+    FAX_ENTRY (45, 8), FAX_ENTRY (45, 8), FAX_ENTRY (46, 8),
+    FAX_ENTRY (46, 8), FAX_ENTRY (46, 8), FAX_ENTRY (46, 8),
+    FAX_ENTRY (46, 8), FAX_ENTRY (46, 8), FAX_ENTRY (46, 8),
+    FAX_ENTRY (46, 8), FAX_ENTRY (46, 8), FAX_ENTRY (46, 8),
+    FAX_ENTRY (46, 8), FAX_ENTRY (46, 8), FAX_ENTRY (46, 8),
+    FAX_ENTRY (46, 8), FAX_ENTRY (46, 8), FAX_ENTRY (46, 8),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (22, 7),
+    FAX_ENTRY (22, 7), FAX_ENTRY (22, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (23, 7), FAX_ENTRY (23, 7),
+    FAX_ENTRY (23, 7), FAX_ENTRY (47, 8), FAX_ENTRY (47, 8),
+    FAX_ENTRY (47, 8), FAX_ENTRY (47, 8), FAX_ENTRY (47, 8),
+    FAX_ENTRY (47, 8), FAX_ENTRY (47, 8), FAX_ENTRY (47, 8),
+    FAX_ENTRY (47, 8), FAX_ENTRY (47, 8), FAX_ENTRY (47, 8),
+    FAX_ENTRY (47, 8), FAX_ENTRY (47, 8), FAX_ENTRY (47, 8),
+    FAX_ENTRY (47, 8), FAX_ENTRY (47, 8), FAX_ENTRY (48, 8),
+    FAX_ENTRY (48, 8), FAX_ENTRY (48, 8), FAX_ENTRY (48, 8),
+    FAX_ENTRY (48, 8), FAX_ENTRY (48, 8), FAX_ENTRY (48, 8),
+    FAX_ENTRY (48, 8), FAX_ENTRY (48, 8), FAX_ENTRY (48, 8),
+    FAX_ENTRY (48, 8), FAX_ENTRY (48, 8), FAX_ENTRY (48, 8),
+    FAX_ENTRY (48, 8), FAX_ENTRY (48, 8), FAX_ENTRY (48, 8),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (13, 6), FAX_ENTRY (13, 6),
+    FAX_ENTRY (13, 6), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (20, 7), FAX_ENTRY (20, 7), FAX_ENTRY (20, 7),
+    FAX_ENTRY (33, 8), FAX_ENTRY (33, 8), FAX_ENTRY (33, 8),
+    FAX_ENTRY (33, 8), FAX_ENTRY (33, 8), FAX_ENTRY (33, 8),
+    FAX_ENTRY (33, 8), FAX_ENTRY (33, 8), FAX_ENTRY (33, 8),
+    FAX_ENTRY (33, 8), FAX_ENTRY (33, 8), FAX_ENTRY (33, 8),
+    FAX_ENTRY (33, 8), FAX_ENTRY (33, 8), FAX_ENTRY (33, 8),
+    FAX_ENTRY (33, 8), FAX_ENTRY (34, 8), FAX_ENTRY (34, 8),
+    FAX_ENTRY (34, 8), FAX_ENTRY (34, 8), FAX_ENTRY (34, 8),
+    FAX_ENTRY (34, 8), FAX_ENTRY (34, 8), FAX_ENTRY (34, 8),
+    FAX_ENTRY (34, 8), FAX_ENTRY (34, 8), FAX_ENTRY (34, 8),
+    FAX_ENTRY (34, 8), FAX_ENTRY (34, 8), FAX_ENTRY (34, 8),
+    FAX_ENTRY (34, 8), FAX_ENTRY (34, 8), FAX_ENTRY (35, 8),
+    FAX_ENTRY (35, 8), FAX_ENTRY (35, 8), FAX_ENTRY (35, 8),
+    FAX_ENTRY (35, 8), FAX_ENTRY (35, 8), FAX_ENTRY (35, 8),
+    FAX_ENTRY (35, 8), FAX_ENTRY (35, 8), FAX_ENTRY (35, 8),
+    FAX_ENTRY (35, 8), FAX_ENTRY (35, 8), FAX_ENTRY (35, 8),
+    FAX_ENTRY (35, 8), FAX_ENTRY (35, 8), FAX_ENTRY (35, 8),
+    FAX_ENTRY (36, 8), FAX_ENTRY (36, 8), FAX_ENTRY (36, 8),
+    FAX_ENTRY (36, 8), FAX_ENTRY (36, 8), FAX_ENTRY (36, 8),
+    FAX_ENTRY (36, 8), FAX_ENTRY (36, 8), FAX_ENTRY (36, 8),
+    FAX_ENTRY (36, 8), FAX_ENTRY (36, 8), FAX_ENTRY (36, 8),
+    FAX_ENTRY (36, 8), FAX_ENTRY (36, 8), FAX_ENTRY (36, 8),
+    FAX_ENTRY (36, 8), FAX_ENTRY (37, 8), FAX_ENTRY (37, 8),
+    FAX_ENTRY (37, 8), FAX_ENTRY (37, 8), FAX_ENTRY (37, 8),
+    FAX_ENTRY (37, 8), FAX_ENTRY (37, 8), FAX_ENTRY (37, 8),
+    FAX_ENTRY (37, 8), FAX_ENTRY (37, 8), FAX_ENTRY (37, 8),
+    FAX_ENTRY (37, 8), FAX_ENTRY (37, 8), FAX_ENTRY (37, 8),
+    FAX_ENTRY (37, 8), FAX_ENTRY (37, 8), FAX_ENTRY (38, 8),
+    FAX_ENTRY (38, 8), FAX_ENTRY (38, 8), FAX_ENTRY (38, 8),
+    FAX_ENTRY (38, 8), FAX_ENTRY (38, 8), FAX_ENTRY (38, 8),
+    FAX_ENTRY (38, 8), FAX_ENTRY (38, 8), FAX_ENTRY (38, 8),
+    FAX_ENTRY (38, 8), FAX_ENTRY (38, 8), FAX_ENTRY (38, 8),
+    FAX_ENTRY (38, 8), FAX_ENTRY (38, 8), FAX_ENTRY (38, 8),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (19, 7),
+    FAX_ENTRY (19, 7), FAX_ENTRY (19, 7), FAX_ENTRY (31, 8),
+    FAX_ENTRY (31, 8), FAX_ENTRY (31, 8), FAX_ENTRY (31, 8),
+    FAX_ENTRY (31, 8), FAX_ENTRY (31, 8), FAX_ENTRY (31, 8),
+    FAX_ENTRY (31, 8), FAX_ENTRY (31, 8), FAX_ENTRY (31, 8),
+    FAX_ENTRY (31, 8), FAX_ENTRY (31, 8), FAX_ENTRY (31, 8),
+    FAX_ENTRY (31, 8), FAX_ENTRY (31, 8), FAX_ENTRY (31, 8),
+    FAX_ENTRY (32, 8), FAX_ENTRY (32, 8), FAX_ENTRY (32, 8),
+    FAX_ENTRY (32, 8), FAX_ENTRY (32, 8), FAX_ENTRY (32, 8),
+    FAX_ENTRY (32, 8), FAX_ENTRY (32, 8), FAX_ENTRY (32, 8),
+    FAX_ENTRY (32, 8), FAX_ENTRY (32, 8), FAX_ENTRY (32, 8),
+    FAX_ENTRY (32, 8), FAX_ENTRY (32, 8), FAX_ENTRY (32, 8),
+    FAX_ENTRY (32, 8), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (1, 6),
+    FAX_ENTRY (1, 6), FAX_ENTRY (1, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (12, 6), FAX_ENTRY (12, 6), FAX_ENTRY (12, 6),
+    FAX_ENTRY (53, 8), FAX_ENTRY (53, 8), FAX_ENTRY (53, 8),
+    FAX_ENTRY (53, 8), FAX_ENTRY (53, 8), FAX_ENTRY (53, 8),
+    FAX_ENTRY (53, 8), FAX_ENTRY (53, 8), FAX_ENTRY (53, 8),
+    FAX_ENTRY (53, 8), FAX_ENTRY (53, 8), FAX_ENTRY (53, 8),
+    FAX_ENTRY (53, 8), FAX_ENTRY (53, 8), FAX_ENTRY (53, 8),
+    FAX_ENTRY (53, 8), FAX_ENTRY (54, 8), FAX_ENTRY (54, 8),
+    FAX_ENTRY (54, 8), FAX_ENTRY (54, 8), FAX_ENTRY (54, 8),
+    FAX_ENTRY (54, 8), FAX_ENTRY (54, 8), FAX_ENTRY (54, 8),
+    FAX_ENTRY (54, 8), FAX_ENTRY (54, 8), FAX_ENTRY (54, 8),
+    FAX_ENTRY (54, 8), FAX_ENTRY (54, 8), FAX_ENTRY (54, 8),
+    FAX_ENTRY (54, 8), FAX_ENTRY (54, 8), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (26, 7), FAX_ENTRY (26, 7),
+    FAX_ENTRY (26, 7), FAX_ENTRY (39, 8), FAX_ENTRY (39, 8),
+    FAX_ENTRY (39, 8), FAX_ENTRY (39, 8), FAX_ENTRY (39, 8),
+    FAX_ENTRY (39, 8), FAX_ENTRY (39, 8), FAX_ENTRY (39, 8),
+    FAX_ENTRY (39, 8), FAX_ENTRY (39, 8), FAX_ENTRY (39, 8),
+    FAX_ENTRY (39, 8), FAX_ENTRY (39, 8), FAX_ENTRY (39, 8),
+    FAX_ENTRY (39, 8), FAX_ENTRY (39, 8), FAX_ENTRY (40, 8),
+    FAX_ENTRY (40, 8), FAX_ENTRY (40, 8), FAX_ENTRY (40, 8),
+    FAX_ENTRY (40, 8), FAX_ENTRY (40, 8), FAX_ENTRY (40, 8),
+    FAX_ENTRY (40, 8), FAX_ENTRY (40, 8), FAX_ENTRY (40, 8),
+    FAX_ENTRY (40, 8), FAX_ENTRY (40, 8), FAX_ENTRY (40, 8),
+    FAX_ENTRY (40, 8), FAX_ENTRY (40, 8), FAX_ENTRY (40, 8),
+    FAX_ENTRY (41, 8), FAX_ENTRY (41, 8), FAX_ENTRY (41, 8),
+    FAX_ENTRY (41, 8), FAX_ENTRY (41, 8), FAX_ENTRY (41, 8),
+    FAX_ENTRY (41, 8), FAX_ENTRY (41, 8), FAX_ENTRY (41, 8),
+    FAX_ENTRY (41, 8), FAX_ENTRY (41, 8), FAX_ENTRY (41, 8),
+    FAX_ENTRY (41, 8), FAX_ENTRY (41, 8), FAX_ENTRY (41, 8),
+    FAX_ENTRY (41, 8), FAX_ENTRY (42, 8), FAX_ENTRY (42, 8),
+    FAX_ENTRY (42, 8), FAX_ENTRY (42, 8), FAX_ENTRY (42, 8),
+    FAX_ENTRY (42, 8), FAX_ENTRY (42, 8), FAX_ENTRY (42, 8),
+    FAX_ENTRY (42, 8), FAX_ENTRY (42, 8), FAX_ENTRY (42, 8),
+    FAX_ENTRY (42, 8), FAX_ENTRY (42, 8), FAX_ENTRY (42, 8),
+    FAX_ENTRY (42, 8), FAX_ENTRY (42, 8), FAX_ENTRY (43, 8),
+    FAX_ENTRY (43, 8), FAX_ENTRY (43, 8), FAX_ENTRY (43, 8),
+    FAX_ENTRY (43, 8), FAX_ENTRY (43, 8), FAX_ENTRY (43, 8),
+    FAX_ENTRY (43, 8), FAX_ENTRY (43, 8), FAX_ENTRY (43, 8),
+    FAX_ENTRY (43, 8), FAX_ENTRY (43, 8), FAX_ENTRY (43, 8),
+    FAX_ENTRY (43, 8), FAX_ENTRY (43, 8), FAX_ENTRY (43, 8),
+    FAX_ENTRY (44, 8), FAX_ENTRY (44, 8), FAX_ENTRY (44, 8),
+    FAX_ENTRY (44, 8), FAX_ENTRY (44, 8), FAX_ENTRY (44, 8),
+    FAX_ENTRY (44, 8), FAX_ENTRY (44, 8), FAX_ENTRY (44, 8),
+    FAX_ENTRY (44, 8), FAX_ENTRY (44, 8), FAX_ENTRY (44, 8),
+    FAX_ENTRY (44, 8), FAX_ENTRY (44, 8), FAX_ENTRY (44, 8),
+    FAX_ENTRY (44, 8), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (21, 7), FAX_ENTRY (21, 7), FAX_ENTRY (21, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (28, 7),
+    FAX_ENTRY (28, 7), FAX_ENTRY (28, 7), FAX_ENTRY (61, 8),
+    FAX_ENTRY (61, 8), FAX_ENTRY (61, 8), FAX_ENTRY (61, 8),
+    FAX_ENTRY (61, 8), FAX_ENTRY (61, 8), FAX_ENTRY (61, 8),
+    FAX_ENTRY (61, 8), FAX_ENTRY (61, 8), FAX_ENTRY (61, 8),
+    FAX_ENTRY (61, 8), FAX_ENTRY (61, 8), FAX_ENTRY (61, 8),
+    FAX_ENTRY (61, 8), FAX_ENTRY (61, 8), FAX_ENTRY (61, 8),
+    FAX_ENTRY (62, 8), FAX_ENTRY (62, 8), FAX_ENTRY (62, 8),
+    FAX_ENTRY (62, 8), FAX_ENTRY (62, 8), FAX_ENTRY (62, 8),
+    FAX_ENTRY (62, 8), FAX_ENTRY (62, 8), FAX_ENTRY (62, 8),
+    FAX_ENTRY (62, 8), FAX_ENTRY (62, 8), FAX_ENTRY (62, 8),
+    FAX_ENTRY (62, 8), FAX_ENTRY (62, 8), FAX_ENTRY (62, 8),
+    FAX_ENTRY (62, 8), FAX_ENTRY (63, 8), FAX_ENTRY (63, 8),
+    FAX_ENTRY (63, 8), FAX_ENTRY (63, 8), FAX_ENTRY (63, 8),
+    FAX_ENTRY (63, 8), FAX_ENTRY (63, 8), FAX_ENTRY (63, 8),
+    FAX_ENTRY (63, 8), FAX_ENTRY (63, 8), FAX_ENTRY (63, 8),
+    FAX_ENTRY (63, 8), FAX_ENTRY (63, 8), FAX_ENTRY (63, 8),
+    FAX_ENTRY (63, 8), FAX_ENTRY (63, 8), FAX_ENTRY (0, 8),
+    FAX_ENTRY (0, 8), FAX_ENTRY (0, 8), FAX_ENTRY (0, 8),
+    FAX_ENTRY (0, 8), FAX_ENTRY (0, 8), FAX_ENTRY (0, 8),
+    FAX_ENTRY (0, 8), FAX_ENTRY (0, 8), FAX_ENTRY (0, 8),
+    FAX_ENTRY (0, 8), FAX_ENTRY (0, 8), FAX_ENTRY (0, 8),
+    FAX_ENTRY (0, 8), FAX_ENTRY (0, 8), FAX_ENTRY (0, 8),
+    FAX_ENTRY (320, 8), FAX_ENTRY (320, 8), FAX_ENTRY (320, 8),
+    FAX_ENTRY (320, 8), FAX_ENTRY (320, 8), FAX_ENTRY (320, 8),
+    FAX_ENTRY (320, 8), FAX_ENTRY (320, 8), FAX_ENTRY (320, 8),
+    FAX_ENTRY (320, 8), FAX_ENTRY (320, 8), FAX_ENTRY (320, 8),
+    FAX_ENTRY (320, 8), FAX_ENTRY (320, 8), FAX_ENTRY (320, 8),
+    FAX_ENTRY (320, 8), FAX_ENTRY (384, 8), FAX_ENTRY (384, 8),
+    FAX_ENTRY (384, 8), FAX_ENTRY (384, 8), FAX_ENTRY (384, 8),
+    FAX_ENTRY (384, 8), FAX_ENTRY (384, 8), FAX_ENTRY (384, 8),
+    FAX_ENTRY (384, 8), FAX_ENTRY (384, 8), FAX_ENTRY (384, 8),
+    FAX_ENTRY (384, 8), FAX_ENTRY (384, 8), FAX_ENTRY (384, 8),
+    FAX_ENTRY (384, 8), FAX_ENTRY (384, 8), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (10, 5), FAX_ENTRY (10, 5),
+    FAX_ENTRY (10, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (11, 5), FAX_ENTRY (11, 5), FAX_ENTRY (11, 5),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (27, 7),
+    FAX_ENTRY (27, 7), FAX_ENTRY (27, 7), FAX_ENTRY (59, 8),
+    FAX_ENTRY (59, 8), FAX_ENTRY (59, 8), FAX_ENTRY (59, 8),
+    FAX_ENTRY (59, 8), FAX_ENTRY (59, 8), FAX_ENTRY (59, 8),
+    FAX_ENTRY (59, 8), FAX_ENTRY (59, 8), FAX_ENTRY (59, 8),
+    FAX_ENTRY (59, 8), FAX_ENTRY (59, 8), FAX_ENTRY (59, 8),
+    FAX_ENTRY (59, 8), FAX_ENTRY (59, 8), FAX_ENTRY (59, 8),
+    FAX_ENTRY (60, 8), FAX_ENTRY (60, 8), FAX_ENTRY (60, 8),
+    FAX_ENTRY (60, 8), FAX_ENTRY (60, 8), FAX_ENTRY (60, 8),
+    FAX_ENTRY (60, 8), FAX_ENTRY (60, 8), FAX_ENTRY (60, 8),
+    FAX_ENTRY (60, 8), FAX_ENTRY (60, 8), FAX_ENTRY (60, 8),
+    FAX_ENTRY (60, 8), FAX_ENTRY (60, 8), FAX_ENTRY (60, 8),
+    FAX_ENTRY (60, 8), FAX_ENTRY (1472, 9), FAX_ENTRY (1472, 9),
+    FAX_ENTRY (1472, 9), FAX_ENTRY (1472, 9), FAX_ENTRY (1472, 9),
+    FAX_ENTRY (1472, 9), FAX_ENTRY (1472, 9), FAX_ENTRY (1472, 9),
+    FAX_ENTRY (1536, 9), FAX_ENTRY (1536, 9), FAX_ENTRY (1536, 9),
+    FAX_ENTRY (1536, 9), FAX_ENTRY (1536, 9), FAX_ENTRY (1536, 9),
+    FAX_ENTRY (1536, 9), FAX_ENTRY (1536, 9), FAX_ENTRY (1600, 9),
+    FAX_ENTRY (1600, 9), FAX_ENTRY (1600, 9), FAX_ENTRY (1600, 9),
+    FAX_ENTRY (1600, 9), FAX_ENTRY (1600, 9), FAX_ENTRY (1600, 9),
+    FAX_ENTRY (1600, 9), FAX_ENTRY (1728, 9), FAX_ENTRY (1728, 9),
+    FAX_ENTRY (1728, 9), FAX_ENTRY (1728, 9), FAX_ENTRY (1728, 9),
+    FAX_ENTRY (1728, 9), FAX_ENTRY (1728, 9), FAX_ENTRY (1728, 9),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (18, 7),
+    FAX_ENTRY (18, 7), FAX_ENTRY (18, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (24, 7), FAX_ENTRY (24, 7),
+    FAX_ENTRY (24, 7), FAX_ENTRY (49, 8), FAX_ENTRY (49, 8),
+    FAX_ENTRY (49, 8), FAX_ENTRY (49, 8), FAX_ENTRY (49, 8),
+    FAX_ENTRY (49, 8), FAX_ENTRY (49, 8), FAX_ENTRY (49, 8),
+    FAX_ENTRY (49, 8), FAX_ENTRY (49, 8), FAX_ENTRY (49, 8),
+    FAX_ENTRY (49, 8), FAX_ENTRY (49, 8), FAX_ENTRY (49, 8),
+    FAX_ENTRY (49, 8), FAX_ENTRY (49, 8), FAX_ENTRY (50, 8),
+    FAX_ENTRY (50, 8), FAX_ENTRY (50, 8), FAX_ENTRY (50, 8),
+    FAX_ENTRY (50, 8), FAX_ENTRY (50, 8), FAX_ENTRY (50, 8),
+    FAX_ENTRY (50, 8), FAX_ENTRY (50, 8), FAX_ENTRY (50, 8),
+    FAX_ENTRY (50, 8), FAX_ENTRY (50, 8), FAX_ENTRY (50, 8),
+    FAX_ENTRY (50, 8), FAX_ENTRY (50, 8), FAX_ENTRY (50, 8),
+    FAX_ENTRY (51, 8), FAX_ENTRY (51, 8), FAX_ENTRY (51, 8),
+    FAX_ENTRY (51, 8), FAX_ENTRY (51, 8), FAX_ENTRY (51, 8),
+    FAX_ENTRY (51, 8), FAX_ENTRY (51, 8), FAX_ENTRY (51, 8),
+    FAX_ENTRY (51, 8), FAX_ENTRY (51, 8), FAX_ENTRY (51, 8),
+    FAX_ENTRY (51, 8), FAX_ENTRY (51, 8), FAX_ENTRY (51, 8),
+    FAX_ENTRY (51, 8), FAX_ENTRY (52, 8), FAX_ENTRY (52, 8),
+    FAX_ENTRY (52, 8), FAX_ENTRY (52, 8), FAX_ENTRY (52, 8),
+    FAX_ENTRY (52, 8), FAX_ENTRY (52, 8), FAX_ENTRY (52, 8),
+    FAX_ENTRY (52, 8), FAX_ENTRY (52, 8), FAX_ENTRY (52, 8),
+    FAX_ENTRY (52, 8), FAX_ENTRY (52, 8), FAX_ENTRY (52, 8),
+    FAX_ENTRY (52, 8), FAX_ENTRY (52, 8), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (25, 7), FAX_ENTRY (25, 7),
+    FAX_ENTRY (25, 7), FAX_ENTRY (55, 8), FAX_ENTRY (55, 8),
+    FAX_ENTRY (55, 8), FAX_ENTRY (55, 8), FAX_ENTRY (55, 8),
+    FAX_ENTRY (55, 8), FAX_ENTRY (55, 8), FAX_ENTRY (55, 8),
+    FAX_ENTRY (55, 8), FAX_ENTRY (55, 8), FAX_ENTRY (55, 8),
+    FAX_ENTRY (55, 8), FAX_ENTRY (55, 8), FAX_ENTRY (55, 8),
+    FAX_ENTRY (55, 8), FAX_ENTRY (55, 8), FAX_ENTRY (56, 8),
+    FAX_ENTRY (56, 8), FAX_ENTRY (56, 8), FAX_ENTRY (56, 8),
+    FAX_ENTRY (56, 8), FAX_ENTRY (56, 8), FAX_ENTRY (56, 8),
+    FAX_ENTRY (56, 8), FAX_ENTRY (56, 8), FAX_ENTRY (56, 8),
+    FAX_ENTRY (56, 8), FAX_ENTRY (56, 8), FAX_ENTRY (56, 8),
+    FAX_ENTRY (56, 8), FAX_ENTRY (56, 8), FAX_ENTRY (56, 8),
+    FAX_ENTRY (57, 8), FAX_ENTRY (57, 8), FAX_ENTRY (57, 8),
+    FAX_ENTRY (57, 8), FAX_ENTRY (57, 8), FAX_ENTRY (57, 8),
+    FAX_ENTRY (57, 8), FAX_ENTRY (57, 8), FAX_ENTRY (57, 8),
+    FAX_ENTRY (57, 8), FAX_ENTRY (57, 8), FAX_ENTRY (57, 8),
+    FAX_ENTRY (57, 8), FAX_ENTRY (57, 8), FAX_ENTRY (57, 8),
+    FAX_ENTRY (57, 8), FAX_ENTRY (58, 8), FAX_ENTRY (58, 8),
+    FAX_ENTRY (58, 8), FAX_ENTRY (58, 8), FAX_ENTRY (58, 8),
+    FAX_ENTRY (58, 8), FAX_ENTRY (58, 8), FAX_ENTRY (58, 8),
+    FAX_ENTRY (58, 8), FAX_ENTRY (58, 8), FAX_ENTRY (58, 8),
+    FAX_ENTRY (58, 8), FAX_ENTRY (58, 8), FAX_ENTRY (58, 8),
+    FAX_ENTRY (58, 8), FAX_ENTRY (58, 8), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (192, 6), FAX_ENTRY (192, 6), FAX_ENTRY (192, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6), FAX_ENTRY (1664, 6),
+    FAX_ENTRY (1664, 6), FAX_ENTRY (448, 8), FAX_ENTRY (448, 8),
+    FAX_ENTRY (448, 8), FAX_ENTRY (448, 8), FAX_ENTRY (448, 8),
+    FAX_ENTRY (448, 8), FAX_ENTRY (448, 8), FAX_ENTRY (448, 8),
+    FAX_ENTRY (448, 8), FAX_ENTRY (448, 8), FAX_ENTRY (448, 8),
+    FAX_ENTRY (448, 8), FAX_ENTRY (448, 8), FAX_ENTRY (448, 8),
+    FAX_ENTRY (448, 8), FAX_ENTRY (448, 8), FAX_ENTRY (512, 8),
+    FAX_ENTRY (512, 8), FAX_ENTRY (512, 8), FAX_ENTRY (512, 8),
+    FAX_ENTRY (512, 8), FAX_ENTRY (512, 8), FAX_ENTRY (512, 8),
+    FAX_ENTRY (512, 8), FAX_ENTRY (512, 8), FAX_ENTRY (512, 8),
+    FAX_ENTRY (512, 8), FAX_ENTRY (512, 8), FAX_ENTRY (512, 8),
+    FAX_ENTRY (512, 8), FAX_ENTRY (512, 8), FAX_ENTRY (512, 8),
+    FAX_ENTRY (704, 9), FAX_ENTRY (704, 9), FAX_ENTRY (704, 9),
+    FAX_ENTRY (704, 9), FAX_ENTRY (704, 9), FAX_ENTRY (704, 9),
+    FAX_ENTRY (704, 9), FAX_ENTRY (704, 9), FAX_ENTRY (768, 9),
+    FAX_ENTRY (768, 9), FAX_ENTRY (768, 9), FAX_ENTRY (768, 9),
+    FAX_ENTRY (768, 9), FAX_ENTRY (768, 9), FAX_ENTRY (768, 9),
+    FAX_ENTRY (768, 9), FAX_ENTRY (640, 8), FAX_ENTRY (640, 8),
+    FAX_ENTRY (640, 8), FAX_ENTRY (640, 8), FAX_ENTRY (640, 8),
+    FAX_ENTRY (640, 8), FAX_ENTRY (640, 8), FAX_ENTRY (640, 8),
+    FAX_ENTRY (640, 8), FAX_ENTRY (640, 8), FAX_ENTRY (640, 8),
+    FAX_ENTRY (640, 8), FAX_ENTRY (640, 8), FAX_ENTRY (640, 8),
+    FAX_ENTRY (640, 8), FAX_ENTRY (640, 8), FAX_ENTRY (576, 8),
+    FAX_ENTRY (576, 8), FAX_ENTRY (576, 8), FAX_ENTRY (576, 8),
+    FAX_ENTRY (576, 8), FAX_ENTRY (576, 8), FAX_ENTRY (576, 8),
+    FAX_ENTRY (576, 8), FAX_ENTRY (576, 8), FAX_ENTRY (576, 8),
+    FAX_ENTRY (576, 8), FAX_ENTRY (576, 8), FAX_ENTRY (576, 8),
+    FAX_ENTRY (576, 8), FAX_ENTRY (576, 8), FAX_ENTRY (576, 8),
+    FAX_ENTRY (832, 9), FAX_ENTRY (832, 9), FAX_ENTRY (832, 9),
+    FAX_ENTRY (832, 9), FAX_ENTRY (832, 9), FAX_ENTRY (832, 9),
+    FAX_ENTRY (832, 9), FAX_ENTRY (832, 9), FAX_ENTRY (896, 9),
+    FAX_ENTRY (896, 9), FAX_ENTRY (896, 9), FAX_ENTRY (896, 9),
+    FAX_ENTRY (896, 9), FAX_ENTRY (896, 9), FAX_ENTRY (896, 9),
+    FAX_ENTRY (896, 9), FAX_ENTRY (960, 9), FAX_ENTRY (960, 9),
+    FAX_ENTRY (960, 9), FAX_ENTRY (960, 9), FAX_ENTRY (960, 9),
+    FAX_ENTRY (960, 9), FAX_ENTRY (960, 9), FAX_ENTRY (960, 9),
+    FAX_ENTRY (1024, 9), FAX_ENTRY (1024, 9), FAX_ENTRY (1024, 9),
+    FAX_ENTRY (1024, 9), FAX_ENTRY (1024, 9), FAX_ENTRY (1024, 9),
+    FAX_ENTRY (1024, 9), FAX_ENTRY (1024, 9), FAX_ENTRY (1088, 9),
+    FAX_ENTRY (1088, 9), FAX_ENTRY (1088, 9), FAX_ENTRY (1088, 9),
+    FAX_ENTRY (1088, 9), FAX_ENTRY (1088, 9), FAX_ENTRY (1088, 9),
+    FAX_ENTRY (1088, 9), FAX_ENTRY (1152, 9), FAX_ENTRY (1152, 9),
+    FAX_ENTRY (1152, 9), FAX_ENTRY (1152, 9), FAX_ENTRY (1152, 9),
+    FAX_ENTRY (1152, 9), FAX_ENTRY (1152, 9), FAX_ENTRY (1152, 9),
+    FAX_ENTRY (1216, 9), FAX_ENTRY (1216, 9), FAX_ENTRY (1216, 9),
+    FAX_ENTRY (1216, 9), FAX_ENTRY (1216, 9), FAX_ENTRY (1216, 9),
+    FAX_ENTRY (1216, 9), FAX_ENTRY (1216, 9), FAX_ENTRY (1280, 9),
+    FAX_ENTRY (1280, 9), FAX_ENTRY (1280, 9), FAX_ENTRY (1280, 9),
+    FAX_ENTRY (1280, 9), FAX_ENTRY (1280, 9), FAX_ENTRY (1280, 9),
+    FAX_ENTRY (1280, 9), FAX_ENTRY (1344, 9), FAX_ENTRY (1344, 9),
+    FAX_ENTRY (1344, 9), FAX_ENTRY (1344, 9), FAX_ENTRY (1344, 9),
+    FAX_ENTRY (1344, 9), FAX_ENTRY (1344, 9), FAX_ENTRY (1344, 9),
+    FAX_ENTRY (1408, 9), FAX_ENTRY (1408, 9), FAX_ENTRY (1408, 9),
+    FAX_ENTRY (1408, 9), FAX_ENTRY (1408, 9), FAX_ENTRY (1408, 9),
+    FAX_ENTRY (1408, 9), FAX_ENTRY (1408, 9), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (256, 7), FAX_ENTRY (256, 7),
+    FAX_ENTRY (256, 7), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (2, 4),
+    FAX_ENTRY (2, 4), FAX_ENTRY (2, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (3, 4), FAX_ENTRY (3, 4), FAX_ENTRY (3, 4),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (128, 5),
+    FAX_ENTRY (128, 5), FAX_ENTRY (128, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (8, 5), FAX_ENTRY (8, 5),
+    FAX_ENTRY (8, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (9, 5), FAX_ENTRY (9, 5), FAX_ENTRY (9, 5),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (16, 6), FAX_ENTRY (16, 6),
+    FAX_ENTRY (16, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (17, 6),
+    FAX_ENTRY (17, 6), FAX_ENTRY (17, 6), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (4, 4), FAX_ENTRY (4, 4), FAX_ENTRY (4, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (14, 6),
+    FAX_ENTRY (14, 6), FAX_ENTRY (14, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (15, 6), FAX_ENTRY (15, 6), FAX_ENTRY (15, 6),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (64, 5),
+    FAX_ENTRY (64, 5), FAX_ENTRY (64, 5), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4), FAX_ENTRY (7, 4), FAX_ENTRY (7, 4),
+    FAX_ENTRY (7, 4)
+  };
+
+static const pdf_u16_t fax_black_table[1 << FAX_BLACK_BITS] =
+  {
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, 0,
+    0, 0, FAX_ENTRY (1792, 11),
+    FAX_ENTRY (1792, 11), FAX_ENTRY (1792, 11), FAX_ENTRY (1792, 11),
+    FAX_ENTRY (1984, 12), FAX_ENTRY (1984, 12), FAX_ENTRY (2048, 12),
+    FAX_ENTRY (2048, 12), FAX_ENTRY (2112, 12), FAX_ENTRY (2112, 12),
+    FAX_ENTRY (2176, 12), FAX_ENTRY (2176, 12), FAX_ENTRY (2240, 12),
+    FAX_ENTRY (2240, 12), FAX_ENTRY (2304, 12), FAX_ENTRY (2304, 12),
+    FAX_ENTRY (1856, 11), FAX_ENTRY (1856, 11), FAX_ENTRY (1856, 11),
+    FAX_ENTRY (1856, 11), FAX_ENTRY (1920, 11), FAX_ENTRY (1920, 11),
+    FAX_ENTRY (1920, 11), FAX_ENTRY (1920, 11), FAX_ENTRY (2368, 12),
+    FAX_ENTRY (2368, 12), FAX_ENTRY (2432, 12), FAX_ENTRY (2432, 12),
+    FAX_ENTRY (2496, 12), FAX_ENTRY (2496, 12), FAX_ENTRY (2560, 12),
+    FAX_ENTRY (2560, 12), FAX_ENTRY (18, 10), FAX_ENTRY (18, 10),
+    FAX_ENTRY (18, 10), FAX_ENTRY (18, 10), FAX_ENTRY (18, 10),
+    FAX_ENTRY (18, 10), FAX_ENTRY (18, 10), FAX_ENTRY (18, 10),
+    FAX_ENTRY (52, 12), FAX_ENTRY (52, 12), FAX_ENTRY (640, 13),
+    FAX_ENTRY (704, 13), FAX_ENTRY (768, 13), FAX_ENTRY (832, 13),
+    FAX_ENTRY (55, 12), FAX_ENTRY (55, 12), FAX_ENTRY (56, 12),
+    FAX_ENTRY (56, 12), FAX_ENTRY (1280, 13), FAX_ENTRY (1344, 13),
+    FAX_ENTRY (1408, 13), FAX_ENTRY (1472, 13), FAX_ENTRY (59, 12),
+    FAX_ENTRY (59, 12), FAX_ENTRY (60, 12), FAX_ENTRY (60, 12),
+    FAX_ENTRY (1536, 13), FAX_ENTRY (1600, 13), FAX_ENTRY (24, 11),
+    FAX_ENTRY (24, 11), FAX_ENTRY (24, 11), FAX_ENTRY (24, 11),
+    FAX_ENTRY (25, 11), FAX_ENTRY (25, 11), FAX_ENTRY (25, 11),
+    FAX_ENTRY (25, 11), FAX_ENTRY (1664, 13), FAX_ENTRY (1728, 13),
+    FAX_ENTRY (320, 12), FAX_ENTRY (320, 12), FAX_ENTRY (384, 12),
+    FAX_ENTRY (384, 12), FAX_ENTRY (448, 12), FAX_ENTRY (448, 12),
+    FAX_ENTRY (512, 13), FAX_ENTRY (576, 13), FAX_ENTRY (53, 12),
+    FAX_ENTRY (53, 12), FAX_ENTRY (54, 12), FAX_ENTRY (54, 12),
+    FAX_ENTRY (896, 13), FAX_ENTRY (960, 13), FAX_ENTRY (1024, 13),
+    FAX_ENTRY (1088, 13), FAX_ENTRY (1152, 13), FAX_ENTRY (1216, 13),
+    FAX_ENTRY (64, 10), FAX_ENTRY (64, 10), FAX_ENTRY (64, 10),
+    FAX_ENTRY (64, 10), FAX_ENTRY (64, 10), FAX_ENTRY (64, 10),
+    FAX_ENTRY (64, 10), FAX_ENTRY (64, 10), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (13, 8), FAX_ENTRY (13, 8),
+    FAX_ENTRY (13, 8), FAX_ENTRY (23, 11), FAX_ENTRY (23, 11),
+    FAX_ENTRY (23, 11), FAX_ENTRY (23, 11), FAX_ENTRY (50, 12),
+    FAX_ENTRY (50, 12), FAX_ENTRY (51, 12), FAX_ENTRY (51, 12),
+    FAX_ENTRY (44, 12), FAX_ENTRY (44, 12), FAX_ENTRY (45, 12),
+    FAX_ENTRY (45, 12), FAX_ENTRY (46, 12), FAX_ENTRY (46, 12),
+    FAX_ENTRY (47, 12), FAX_ENTRY (47, 12), FAX_ENTRY (57, 12),
+    FAX_ENTRY (57, 12), FAX_ENTRY (58, 12), FAX_ENTRY (58, 12),
+    FAX_ENTRY (61, 12), FAX_ENTRY (61, 12), FAX_ENTRY (256, 12),
+    FAX_ENTRY (256, 12), FAX_ENTRY (16, 10), FAX_ENTRY (16, 10),
+    FAX_ENTRY (16, 10), FAX_ENTRY (16, 10), FAX_ENTRY (16, 10),
+    FAX_ENTRY (16, 10), FAX_ENTRY (16, 10), FAX_ENTRY (16, 10),
+    FAX_ENTRY (17, 10), FAX_ENTRY (17, 10), FAX_ENTRY (17, 10),
+    FAX_ENTRY (17, 10), FAX_ENTRY (17, 10), FAX_ENTRY (17, 10),
+    FAX_ENTRY (17, 10), FAX_ENTRY (17, 10), FAX_ENTRY (48, 12),
+    FAX_ENTRY (48, 12), FAX_ENTRY (49, 12), FAX_ENTRY (49, 12),
+    FAX_ENTRY (62, 12), FAX_ENTRY (62, 12), FAX_ENTRY (63, 12),
+    FAX_ENTRY (63, 12), FAX_ENTRY (30, 12), FAX_ENTRY (30, 12),
+    FAX_ENTRY (31, 12), FAX_ENTRY (31, 12), FAX_ENTRY (32, 12),
+    FAX_ENTRY (32, 12), FAX_ENTRY (33, 12), FAX_ENTRY (33, 12),
+    FAX_ENTRY (40, 12), FAX_ENTRY (40, 12), FAX_ENTRY (41, 12),
+    FAX_ENTRY (41, 12), FAX_ENTRY (22, 11), FAX_ENTRY (22, 11),
+    FAX_ENTRY (22, 11), FAX_ENTRY (22, 11), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (14, 8), FAX_ENTRY (14, 8),
+    FAX_ENTRY (14, 8), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (10, 7),
+    FAX_ENTRY (10, 7), FAX_ENTRY (10, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (11, 7), FAX_ENTRY (11, 7), FAX_ENTRY (11, 7),
+    FAX_ENTRY (15, 9), FAX_ENTRY (15, 9), FAX_ENTRY (15, 9),
+    FAX_ENTRY (15, 9), FAX_ENTRY (15, 9), FAX_ENTRY (15, 9),
+    FAX_ENTRY (15, 9), FAX_ENTRY (15, 9), FAX_ENTRY (15, 9),
+    FAX_ENTRY (15, 9), FAX_ENTRY (15, 9), FAX_ENTRY (15, 9),
+    FAX_ENTRY (15, 9), FAX_ENTRY (15, 9), FAX_ENTRY (15, 9),
+    FAX_ENTRY (15, 9), FAX_ENTRY (128, 12), FAX_ENTRY (128, 12),
+    FAX_ENTRY (192, 12), FAX_ENTRY (192, 12), FAX_ENTRY (26, 12),
+    FAX_ENTRY (26, 12), FAX_ENTRY (27, 12), FAX_ENTRY (27, 12),
+    FAX_ENTRY (28, 12), FAX_ENTRY (28, 12), FAX_ENTRY (29, 12),
+    FAX_ENTRY (29, 12), FAX_ENTRY (19, 11), FAX_ENTRY (19, 11),
+    FAX_ENTRY (19, 11), FAX_ENTRY (19, 11), FAX_ENTRY (20, 11),
+    FAX_ENTRY (20, 11), FAX_ENTRY (20, 11), FAX_ENTRY (20, 11),
+    FAX_ENTRY (34, 12), FAX_ENTRY (34, 12), FAX_ENTRY (35, 12),
+    FAX_ENTRY (35, 12), FAX_ENTRY (36, 12), FAX_ENTRY (36, 12),
+    FAX_ENTRY (37, 12), FAX_ENTRY (37, 12), FAX_ENTRY (38, 12),
+    FAX_ENTRY (38, 12), FAX_ENTRY (39, 12), FAX_ENTRY (39, 12),
+    FAX_ENTRY (21, 11), FAX_ENTRY (21, 11), FAX_ENTRY (21, 11),
+    FAX_ENTRY (21, 11), FAX_ENTRY (42, 12), FAX_ENTRY (42, 12),
+    FAX_ENTRY (43, 12), FAX_ENTRY (43, 12), FAX_ENTRY (0, 10),
+    FAX_ENTRY (0, 10), FAX_ENTRY (0, 10), FAX_ENTRY (0, 10),
+    FAX_ENTRY (0, 10), FAX_ENTRY (0, 10), FAX_ENTRY (0, 10),
+    FAX_ENTRY (0, 10), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (12, 7),
+    FAX_ENTRY (12, 7), FAX_ENTRY (12, 7), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (9, 6), FAX_ENTRY (9, 6),
+    FAX_ENTRY (9, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (8, 6), FAX_ENTRY (8, 6), FAX_ENTRY (8, 6),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (7, 5), FAX_ENTRY (7, 5),
+    FAX_ENTRY (7, 5), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (6, 4), FAX_ENTRY (6, 4), FAX_ENTRY (6, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (5, 4),
+    FAX_ENTRY (5, 4), FAX_ENTRY (5, 4), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (1, 3), FAX_ENTRY (1, 3), FAX_ENTRY (1, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (4, 3), FAX_ENTRY (4, 3),
+    FAX_ENTRY (4, 3), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (3, 2), FAX_ENTRY (3, 2), FAX_ENTRY (3, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2), FAX_ENTRY (2, 2),
+    FAX_ENTRY (2, 2), FAX_ENTRY (2, 2)
+  };
+
+static const pdf_u16_t fax_mode_table[1 << FAX_MODE_BITS] =
+  {
+    0, 0,
+    FAX_ENTRY (FAX_MODE_VL3, 7), FAX_ENTRY (FAX_MODE_VR3, 7),
+    FAX_ENTRY (FAX_MODE_VL2, 6), FAX_ENTRY (FAX_MODE_VL2, 6),
+    FAX_ENTRY (FAX_MODE_VR2, 6), FAX_ENTRY (FAX_MODE_VR2, 6),
+    FAX_ENTRY (FAX_MODE_PASS, 4), FAX_ENTRY (FAX_MODE_PASS, 4),
+    FAX_ENTRY (FAX_MODE_PASS, 4), FAX_ENTRY (FAX_MODE_PASS, 4),
+    FAX_ENTRY (FAX_MODE_PASS, 4), FAX_ENTRY (FAX_MODE_PASS, 4),
+    FAX_ENTRY (FAX_MODE_PASS, 4), FAX_ENTRY (FAX_MODE_PASS, 4),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_HORIZONTAL, 3), FAX_ENTRY (FAX_MODE_HORIZONTAL, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VL1, 3), FAX_ENTRY (FAX_MODE_VL1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_VR1, 3), FAX_ENTRY (FAX_MODE_VR1, 3),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1),
+    FAX_ENTRY (FAX_MODE_V0, 1), FAX_ENTRY (FAX_MODE_V0, 1)
+  };
+
+#endif /* !PDF_STM_F_FAX_TABLES_H */
+
+/* End of pdf-stm-f-fax-tables.h */
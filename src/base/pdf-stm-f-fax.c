@@ -0,0 +1,780 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-f-fax.c
+ *       Date:         Sat Oct 17 19:02:44 2026
+ *
+ *       GNU PDF Library - CCITT Fax decoder
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+
+#include <pdf-alloc.h>
+#include <pdf-hash-helper.h>
+#include <pdf-stm-f-fax.h>
+
+/* Define CCITT Fax decoder */
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_faxdec_get,
+                             stm_f_faxdec_init,
+                             stm_f_faxdec_apply,
+                             stm_f_faxdec_deinit,
+                             stm_f_faxdec_reset);
+
+#define FAX_PARAM_K                  "K"
+#define FAX_PARAM_END_OF_LINE        "EndOfLine"
+#define FAX_PARAM_ENCODED_BYTE_ALIGN "EncodedByteAlign"
+#define FAX_PARAM_COLUMNS            "Columns"
+#define FAX_PARAM_ROWS               "Rows"
+#define FAX_PARAM_END_OF_BLOCK       "EndOfBlock"
+#define FAX_PARAM_BLACK_IS_1         "BlackIs1"
+#define FAX_PARAM_DAMAGED_ROWS       "DamagedRowsBeforeError"
+
+/* Default and largest number of pixels in a row */
+#define FAX_DEFAULT_COLUMNS 1728
+#define FAX_MAX_COLUMNS     (1 << 20)
+
+/* Bits looked up at once for white runs, black runs and 2-D modes: the
+ * longest code of each kind */
+#define FAX_WHITE_BITS 12
+#define FAX_BLACK_BITS 13
+#define FAX_MODE_BITS  7
+
+/* End of line code, 000000000001 */
+#define FAX_EOL 0x001
+#define FAX_EOL_BITS 12
+
+/* Zero bytes kept after the encoded data, so that the bits of a code
+ * can be looked up without checking for the end of the data */
+#define FAX_SLACK 8
+
+/* Bits at the end of the encoded data where a row which can't be
+ * decoded may just be missing its last bytes */
+#define FAX_LOOKAHEAD 32
+
+/* 2-D coding modes.  Vertical modes are stored as 6 plus the distance
+ * between a1 and b1. */
+enum fax_mode_e
+{
+  FAX_MODE_INVALID = 0,
+  FAX_MODE_PASS,
+  FAX_MODE_HORIZONTAL,
+  FAX_MODE_VL3,
+  FAX_MODE_VL2,
+  FAX_MODE_VL1,
+  FAX_MODE_V0,
+  FAX_MODE_VR1,
+  FAX_MODE_VR2,
+  FAX_MODE_VR3
+};
+
+/* Lookup table entries: the run length or mode, and the size of its
+ * code; 0 for invalid codes */
+#define FAX_ENTRY(value, len) ((pdf_u16_t) (((value) << 4) | (len)))
+#define FAX_ENTRY_VALUE(e)    ((e) >> 4)
+#define FAX_ENTRY_LEN(e)      ((e) & 0xf)
+
+/* Lookup tables of white runs, black runs and 2-D modes.  Regenerate
+ * them with build-aux/pdf-stm-generate-fax-tables when the codes or the
+ * numbers of looked up bits change. */
+#include <pdf-stm-f-fax-tables.h>
+
+/* Result of the decoding of a row */
+enum fax_row_e
+{
+  FAX_ROW_OK,
+  FAX_ROW_DAMAGED,  /* Bad row skipped up to the next end of line */
+  FAX_ROW_BAD,
+  FAX_ROW_STARVED,  /* More encoded data needed */
+  FAX_ROW_END
+};
+
+/* Internal state */
+struct pdf_stm_f_faxdec_s
+{
+  /* Parameters */
+  pdf_i32_t k;
+  pdf_bool_t end_of_line;
+  pdf_bool_t byte_align;
+  pdf_i32_t columns;
+  pdf_size_t rows;
+  pdf_bool_t end_of_block;
+  pdf_bool_t black_is_1;
+  pdf_size_t damaged_max;
+
+  /* Encoded data gathered from the input, followed by FAX_SLACK zero
+   * bytes, and the bit where the next row starts */
+  pdf_uchar_t *src;
+  pdf_size_t src_size;
+  pdf_size_t src_len;
+  pdf_size_t bit_pos;
+  /* Encoded bytes to gather before trying again to decode a row which
+   * didn't fit in the data */
+  pdf_size_t src_wanted;
+
+  /* Changing elements of the reference line, followed by three
+   * sentinels at the end of the row, and of the line being decoded */
+  pdf_i32_t *ref;
+  pdf_size_t n_ref;
+  pdf_i32_t *cur;
+  pdf_size_t n_cur;
+
+  /* Decoded row which didn't fit in the output buffer */
+  pdf_uchar_t *row;
+  pdf_size_t row_size;
+  pdf_size_t row_pos;
+
+  pdf_size_t n_rows;
+  pdf_size_t n_damaged;
+  pdf_bool_t damaged_p;
+  pdf_bool_t eod_p;
+};
+
+/* Reader of the encoded bits */
+struct fax_reader_s
+{
+  const pdf_uchar_t *data;
+  pdf_size_t pos;
+  pdf_size_t end;
+};
+
+static enum fax_row_e fax_decode_row (struct pdf_stm_f_faxdec_s *st,
+                                      pdf_bool_t                 finish,
+                                      pdf_bool_t                 eol_first);
+
+static void fax_render_row (const struct pdf_stm_f_faxdec_s *st,
+                            const pdf_i32_t                 *line,
+                            pdf_size_t                       n,
+                            pdf_uchar_t                     *row);
+
+static pdf_bool_t
+stm_f_faxdec_init (const pdf_hash_t  *params,
+                   void             **state,
+                   pdf_error_t      **error)
+{
+  struct pdf_stm_f_faxdec_s *st;
+  pdf_size_t columns = FAX_DEFAULT_COLUMNS;
+
+  if (params && pdf_hash_key_p (params, FAX_PARAM_COLUMNS))
+    columns = pdf_hash_get_size (params, FAX_PARAM_COLUMNS);
+  if (columns < 1 || columns > FAX_MAX_COLUMNS)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EBADDATA,
+                     "cannot initialize CCITT Fax decoder: "
+                     "bad parameter value ('"FAX_PARAM_COLUMNS"': %lu)",
+                     (unsigned long) columns);
+      return PDF_FALSE;
+    }
+
+  st = pdf_alloc (sizeof (struct pdf_stm_f_faxdec_s));
+  if (!st)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create CCITT Fax decoder internal state: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) sizeof (struct pdf_stm_f_faxdec_s));
+      return PDF_FALSE;
+    }
+
+  /* Parameters, with their default values */
+  st->k = 0;
+  st->end_of_line = PDF_FALSE;
+  st->byte_align = PDF_FALSE;
+  st->columns = columns;
+  st->rows = 0;
+  st->end_of_block = PDF_TRUE;
+  st->black_is_1 = PDF_FALSE;
+  st->damaged_max = 0;
+  if (params)
+    {
+      if (pdf_hash_key_p (params, FAX_PARAM_K))
+        st->k = pdf_hash_get_i32 (params, FAX_PARAM_K);
+      if (pdf_hash_key_p (params, FAX_PARAM_END_OF_LINE))
+        st->end_of_line = pdf_hash_get_bool (params, FAX_PARAM_END_OF_LINE);
+      if (pdf_hash_key_p (params, FAX_PARAM_ENCODED_BYTE_ALIGN))
+        st->byte_align = pdf_hash_get_bool (params,
+                                            FAX_PARAM_ENCODED_BYTE_ALIGN);
+      if (pdf_hash_key_p (params, FAX_PARAM_ROWS))
+        st->rows = pdf_hash_get_size (params, FAX_PARAM_ROWS);
+      if (pdf_hash_key_p (params, FAX_PARAM_END_OF_BLOCK))
+        st->end_of_block = pdf_hash_get_bool (params, FAX_PARAM_END_OF_BLOCK);
+      if (pdf_hash_key_p (params, FAX_PARAM_BLACK_IS_1))
+        st->black_is_1 = pdf_hash_get_bool (params, FAX_PARAM_BLACK_IS_1);
+      if (pdf_hash_key_p (params, FAX_PARAM_DAMAGED_ROWS))
+        st->damaged_max = pdf_hash_get_size (params, FAX_PARAM_DAMAGED_ROWS);
+    }
+
+  /* A line has at most one changing element per pixel and one at its
+   * end, and the reference line has three more sentinels */
+  st->row_size = (columns + 7) / 8;
+  st->src_size = 4096;
+  st->src = pdf_alloc (st->src_size);
+  st->ref = pdf_alloc ((columns + 4) * sizeof (pdf_i32_t));
+  st->cur = pdf_alloc ((columns + 4) * sizeof (pdf_i32_t));
+  st->row = pdf_alloc (st->row_size);
+  if (!st->src || !st->ref || !st->cur || !st->row)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create CCITT Fax decoder internal state: "
+                     "couldn't allocate the row buffers");
+      stm_f_faxdec_deinit (st);
+      return PDF_FALSE;
+    }
+
+  stm_f_faxdec_reset (st, NULL);
+
+  *state = st;
+  return PDF_TRUE;
+}
+
+static void
+stm_f_faxdec_deinit (void *state)
+{
+  struct pdf_stm_f_faxdec_s *st = state;
+
+  pdf_dealloc (st->src);
+  pdf_dealloc (st->ref);
+  pdf_dealloc (st->cur);
+  pdf_dealloc (st->row);
+  pdf_dealloc (st);
+}
+
+static pdf_bool_t
+stm_f_faxdec_reset (void         *state,
+                    pdf_error_t **error)
+{
+  struct pdf_stm_f_faxdec_s *st = state;
+
+  st->src_len = 0;
+  st->bit_pos = 0;
+  st->src_wanted = 0;
+  memset (st->src, 0, FAX_SLACK);
+
+  /* The reference line of the first row is all white */
+  st->n_ref = 0;
+  st->ref[0] = st->ref[1] = st->ref[2] = st->columns;
+  st->n_cur = 0;
+
+  st->row_pos = st->row_size;
+  st->n_rows = 0;
+  st->n_damaged = 0;
+  st->damaged_p = PDF_FALSE;
+  st->eod_p = PDF_FALSE;
+
+  return PDF_TRUE;
+}
+
+/* Gather the input, dropping the encoded data already decoded */
+static pdf_bool_t
+fax_gather_input (struct pdf_stm_f_faxdec_s  *st,
+                  pdf_buffer_t               *in,
+                  pdf_error_t               **error)
+{
+  pdf_size_t avail = in->wp - in->rp;
+  pdf_size_t done = st->bit_pos >> 3;
+  pdf_size_t new_size;
+  pdf_uchar_t *new_src;
+
+  if (avail == 0)
+    return PDF_TRUE;
+
+  if (done > 0)
+    {
+      memmove (st->src, st->src + done, st->src_len - done);
+      st->src_len -= done;
+      st->bit_pos -= done * 8;
+      if (st->src_wanted > 0)
+        st->src_wanted -= PDF_MIN (st->src_wanted, done);
+    }
+
+  if (st->src_len + avail + FAX_SLACK > st->src_size)
+    {
+      new_size = PDF_MAX (2 * st->src_size, st->src_len + avail + FAX_SLACK);
+      new_src = pdf_realloc (st->src, new_size);
+      if (!new_src)
+        {
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_ENOMEM,
+                         "cannot decode CCITT Fax data: "
+                         "couldn't allocate %lu bytes",
+                         (unsigned long) new_size);
+          return PDF_FALSE;
+        }
+      st->src = new_src;
+      st->src_size = new_size;
+    }
+
+  memcpy (st->src + st->src_len, in->data + in->rp, avail);
+  st->src_len += avail;
+  memset (st->src + st->src_len, 0, FAX_SLACK);
+  in->rp = in->wp;
+  return PDF_TRUE;
+}
+
+static enum pdf_stm_filter_apply_status_e
+stm_f_faxdec_apply (void          *state,
+                    pdf_buffer_t  *in,
+                    pdf_buffer_t  *out,
+                    pdf_bool_t     finish,
+                    pdf_error_t  **error)
+{
+  struct pdf_stm_f_faxdec_s *st = state;
+  enum fax_row_e status;
+  pdf_uchar_t *row;
+  pdf_size_t n;
+
+  if (!fax_gather_input (st, in, error))
+    return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+
+  for (;;)
+    {
+      /* Write out what is left of the last row */
+      if (st->row_pos < st->row_size)
+        {
+          n = PDF_MIN (st->row_size - st->row_pos, out->size - out->wp);
+          memcpy (out->data + out->wp, st->row + st->row_pos, n);
+          out->wp += n;
+          st->row_pos += n;
+          if (st->row_pos < st->row_size)
+            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+        }
+
+      if (st->eod_p
+          || (!st->end_of_block && st->rows > 0 && st->n_rows == st->rows))
+        return PDF_STM_FILTER_APPLY_STATUS_EOF;
+
+      if (!finish && st->src_len - (st->bit_pos >> 3) < st->src_wanted)
+        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+
+      status = fax_decode_row (st, finish, PDF_TRUE);
+
+      /* Without EndOfLine, the fill bits before an aligned row and
+       * its first code may look like an end of line: try again without
+       * looking for it */
+      if (status == FAX_ROW_BAD
+          && st->byte_align
+          && st->k >= 0
+          && !st->end_of_line)
+        status = fax_decode_row (st, finish, PDF_FALSE);
+
+      switch (status)
+        {
+        case FAX_ROW_OK:
+          {
+            pdf_i32_t *tmp;
+
+            /* The decoded line is the reference of the next one */
+            tmp = st->ref;
+            st->ref = st->cur;
+            st->cur = tmp;
+            st->n_ref = st->n_cur;
+            st->damaged_p = PDF_FALSE;
+            break;
+          }
+        case FAX_ROW_DAMAGED:
+          {
+            /* Repeat the previous row, or a white one if it was
+             * damaged too */
+            if (st->damaged_p)
+              st->n_ref = 0;
+            st->damaged_p = PDF_TRUE;
+            st->n_damaged++;
+            break;
+          }
+        case FAX_ROW_BAD:
+          {
+            pdf_set_error (error,
+                           PDF_EDOMAIN_BASE_STM,
+                           PDF_EBADDATA,
+                           "cannot decode CCITT Fax data: "
+                           "bad code in row %lu",
+                           (unsigned long) st->n_rows + 1);
+            return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+          }
+        case FAX_ROW_STARVED:
+          {
+            /* Try again with twice as much data */
+            st->src_wanted = 2 * (st->src_len - (st->bit_pos >> 3)) + 1;
+            return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+          }
+        case FAX_ROW_END:
+          {
+            st->eod_p = PDF_TRUE;
+            continue;
+          }
+        }
+
+      st->src_wanted = 0;
+      st->ref[st->n_ref] = st->columns;
+      st->ref[st->n_ref + 1] = st->columns;
+      st->ref[st->n_ref + 2] = st->columns;
+      st->n_rows++;
+
+      /* Render the row straight into the output buffer if it fits */
+      if (out->size - out->wp >= st->row_size)
+        {
+          row = out->data + out->wp;
+          out->wp += st->row_size;
+        }
+      else
+        {
+          row = st->row;
+          st->row_pos = 0;
+        }
+      fax_render_row (st, st->ref, st->n_ref, row);
+    }
+}
+
+/* Bit reading */
+
+/* Next N bits, N up to 25 */
+static inline pdf_u32_t
+fax_peek (const struct fax_reader_s *r,
+          int                        n)
+{
+  const pdf_uchar_t *p = r->data + (r->pos >> 3);
+  pdf_u32_t w;
+
+  w = ((pdf_u32_t) p[0] << 24 | (pdf_u32_t) p[1] << 16
+       | (pdf_u32_t) p[2] << 8 | (pdf_u32_t) p[3]);
+  return (w << (r->pos & 7)) >> (32 - n);
+}
+
+/* Length of a run of white or black pixels: any make-up codes and the
+ * terminating code, or -1 if some code is invalid */
+static pdf_i32_t
+fax_decode_run (struct fax_reader_s *r,
+                const pdf_u16_t     *table,
+                int                  bits)
+{
+  pdf_i32_t run = 0;
+  pdf_u16_t e;
+
+  for (;;)
+    {
+      e = table[fax_peek (r, bits)];
+      if (FAX_ENTRY_LEN (e) == 0 || run > FAX_MAX_COLUMNS)
+        return -1;
+      r->pos += FAX_ENTRY_LEN (e);
+      run += FAX_ENTRY_VALUE (e);
+      if (FAX_ENTRY_VALUE (e) < 64)
+        return run;
+    }
+}
+
+/* Add a changing element to a line.  A changing element at the same
+ * place as the previous one cancels it, so that the colour of the
+ * pixels after the N changing elements of a line is always N % 2. */
+static inline void
+fax_add_change (pdf_i32_t  *line,
+                pdf_size_t *n,
+                pdf_i32_t   a)
+{
+  if (*n > 0 && line[*n - 1] == a)
+    (*n)--;
+  else
+    line[(*n)++] = a;
+}
+
+/* One-dimensional (Modified Huffman) coding: alternate white and black
+ * runs */
+static pdf_bool_t
+fax_decode_1d (struct pdf_stm_f_faxdec_s *st,
+               struct fax_reader_s       *r)
+{
+  pdf_i32_t *cur = st->cur;
+  pdf_size_t n = 0;
+  pdf_i32_t a0 = 0;
+  pdf_i32_t run;
+  int color = 0;
+
+  while (a0 < st->columns)
+    {
+      if (color)
+        run = fax_decode_run (r, fax_black_table, FAX_BLACK_BITS);
+      else
+        run = fax_decode_run (r, fax_white_table, FAX_WHITE_BITS);
+      if (run < 0 || r->pos > r->end)
+        return PDF_FALSE;
+
+      a0 = PDF_MIN (a0 + run, st->columns);
+      fax_add_change (cur, &n, a0);
+      color ^= 1;
+    }
+
+  st->n_cur = n;
+  return PDF_TRUE;
+}
+
+/* Two-dimensional coding: changing elements are coded relative to the
+ * ones of the reference line, b1 being the first one right of a0 of the
+ * colour opposite to a0's, and b2 the next one */
+static pdf_bool_t
+fax_decode_2d (struct pdf_stm_f_faxdec_s *st,
+               struct fax_reader_s       *r)
+{
+  const pdf_i32_t *ref = st->ref;
+  pdf_i32_t *cur = st->cur;
+  pdf_size_t n = 0;
+  pdf_size_t bi = 0;
+  pdf_size_t b1i;
+  pdf_i32_t a0 = -1;
+  pdf_i32_t a1;
+  pdf_i32_t a2;
+  pdf_i32_t run1;
+  pdf_i32_t run2;
+  int color = 0;
+  pdf_u16_t e;
+
+  while (a0 < st->columns)
+    {
+      if (r->pos > r->end)
+        return PDF_FALSE;
+
+      /* Changing elements of the reference line alternate colours, the
+       * even ones starting black runs */
+      while (ref[bi] <= a0)
+        bi++;
+      b1i = bi + ((bi ^ color) & 1);
+
+      e = fax_mode_table[fax_peek (r, FAX_MODE_BITS)];
+      r->pos += FAX_ENTRY_LEN (e);
+      switch (FAX_ENTRY_VALUE (e))
+        {
+        case FAX_MODE_INVALID:
+          {
+            return PDF_FALSE;
+          }
+        case FAX_MODE_PASS:
+          {
+            a0 = ref[b1i + 1];
+            break;
+          }
+        case FAX_MODE_HORIZONTAL:
+          {
+            if (color)
+              {
+                run1 = fax_decode_run (r, fax_black_table, FAX_BLACK_BITS);
+                run2 = fax_decode_run (r, fax_white_table, FAX_WHITE_BITS);
+              }
+            else
+              {
+                run1 = fax_decode_run (r, fax_white_table, FAX_WHITE_BITS);
+                run2 = fax_decode_run (r, fax_black_table, FAX_BLACK_BITS);
+              }
+            if (run1 < 0 || run2 < 0)
+              return PDF_FALSE;
+
+            a1 = PDF_MIN (PDF_MAX (a0, 0) + run1, st->columns);
+            a2 = PDF_MIN (a1 + run2, st->columns);
+            fax_add_change (cur, &n, a1);
+            fax_add_change (cur, &n, a2);
+            a0 = a2;
+            break;
+          }
+        default:
+          {
+            /* Vertical modes */
+            a1 = ref[b1i] + (pdf_i32_t) FAX_ENTRY_VALUE (e) - FAX_MODE_V0;
+            if (a1 < a0 || a1 < 0)
+              return PDF_FALSE;
+
+            a1 = PDF_MIN (a1, st->columns);
+            fax_add_change (cur, &n, a1);
+            a0 = a1;
+            color ^= 1;
+            break;
+          }
+        }
+    }
+
+  st->n_cur = n;
+  return PDF_TRUE;
+}
+
+/* Skip the fill bits before an end of line: no code starts with twelve
+ * zero bits */
+static inline void
+fax_skip_fill (struct fax_reader_s *r)
+{
+  while (r->pos < r->end && fax_peek (r, FAX_EOL_BITS) == 0)
+    r->pos++;
+}
+
+static enum fax_row_e
+fax_decode_row (struct pdf_stm_f_faxdec_s *st,
+                pdf_bool_t                 finish,
+                pdf_bool_t                 eol_first)
+{
+  struct fax_reader_s r;
+  pdf_size_t start;
+  pdf_size_t end;
+  pdf_bool_t two_d_p;
+  pdf_bool_t ok;
+
+  r.data = st->src;
+  r.pos = st->bit_pos;
+  r.end = st->src_len * 8;
+
+  /* Rows start on a byte boundary.  When they are preceded by an end
+   * of line, which is optional in Group 3 coding, it's the end of line
+   * which is aligned by its fill bits instead, so look for one ending
+   * on a byte boundary first if asked to. */
+  if (st->byte_align)
+    {
+      start = r.pos;
+      if (st->k >= 0 && eol_first)
+        fax_skip_fill (&r);
+      if (st->k < 0
+          || !eol_first
+          || r.pos >= r.end
+          || ((r.pos + FAX_EOL_BITS) & 7) != 0
+          || fax_peek (&r, FAX_EOL_BITS) != FAX_EOL)
+        r.pos = (start + 7) & ~(pdf_size_t) 7;
+    }
+
+  fax_skip_fill (&r);
+  if (r.pos >= r.end)
+    return (finish ? FAX_ROW_END : FAX_ROW_STARVED);
+
+  if (fax_peek (&r, FAX_EOL_BITS) == FAX_EOL)
+    {
+      r.pos += FAX_EOL_BITS;
+
+      /* Two end of line codes in a row, each one followed by a 1 bit
+       * in mixed coding, mean the end of the data (the return to
+       * control of Group 3, or the end of facsimile block of Group
+       * 4) */
+      if (st->k > 0
+          ? fax_peek (&r, FAX_EOL_BITS + 1) == (1 << FAX_EOL_BITS | FAX_EOL)
+          : fax_peek (&r, FAX_EOL_BITS) == FAX_EOL)
+        return FAX_ROW_END;
+    }
+  start = r.pos;
+
+  /* With mixed coding a 1 bit tells a one-dimensional row */
+  if (st->k > 0)
+    {
+      two_d_p = !fax_peek (&r, 1);
+      r.pos++;
+    }
+  else
+    two_d_p = (st->k < 0);
+
+  if (two_d_p)
+    ok = fax_decode_2d (st, &r);
+  else
+    ok = fax_decode_1d (st, &r);
+
+  if (ok && r.pos <= r.end)
+    {
+      /* Rows followed by anything but an end of line are damaged */
+      end = r.pos;
+      if (st->end_of_line && st->k >= 0)
+        {
+          fax_skip_fill (&r);
+          if (r.pos >= r.end && !finish)
+            return FAX_ROW_STARVED;
+          ok = (r.pos >= r.end || fax_peek (&r, FAX_EOL_BITS) == FAX_EOL);
+        }
+      if (ok)
+        {
+          st->bit_pos = end;
+          return FAX_ROW_OK;
+        }
+    }
+  else if (r.pos + FAX_LOOKAHEAD >= r.end)
+    {
+      /* The row may just be cut at the end of the data gathered so
+       * far */
+      return (finish ? FAX_ROW_END : FAX_ROW_STARVED);
+    }
+
+  /* A damaged row ends at the next end of line */
+  if (!st->end_of_line
+      || st->k < 0
+      || st->n_damaged >= st->damaged_max)
+    return FAX_ROW_BAD;
+
+  r.pos = start;
+  while (r.pos < r.end && fax_peek (&r, FAX_EOL_BITS) != FAX_EOL)
+    r.pos++;
+  if (r.pos >= r.end)
+    return (finish ? FAX_ROW_END : FAX_ROW_STARVED);
+
+  st->bit_pos = r.pos;
+  return FAX_ROW_DAMAGED;
+}
+
+/* Set the bits of the pixels from S to E, excluded */
+static inline void
+fax_fill_bits (pdf_uchar_t *row,
+               pdf_i32_t    s,
+               pdf_i32_t    e)
+{
+  pdf_i32_t first = s >> 3;
+  pdf_i32_t last = (e - 1) >> 3;
+  pdf_uchar_t first_mask = 0xff >> (s & 7);
+  pdf_uchar_t last_mask = 0xff << (7 - ((e - 1) & 7));
+
+  if (first == last)
+    row[first] |= first_mask & last_mask;
+  else
+    {
+      row[first] |= first_mask;
+      memset (row + first + 1, 0xff, last - first - 1);
+      row[last] |= last_mask;
+    }
+}
+
+static void
+fax_render_row (const struct pdf_stm_f_faxdec_s *st,
+                const pdf_i32_t                 *line,
+                pdf_size_t                       n,
+                pdf_uchar_t                     *row)
+{
+  pdf_size_t i;
+  pdf_i32_t end;
+
+  /* Black runs go from even changing elements to odd ones */
+  memset (row, 0, st->row_size);
+  for (i = 0; i < n; i += 2)
+    {
+      end = (i + 1 < n ? line[i + 1] : st->columns);
+      if (line[i] < end)
+        fax_fill_bits (row, line[i], end);
+    }
+
+  /* Black is 0 unless BlackIs1 */
+  if (!st->black_is_1)
+    {
+      for (i = 0; i < st->row_size; i++)
+        row[i] = ~row[i];
+    }
+}
+
+/* End of pdf_stm_f_fax.c */
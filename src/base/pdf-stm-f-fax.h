@@ -0,0 +1,37 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-f-fax.h
+ *       Date:         Sat Oct 17 19:02:44 2026
+ *
+ *       GNU PDF Library - CCITT Fax decoder
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PDF_STM_F_FAX_H
+#define PDF_STM_F_FAX_H
+
+#include <config.h>
+
+#include <pdf-stm-filter.h>
+
+const pdf_stm_filter_impl_t *pdf_stm_f_faxdec_get (void);
+
+#endif /* !PDF_STM_F_FAX_H */
+
+/* End of pdf_stm_f_fax.h */
@@ -29,27 +29,64 @@
 #include <string.h>
 
 #include <zlib.h>
+#if defined HAVE_LIBDEFLATE
+# include <libdeflate.h>
+#endif /* HAVE_LIBDEFLATE */
 
 #include <pdf-alloc.h>
 #include <pdf-hash.h>
 #include <pdf-stm-f-flate.h>
 #include <pdf-types.h>
 #include <pdf-types-buffer.h>
-#include <pdf-hash.h>
+#include <pdf-hash-helper.h>
+#include <pdf-jobs.h>
+
+#define PDF_STM_F_FLATE_CHUNK 16384
+
+/* Optional encoder parameters, mapped to the arguments of
+ * deflateInit2() */
+#define FLATE_PARAM_LEVEL       "Level"
+#define FLATE_PARAM_STRATEGY    "Strategy"
+#define FLATE_PARAM_WINDOW_BITS "WindowBits"
+#define FLATE_PARAM_MEM_LEVEL   "MemLevel"
+
+/* Optional encoder parameters enabling the block-wise parallel
+ * compression */
+#define FLATE_PARAM_THREADS     "Threads"
+#define FLATE_PARAM_BLOCK_SIZE  "BlockSize"
+
+#define FLATE_DEFAULT_MEM_LEVEL 8
+#define FLATE_DEFAULT_BLOCK_SIZE (128 * 1024)
+#define FLATE_MIN_BLOCK_SIZE PDF_STM_F_FLATE_CHUNK
+
+/* Optional decoder parameter with the size of the encoded data, as
+ * given in the Length entry of the stream dictionary */
+#define FLATE_PARAM_LENGTH      "Length"
+
+/* Larger encoded data is always decoded as a stream, and so is data
+ * expanding beyond FLATE_WHOLE_MAX_OUTPUT bytes */
+#define FLATE_WHOLE_MAX_LENGTH  (16 * 1024 * 1024)
+#define FLATE_WHOLE_MAX_OUTPUT  (256 * 1024 * 1024)
+
+/* Size of the preset dictionary given to each block: the deflate
+ * window can't reach further back */
+#define FLATE_DICT_SIZE 32768
 
 /* Define FLATE encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_flateenc_get,
-                       stm_f_flateenc_init,
-                       stm_f_flateenc_apply,
-                       stm_f_flateenc_deinit);
+PDF_STM_FILTER_DEFINE_FULL (pdf_stm_f_flateenc_get,
+                            stm_f_flateenc_init,
+                            stm_f_flateenc_apply,
+                            stm_f_flateenc_deinit,
+                            stm_f_flateenc_reset,
+                            PDF_STM_F_FLATE_CHUNK);
 
 /* Define FLATE decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_flatedec_get,
-                       stm_f_flatedec_init,
-                       stm_f_flatedec_apply,
-                       stm_f_flatedec_deinit);
-
-#define PDF_STM_F_FLATE_CHUNK 16384
+PDF_STM_FILTER_DEFINE_FULL (pdf_stm_f_flatedec_get,
+                            stm_f_flatedec_init,
+                            stm_f_flatedec_apply,
+                            stm_f_flatedec_deinit,
+                            stm_f_flatedec_reset,
+                            PDF_STM_F_FLATE_CHUNK);
 
 struct pdf_stm_f_flate_s
 {
@@ -61,10 +98,101 @@ struct pdf_stm_f_flate_s
   pdf_bool_t writing;
   pdf_char_t inbuf[PDF_STM_F_FLATE_CHUNK];
   pdf_char_t outbuf[PDF_STM_F_FLATE_CHUNK];
+  /* Only used by the parallel encoder */
+  struct pdf_stm_f_flate_par_s *par;
+#if defined HAVE_LIBDEFLATE
+  /* Only used by the decoder when the encoded size is known */
+  struct pdf_stm_f_flate_whole_s *whole;
+#endif /* HAVE_LIBDEFLATE */
+};
+
+#if defined HAVE_LIBDEFLATE
+/* State of the decoder inflating all the encoded data at once with
+ * libdeflate.  If that fails, the collected data is inflated as a
+ * stream. */
+struct pdf_stm_f_flate_whole_s
+{
+  struct libdeflate_decompressor *decompressor;
+  pdf_size_t length;
+
+  pdf_uchar_t *in_data;
+  pdf_size_t in_alloc;
+  pdf_size_t in_size;
+  pdf_size_t in_rp;
+
+  pdf_uchar_t *out_data;
+  pdf_size_t out_alloc;
+  pdf_size_t out_len;
+  pdf_size_t out_rp;
+
+  pdf_bool_t inflated_p;
+  pdf_bool_t streaming_p;
+};
+#endif /* HAVE_LIBDEFLATE */
+
+/* A block of the parallel encoder, compressed by a single job into a
+ * raw deflate stream ending at a byte boundary */
+struct pdf_stm_f_flate_block_s
+{
+  z_stream stream;
+  pdf_bool_t stream_init_p;
+  const pdf_uchar_t *dict;
+  pdf_size_t dict_size;
+  const pdf_uchar_t *in;
+  pdf_size_t in_size;
+  pdf_uchar_t *out;
+  pdf_size_t out_size;
+  pdf_size_t out_len;
+  pdf_bool_t last_p;
+  uLong adler;
+  int zret;
+  const struct pdf_stm_f_flate_par_s *par;
+};
+
+/* State of the parallel encoder.  The input is collected in batches of
+ * n_blocks blocks, preceded in in_data by the last FLATE_DICT_SIZE
+ * bytes of the previous batch.  The compressed blocks are then joined
+ * in out_data behind a single zlib header, and the trailer holds the
+ * Adler-32 of the whole input combined from the ones of each block. */
+struct pdf_stm_f_flate_par_s
+{
+  int level;
+  int strategy;
+  int window_bits;
+  int mem_level;
+
+  pdf_size_t n_blocks;
+  pdf_size_t block_size;
+  pdf_size_t block_bound;
+  struct pdf_stm_f_flate_block_s *blocks;
+
+  pdf_uchar_t *in_data;
+  pdf_size_t dict_size;
+  pdf_size_t in_size;
+
+  pdf_uchar_t *out_data;
+  pdf_size_t out_len;
+  pdf_size_t out_rp;
+
+  uLong adler;
+  pdf_bool_t header_p;
+  pdf_bool_t finished_p;
 };
 
 /* Common implementation */
 
+static void
+stm_f_flate_clear (struct pdf_stm_f_flate_s *filter_state)
+{
+  filter_state->stream.next_in = Z_NULL;
+  filter_state->stream.avail_in = 0;
+  filter_state->writing = PDF_FALSE;
+  filter_state->to_write = 0;
+  filter_state->incnt = 0;
+  filter_state->outcnt = 0;
+  filter_state->zret = Z_OK;
+}
+
 static pdf_bool_t
 stm_f_flate_init (void        **state,
                   pdf_error_t **error)
@@ -88,13 +216,11 @@ stm_f_flate_init (void        **state,
   filter_state->stream.zalloc = Z_NULL;
   filter_state->stream.zfree = Z_NULL;
   filter_state->stream.opaque = Z_NULL;
-  filter_state->stream.next_in = Z_NULL;
-  filter_state->stream.avail_in = 0;
-  filter_state->writing = PDF_FALSE;
-  filter_state->to_write = 0;
-  filter_state->incnt = 0;
-  filter_state->outcnt = 0;
-  filter_state->zret = Z_OK;
+  filter_state->par = NULL;
+#if defined HAVE_LIBDEFLATE
+  filter_state->whole = NULL;
+#endif /* HAVE_LIBDEFLATE */
+  stm_f_flate_clear (filter_state);
 
   *state = filter_state;
 
@@ -138,6 +264,323 @@ set_error_from_zlib_ret (pdf_error_t **error,
                  errmsg);
 }
 
+/* Parallel encoder */
+
+/* Compress a single block, as a job of the library job pool */
+static void
+flate_par_deflate_block (void *job)
+{
+  struct pdf_stm_f_flate_block_s *block = job;
+  const struct pdf_stm_f_flate_par_s *par = block->par;
+  z_stream *stream = &(block->stream);
+
+  /* The streams are kept from batch to batch */
+  if (!block->stream_init_p)
+    {
+      stream->zalloc = Z_NULL;
+      stream->zfree = Z_NULL;
+      stream->opaque = Z_NULL;
+      block->zret = deflateInit2 (stream,
+                                  par->level,
+                                  Z_DEFLATED,
+                                  -par->window_bits,
+                                  par->mem_level,
+                                  par->strategy);
+      if (block->zret != Z_OK)
+        return;
+      block->stream_init_p = PDF_TRUE;
+    }
+  else
+    {
+      block->zret = deflateReset (stream);
+      if (block->zret != Z_OK)
+        return;
+    }
+
+  /* Let the block refer to the data preceding it, as if it was
+   * compressed along with it */
+  if (block->dict_size > 0)
+    {
+      block->zret = deflateSetDictionary (stream,
+                                          (const Bytef *) block->dict,
+                                          block->dict_size);
+      if (block->zret != Z_OK)
+        return;
+    }
+
+  stream->next_in = (Bytef *) block->in;
+  stream->avail_in = block->in_size;
+  stream->next_out = (Bytef *) block->out;
+  stream->avail_out = block->out_size;
+
+  /* All blocks but the last one end with an empty stored block, so
+   * the next one starts at a byte boundary */
+  block->zret = deflate (stream, (block->last_p ? Z_FINISH : Z_SYNC_FLUSH));
+  if ((block->last_p && block->zret != Z_STREAM_END) ||
+      (!block->last_p && (block->zret != Z_OK || stream->avail_out == 0)))
+    {
+      if (block->zret == Z_OK || block->zret == Z_STREAM_END)
+        block->zret = Z_BUF_ERROR;
+      return;
+    }
+
+  block->out_len = block->out_size - stream->avail_out;
+  block->adler = adler32 (adler32 (0L, Z_NULL, 0),
+                          (const Bytef *) block->in,
+                          block->in_size);
+  block->zret = Z_OK;
+}
+
+static void
+flate_par_clear (struct pdf_stm_f_flate_par_s *par)
+{
+  par->dict_size = 0;
+  par->in_size = 0;
+  par->out_len = 0;
+  par->out_rp = 0;
+  par->adler = adler32 (0L, Z_NULL, 0);
+  par->header_p = PDF_FALSE;
+  par->finished_p = PDF_FALSE;
+}
+
+static void
+flate_par_destroy (struct pdf_stm_f_flate_par_s *par)
+{
+  pdf_size_t i;
+
+  if (par->blocks)
+    {
+      for (i = 0; i < par->n_blocks; i++)
+        {
+          if (par->blocks[i].stream_init_p)
+            deflateEnd (&(par->blocks[i].stream));
+        }
+      pdf_dealloc (par->blocks);
+    }
+  pdf_dealloc (par->in_data);
+  pdf_dealloc (par->out_data);
+  pdf_dealloc (par);
+}
+
+static struct pdf_stm_f_flate_par_s *
+flate_par_new (int           level,
+               int           strategy,
+               int           window_bits,
+               int           mem_level,
+               pdf_size_t    n_blocks,
+               pdf_size_t    block_size,
+               pdf_error_t **error)
+{
+  struct pdf_stm_f_flate_par_s *par;
+  pdf_size_t i;
+
+  par = pdf_alloc (sizeof (struct pdf_stm_f_flate_par_s));
+  if (!par)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create FLATE encoder internal state: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long)sizeof (struct pdf_stm_f_flate_par_s));
+      return NULL;
+    }
+
+  par->level = level;
+  par->strategy = strategy;
+  /* Raw deflate doesn't support 256-byte windows */
+  par->window_bits = (window_bits < 9 ? 9 : window_bits);
+  par->mem_level = mem_level;
+  par->n_blocks = n_blocks;
+  par->block_size = block_size;
+  /* Worst case of the deflate output, including the stored block
+   * headers and the final empty block of the flush */
+  par->block_bound = (block_size +
+                      (block_size >> 3) +
+                      (block_size >> 6) +
+                      16);
+
+  par->blocks = pdf_alloc (n_blocks * sizeof (struct pdf_stm_f_flate_block_s));
+  par->in_data = pdf_alloc (FLATE_DICT_SIZE + n_blocks * block_size);
+  /* Room for the zlib header and trailer too */
+  par->out_data = pdf_alloc (2 + n_blocks * par->block_bound + 4);
+  if (!par->blocks || !par->in_data || !par->out_data)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create FLATE encoder internal state: "
+                     "couldn't allocate the buffers of %lu blocks "
+                     "of %lu bytes",
+                     (unsigned long)n_blocks,
+                     (unsigned long)block_size);
+      par->n_blocks = 0;
+      flate_par_destroy (par);
+      return NULL;
+    }
+
+  for (i = 0; i < n_blocks; i++)
+    {
+      par->blocks[i].stream_init_p = PDF_FALSE;
+      par->blocks[i].par = par;
+    }
+
+  flate_par_clear (par);
+  return par;
+}
+
+static void
+flate_par_put_header (struct pdf_stm_f_flate_par_s *par,
+                      pdf_uchar_t                  *header)
+{
+  pdf_u32_t cmf;
+  pdf_u32_t flg;
+
+  /* Same compression level hint deflate would use */
+  if (par->strategy >= Z_HUFFMAN_ONLY ||
+      (par->level != Z_DEFAULT_COMPRESSION && par->level < 2))
+    flg = 0;
+  else if (par->level != Z_DEFAULT_COMPRESSION && par->level < 6)
+    flg = 1;
+  else if (par->level == 6 || par->level == Z_DEFAULT_COMPRESSION)
+    flg = 2;
+  else
+    flg = 3;
+
+  cmf = ((par->window_bits - 8) << 4) | Z_DEFLATED;
+  flg <<= 6;
+  flg += 31 - ((cmf << 8) + flg) % 31;
+
+  header[0] = (pdf_uchar_t) cmf;
+  header[1] = (pdf_uchar_t) flg;
+}
+
+/* Compress the collected input, leaving the result in out_data */
+static pdf_bool_t
+flate_par_deflate_batch (struct pdf_stm_f_flate_par_s  *par,
+                         pdf_bool_t                     last_p,
+                         pdf_error_t                  **error)
+{
+  pdf_uchar_t *batch = par->in_data + FLATE_DICT_SIZE;
+  pdf_size_t n_blocks;
+  pdf_size_t offset;
+  pdf_size_t pos;
+  pdf_size_t i;
+
+  /* The last batch may be empty, but still needs the final block */
+  n_blocks = (par->in_size + par->block_size - 1) / par->block_size;
+  if (n_blocks == 0)
+    n_blocks = 1;
+
+  for (i = 0; i < n_blocks; i++)
+    {
+      struct pdf_stm_f_flate_block_s *block = &(par->blocks[i]);
+
+      offset = i * par->block_size;
+      block->dict_size = PDF_MIN (par->dict_size + offset, FLATE_DICT_SIZE);
+      block->dict = batch + offset - block->dict_size;
+      block->in = batch + offset;
+      block->in_size = PDF_MIN (par->block_size, par->in_size - offset);
+      block->out = par->out_data + 2 + i * par->block_bound;
+      block->out_size = par->block_bound;
+      block->last_p = (last_p && i == n_blocks - 1);
+    }
+
+  if (!pdf_jobs_run (flate_par_deflate_block,
+                     par->blocks,
+                     sizeof (struct pdf_stm_f_flate_block_s),
+                     n_blocks,
+                     error))
+    return PDF_FALSE;
+
+  for (i = 0; i < n_blocks; i++)
+    {
+      if (par->blocks[i].zret != Z_OK)
+        {
+          set_error_from_zlib_ret (error, par->blocks[i].zret);
+          return PDF_FALSE;
+        }
+    }
+
+  /* Join the blocks */
+  pos = 0;
+  if (!par->header_p)
+    {
+      flate_par_put_header (par, par->out_data);
+      par->header_p = PDF_TRUE;
+      pos = 2;
+    }
+  for (i = 0; i < n_blocks; i++)
+    {
+      memmove (par->out_data + pos,
+               par->blocks[i].out,
+               par->blocks[i].out_len);
+      pos += par->blocks[i].out_len;
+      par->adler = adler32_combine (par->adler,
+                                    par->blocks[i].adler,
+                                    par->blocks[i].in_size);
+    }
+  if (last_p)
+    {
+      par->out_data[pos++] = (pdf_uchar_t) (par->adler >> 24);
+      par->out_data[pos++] = (pdf_uchar_t) (par->adler >> 16);
+      par->out_data[pos++] = (pdf_uchar_t) (par->adler >> 8);
+      par->out_data[pos++] = (pdf_uchar_t) par->adler;
+      par->finished_p = PDF_TRUE;
+    }
+  par->out_len = pos;
+  par->out_rp = 0;
+
+  /* Keep the tail of the input as dictionary of the next batch */
+  offset = PDF_MIN (par->dict_size + par->in_size, FLATE_DICT_SIZE);
+  memmove (batch - offset, batch + par->in_size - offset, offset);
+  par->dict_size = offset;
+  par->in_size = 0;
+
+  return PDF_TRUE;
+}
+
+static enum pdf_stm_filter_apply_status_e
+flate_par_apply (struct pdf_stm_f_flate_par_s  *par,
+                 pdf_buffer_t                  *in,
+                 pdf_buffer_t                  *out,
+                 pdf_bool_t                     finish,
+                 pdf_error_t                  **error)
+{
+  pdf_size_t batch_size = par->n_blocks * par->block_size;
+  pdf_size_t n;
+
+  while (PDF_TRUE)
+    {
+      /* Write what is pending of the last batch */
+      n = PDF_MIN (par->out_len - par->out_rp, out->size - out->wp);
+      memcpy (out->data + out->wp, par->out_data + par->out_rp, n);
+      out->wp += n;
+      par->out_rp += n;
+      if (par->out_rp < par->out_len)
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+
+      if (par->finished_p)
+        return PDF_STM_FILTER_APPLY_STATUS_EOF;
+
+      /* Collect the input of the next batch */
+      n = PDF_MIN (in->wp - in->rp, batch_size - par->in_size);
+      memcpy (par->in_data + FLATE_DICT_SIZE + par->in_size,
+              in->data + in->rp,
+              n);
+      in->rp += n;
+      par->in_size += n;
+
+      if (!finish && par->in_size < batch_size)
+        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+
+      if (!flate_par_deflate_batch (par,
+                                    finish && pdf_buffer_eob_p (in),
+                                    error))
+        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+    }
+}
+
 /* Encoder implementation */
 
 static pdf_bool_t
@@ -146,14 +589,93 @@ stm_f_flateenc_init (const pdf_hash_t  *params,
                      pdf_error_t      **error)
 {
   struct pdf_stm_f_flate_s *filter_state;
+  int level = Z_DEFAULT_COMPRESSION;
+  int strategy = Z_DEFAULT_STRATEGY;
+  int window_bits = MAX_WBITS;
+  int mem_level = FLATE_DEFAULT_MEM_LEVEL;
+  pdf_size_t n_threads = 1;
+  pdf_size_t block_size = FLATE_DEFAULT_BLOCK_SIZE;
+
+  /* All the parameters are optional */
+  if (params)
+    {
+      if (pdf_hash_key_p (params, FLATE_PARAM_LEVEL))
+        level = pdf_hash_get_size (params, FLATE_PARAM_LEVEL);
+      if (pdf_hash_key_p (params, FLATE_PARAM_STRATEGY))
+        strategy = pdf_hash_get_size (params, FLATE_PARAM_STRATEGY);
+      if (pdf_hash_key_p (params, FLATE_PARAM_WINDOW_BITS))
+        window_bits = pdf_hash_get_size (params, FLATE_PARAM_WINDOW_BITS);
+      if (pdf_hash_key_p (params, FLATE_PARAM_MEM_LEVEL))
+        mem_level = pdf_hash_get_size (params, FLATE_PARAM_MEM_LEVEL);
+      if (pdf_hash_key_p (params, FLATE_PARAM_THREADS))
+        n_threads = pdf_hash_get_size (params, FLATE_PARAM_THREADS);
+      if (pdf_hash_key_p (params, FLATE_PARAM_BLOCK_SIZE))
+        block_size = pdf_hash_get_size (params, FLATE_PARAM_BLOCK_SIZE);
+    }
+
+  if ((level != Z_DEFAULT_COMPRESSION &&
+       (level < Z_NO_COMPRESSION || level > Z_BEST_COMPRESSION)) ||
+      strategy < Z_DEFAULT_STRATEGY || strategy > Z_FIXED ||
+      window_bits < 8 || window_bits > MAX_WBITS ||
+      mem_level < 1 || mem_level > MAX_MEM_LEVEL)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EBADDATA,
+                     "cannot create FLATE encoder internal state: "
+                     "invalid parameters ('"FLATE_PARAM_LEVEL"': %d, "
+                     "'"FLATE_PARAM_STRATEGY"': %d, "
+                     "'"FLATE_PARAM_WINDOW_BITS"': %d, "
+                     "'"FLATE_PARAM_MEM_LEVEL"': %d)",
+                     level, strategy, window_bits, mem_level);
+      return PDF_FALSE;
+    }
+
+  if (block_size < FLATE_MIN_BLOCK_SIZE)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EBADDATA,
+                     "cannot create FLATE encoder internal state: "
+                     "'"FLATE_PARAM_BLOCK_SIZE"' must be at least %lu bytes",
+                     (unsigned long)FLATE_MIN_BLOCK_SIZE);
+      return PDF_FALSE;
+    }
+
+  /* Zero threads means as many as the job pool can run */
+  if (n_threads == 0)
+    n_threads = pdf_jobs_get_concurrency ();
 
   /* Initialize common stuff */
   if (!stm_f_flate_init (state, error))
     return PDF_FALSE;
 
   filter_state = *state;
-  if (deflateInit (&(filter_state->stream),
-                   Z_DEFAULT_COMPRESSION) != Z_OK)
+
+  /* Compress blocks of the input in parallel */
+  if (n_threads > 1)
+    {
+      filter_state->par = flate_par_new (level,
+                                         strategy,
+                                         window_bits,
+                                         mem_level,
+                                         n_threads,
+                                         block_size,
+                                         error);
+      if (!filter_state->par)
+        {
+          stm_f_flate_deinit (filter_state);
+          return PDF_FALSE;
+        }
+      return PDF_TRUE;
+    }
+
+  if (deflateInit2 (&(filter_state->stream),
+                    level,
+                    Z_DEFLATED,
+                    window_bits,
+                    mem_level,
+                    strategy) != Z_OK)
     {
       pdf_set_error (error,
                      PDF_EDOMAIN_BASE_STM,
@@ -172,10 +694,41 @@ stm_f_flateenc_deinit (void *state)
 {
   struct pdf_stm_f_flate_s *filter_state = state;
 
-  deflateEnd (&(filter_state->stream));
+  if (filter_state->par)
+    flate_par_destroy (filter_state->par);
+  else
+    deflateEnd (&(filter_state->stream));
   stm_f_flate_deinit (state);
 }
 
+static pdf_bool_t
+stm_f_flateenc_reset (void         *state,
+                      pdf_error_t **error)
+{
+  struct pdf_stm_f_flate_s *filter_state = state;
+
+  /* Keeps the buffers and the deflate streams of the blocks */
+  if (filter_state->par)
+    {
+      flate_par_clear (filter_state->par);
+      return PDF_TRUE;
+    }
+
+  /* Keeps the deflate window and hash tables */
+  if (deflateReset (&(filter_state->stream)) != Z_OK)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ERROR,
+                     "cannot reset FLATE encoder: "
+                     "couldn't reset deflate");
+      return PDF_FALSE;
+    }
+
+  stm_f_flate_clear (filter_state);
+  return PDF_TRUE;
+}
+
 static enum pdf_stm_filter_apply_status_e
 deflate_inbuf (struct pdf_stm_f_flate_s  *st,
                pdf_buffer_t              *out,
@@ -283,6 +836,9 @@ stm_f_flateenc_apply (void          *state,
   struct pdf_stm_f_flate_s *st = state;
   enum pdf_stm_filter_apply_status_e ret;
 
+  if (st->par)
+    return flate_par_apply (st->par, in, out, finish, error);
+
   do
     {
       ret = read_and_deflate (st, in, out, finish, error);
@@ -294,6 +850,157 @@ stm_f_flateenc_apply (void          *state,
 
 /* Decoder implementation */
 
+#if defined HAVE_LIBDEFLATE
+
+/* Allocate the output buffer for the first try, sized after the
+ * collected encoded data.  It is kept across resets. */
+static pdf_bool_t
+flate_whole_alloc_out (struct pdf_stm_f_flate_whole_s *whole)
+{
+  pdf_size_t out_alloc;
+
+  /* Most streams expand less than that */
+  out_alloc = PDF_MIN (2 * whole->in_size + PDF_STM_F_FLATE_CHUNK,
+                       FLATE_WHOLE_MAX_OUTPUT);
+  if (out_alloc <= whole->out_alloc)
+    return PDF_TRUE;
+
+  pdf_dealloc (whole->out_data);
+  whole->out_data = pdf_alloc (out_alloc);
+  whole->out_alloc = whole->out_data ? out_alloc : 0;
+  return whole->out_data != NULL;
+}
+
+/* Make room for at least SIZE bytes of encoded data, growing the
+ * buffer geometrically up to the given length */
+static pdf_bool_t
+flate_whole_grow_in (struct pdf_stm_f_flate_whole_s *whole,
+                     pdf_size_t                      size)
+{
+  pdf_uchar_t *in_data;
+  pdf_size_t in_alloc;
+
+  if (size <= whole->in_alloc)
+    return PDF_TRUE;
+
+  in_alloc = PDF_MAX (2 * whole->in_alloc, PDF_STM_F_FLATE_CHUNK);
+  in_alloc = PDF_MIN (PDF_MAX (in_alloc, size), whole->length);
+
+  in_data = pdf_realloc (whole->in_data, in_alloc);
+  if (!in_data)
+    return PDF_FALSE;
+  whole->in_data = in_data;
+  whole->in_alloc = in_alloc;
+  return PDF_TRUE;
+}
+
+/* Inflate the whole encoded data in one call, into a growing output
+ * buffer.  Returns PDF_FALSE if it couldn't, in which case the data
+ * is to be inflated as a stream. */
+static pdf_bool_t
+flate_whole_inflate (struct pdf_stm_f_flate_s *st)
+{
+  struct pdf_stm_f_flate_whole_s *whole = st->whole;
+  pdf_uchar_t *out_data;
+  enum libdeflate_result res;
+  size_t in_len;
+  size_t out_len;
+
+  if (!flate_whole_alloc_out (whole))
+    return PDF_FALSE;
+
+  while (PDF_TRUE)
+    {
+      /* Trailing data after the zlib stream, if any, is ignored */
+      res = libdeflate_zlib_decompress_ex (whole->decompressor,
+                                           whole->in_data,
+                                           whole->in_size,
+                                           whole->out_data,
+                                           whole->out_alloc,
+                                           &in_len,
+                                           &out_len);
+      if (res == LIBDEFLATE_SUCCESS)
+        {
+          whole->out_len = out_len;
+          return PDF_TRUE;
+        }
+
+      /* Grow the output buffer and start again */
+      if (res != LIBDEFLATE_INSUFFICIENT_SPACE ||
+          whole->out_alloc >= FLATE_WHOLE_MAX_OUTPUT)
+        return PDF_FALSE;
+
+      out_data = pdf_realloc (whole->out_data, 2 * whole->out_alloc);
+      if (!out_data)
+        return PDF_FALSE;
+      whole->out_data = out_data;
+      whole->out_alloc *= 2;
+    }
+}
+
+static void
+flate_whole_clear (struct pdf_stm_f_flate_whole_s *whole)
+{
+  whole->in_size = 0;
+  whole->in_rp = 0;
+  whole->out_len = 0;
+  whole->out_rp = 0;
+  whole->inflated_p = PDF_FALSE;
+  whole->streaming_p = PDF_FALSE;
+}
+
+static void
+flate_whole_destroy (struct pdf_stm_f_flate_whole_s *whole)
+{
+  if (whole->decompressor)
+    libdeflate_free_decompressor (whole->decompressor);
+  pdf_dealloc (whole->in_data);
+  pdf_dealloc (whole->out_data);
+  pdf_dealloc (whole);
+}
+
+static struct pdf_stm_f_flate_whole_s *
+flate_whole_new (pdf_size_t    length,
+                 pdf_error_t **error)
+{
+  struct pdf_stm_f_flate_whole_s *whole;
+
+  whole = pdf_alloc (sizeof (struct pdf_stm_f_flate_whole_s));
+  if (!whole)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create FLATE decoder internal state: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long)sizeof (struct pdf_stm_f_flate_whole_s));
+      return NULL;
+    }
+
+  whole->length = length;
+  /* The buffers grow as the data comes, LENGTH may be wrong */
+  whole->in_data = NULL;
+  whole->in_alloc = 0;
+  whole->out_data = NULL;
+  whole->out_alloc = 0;
+  whole->decompressor = libdeflate_alloc_decompressor ();
+  if (!whole->decompressor)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create FLATE decoder internal state: "
+                     "couldn't allocate the decompressor");
+      flate_whole_destroy (whole);
+      return NULL;
+    }
+
+  flate_whole_clear (whole);
+  return whole;
+}
+
+#endif /* HAVE_LIBDEFLATE */
+
 static pdf_bool_t
 stm_f_flatedec_init (const pdf_hash_t  *params,
                      void             **state,
@@ -318,6 +1025,28 @@ stm_f_flatedec_init (const pdf_hash_t  *params,
       return PDF_FALSE;
     }
 
+#if defined HAVE_LIBDEFLATE
+  /* Decode reasonably sized data at once, if the size of the encoded
+   * data is given.  Without libdeflate it is just ignored. */
+  if (params &&
+      pdf_hash_key_p (params, FLATE_PARAM_LENGTH))
+    {
+      pdf_size_t length;
+
+      length = pdf_hash_get_size (params, FLATE_PARAM_LENGTH);
+      if (length > 0 && length <= FLATE_WHOLE_MAX_LENGTH)
+        {
+          filter_state->whole = flate_whole_new (length, error);
+          if (!filter_state->whole)
+            {
+              inflateEnd (&(filter_state->stream));
+              stm_f_flate_deinit (filter_state);
+              return PDF_FALSE;
+            }
+        }
+    }
+#endif /* HAVE_LIBDEFLATE */
+
   return PDF_TRUE;
 }
 
@@ -326,91 +1055,150 @@ stm_f_flatedec_deinit (void *state)
 {
   struct pdf_stm_f_flate_s *filter_state = state;
 
+#if defined HAVE_LIBDEFLATE
+  if (filter_state->whole)
+    flate_whole_destroy (filter_state->whole);
+#endif /* HAVE_LIBDEFLATE */
   inflateEnd (&filter_state->stream);
   stm_f_flate_deinit (state);
 }
 
+static pdf_bool_t
+stm_f_flatedec_reset (void         *state,
+                      pdf_error_t **error)
+{
+  struct pdf_stm_f_flate_s *filter_state = state;
+
+  /* Keeps the inflate window */
+  if (inflateReset (&(filter_state->stream)) != Z_OK)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ERROR,
+                     "cannot reset FLATE decoder: "
+                     "couldn't reset inflate");
+      return PDF_FALSE;
+    }
+
+  stm_f_flate_clear (filter_state);
+#if defined HAVE_LIBDEFLATE
+  if (filter_state->whole)
+    flate_whole_clear (filter_state->whole);
+#endif /* HAVE_LIBDEFLATE */
+  return PDF_TRUE;
+}
+
+/* Inflate straight from the input buffer into the output buffer */
 static enum pdf_stm_filter_apply_status_e
-read_and_inflate (struct pdf_stm_f_flate_s  *st,
-                  pdf_buffer_t              *in,
-                  pdf_buffer_t              *out,
-                  pdf_error_t              **error)
+stream_inflate (struct pdf_stm_f_flate_s  *st,
+                pdf_buffer_t              *in,
+                pdf_buffer_t              *out,
+                pdf_error_t              **error)
 {
-  /* Fill the input CHUNK */
-  if (!st->writing)
+  while (!pdf_buffer_full_p (out))
     {
-      while (st->incnt < PDF_STM_F_FLATE_CHUNK &&
-             !pdf_buffer_eob_p (in))
+      st->stream.next_in = (Bytef *) (in->data + in->rp);
+      st->stream.avail_in = in->wp - in->rp;
+      st->stream.next_out = (Bytef *) (out->data + out->wp);
+      st->stream.avail_out = out->size - out->wp;
+
+      st->zret = inflate (&(st->stream), Z_NO_FLUSH);
+
+      in->rp = in->wp - st->stream.avail_in;
+      out->wp = out->size - st->stream.avail_out;
+
+      if (st->zret == Z_STREAM_END)
+        return PDF_STM_FILTER_APPLY_STATUS_EOF;
+
+      /* No progress possible with room in the output: more input is
+       * needed */
+      if (st->zret == Z_BUF_ERROR)
+        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+
+      if (st->zret != Z_OK)
         {
-          st->inbuf[st->incnt] = in->data[in->rp];
-          st->incnt++;
-          in->rp++;
+          set_error_from_zlib_ret (error, st->zret);
+          return PDF_STM_FILTER_APPLY_STATUS_ERROR;
         }
-    }
-  else
-    {
-      /*
-       * Not nice, but keeps the writing process code clear.
-       * Notice that the labeled code is inside a while loop,
-       * so I feel that avoiding this goto won't bring us better code.
-       */
-      goto writing;
+
+      if (pdf_buffer_eob_p (in) &&
+          !pdf_buffer_full_p (out))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
     }
 
-  if (st->incnt == 0)
-    return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+  return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+}
 
-  /* we inflate and write to out */
-  st->stream.avail_in = st->incnt;
-  st->stream.next_in = (Bytef *) st->inbuf;
-  do {
-    st->stream.avail_out = PDF_STM_F_FLATE_CHUNK;
-    st->stream.next_out = (Bytef *) st->outbuf;
-    st->outcnt = 0;
+#if defined HAVE_LIBDEFLATE
 
-    st->zret = inflate (&(st->stream),
-                        Z_NO_FLUSH);
-    if (st->zret == Z_STREAM_ERROR ||
-        st->zret == Z_NEED_DICT ||
-        st->zret == Z_DATA_ERROR ||
-        st->zret == Z_MEM_ERROR)
-      {
-        set_error_from_zlib_ret (error, st->zret);
-        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
-      }
+static enum pdf_stm_filter_apply_status_e
+whole_inflate (struct pdf_stm_f_flate_s  *st,
+               pdf_buffer_t              *in,
+               pdf_buffer_t              *out,
+               pdf_bool_t                 finish,
+               pdf_error_t              **error)
+{
+  struct pdf_stm_f_flate_whole_s *whole = st->whole;
+  enum pdf_stm_filter_apply_status_e ret;
+  pdf_size_t n;
 
-    st->to_write = PDF_STM_F_FLATE_CHUNK - st->stream.avail_out;
+  if (!whole->inflated_p && !whole->streaming_p)
+    {
+      /* Collect the encoded data */
+      n = PDF_MIN (in->wp - in->rp, whole->length - whole->in_size);
+      if (flate_whole_grow_in (whole, whole->in_size + n))
+        {
+          memcpy (whole->in_data + whole->in_size, in->data + in->rp, n);
+          in->rp += n;
+          whole->in_size += n;
 
-  writing:
+          if (!finish && whole->in_size < whole->length)
+            return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+        }
 
-    while (st->outcnt < st->to_write &&
-           !pdf_buffer_full_p (out))
-      {
-        out->data[out->wp] = st->outbuf[st->outcnt];
-        out->wp++;
-        st->outcnt++;
-      }
+      /* Wrong lengths, corrupt data, lack of memory and the like are
+       * left to the stream decoder, as if the length was unknown */
+      if ((finish || whole->in_size == whole->length) &&
+          flate_whole_inflate (st))
+        whole->inflated_p = PDF_TRUE;
+      else
+        whole->streaming_p = PDF_TRUE;
+    }
 
-    if (pdf_buffer_full_p (out))
-      {
-        st->writing = PDF_TRUE;
-        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-      }
-  } while (st->stream.avail_out == 0);
+  if (whole->streaming_p)
+    {
+      /* Inflate what was collected, and then the rest of the input */
+      if (whole->in_rp < whole->in_size)
+        {
+          pdf_buffer_t collected;
 
-  if (st->zret == Z_STREAM_END)
-    return PDF_STM_FILTER_APPLY_STATUS_EOF;
+          collected.data = whole->in_data;
+          collected.size = whole->in_size;
+          collected.rp = whole->in_rp;
+          collected.wp = whole->in_size;
 
-  /* the input CHUNK now is empty, if needed, ask for input */
-  st->writing = PDF_FALSE;
-  st->incnt = 0;
-  if (pdf_buffer_eob_p (in))
-    return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+          ret = stream_inflate (st, &collected, out, error);
+          whole->in_rp = collected.rp;
+          if (ret != PDF_STM_FILTER_APPLY_STATUS_NO_INPUT)
+            return ret;
+        }
 
-  /* ask for the input we couldn't read */
-  return PDF_STM_FILTER_APPLY_STATUS_OK;
+      return stream_inflate (st, in, out, error);
+    }
+
+  /* Write the decoded data */
+  n = PDF_MIN (whole->out_len - whole->out_rp, out->size - out->wp);
+  memcpy (out->data + out->wp, whole->out_data + whole->out_rp, n);
+  out->wp += n;
+  whole->out_rp += n;
+
+  return (whole->out_rp < whole->out_len ?
+          PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT :
+          PDF_STM_FILTER_APPLY_STATUS_EOF);
 }
 
+#endif /* HAVE_LIBDEFLATE */
+
 static enum pdf_stm_filter_apply_status_e
 stm_f_flatedec_apply (void          *state,
                       pdf_buffer_t  *in,
@@ -419,15 +1207,13 @@ stm_f_flatedec_apply (void          *state,
                       pdf_error_t  **error)
 {
   struct pdf_stm_f_flate_s *st = state;
-  enum pdf_stm_filter_apply_status_e ret;
 
-  do
-    {
-      ret = read_and_inflate (st, in, out, error);
-    }
-  while (ret == PDF_STM_FILTER_APPLY_STATUS_OK);
+#if defined HAVE_LIBDEFLATE
+  if (st->whole)
+    return whole_inflate (st, in, out, finish, error);
+#endif /* HAVE_LIBDEFLATE */
 
-  return ret;
+  return stream_inflate (st, in, out, error);
 }
 
 /* End of pdf_stm_f_flate.c */
@@ -35,16 +35,18 @@
 #include <pdf-stm-f-lzw.h>
 
 /* Define LZW encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_lzwenc_get,
-                       stm_f_lzwenc_init,
-                       stm_f_lzwenc_apply,
-                       stm_f_lzwenc_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_lzwenc_get,
+                             stm_f_lzwenc_init,
+                             stm_f_lzwenc_apply,
+                             stm_f_lzwenc_deinit,
+                             stm_f_lzwenc_reset);
 
 /* Define LZW decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_lzwdec_get,
-                       stm_f_lzwdec_init,
-                       stm_f_lzwdec_apply,
-                       stm_f_lzwdec_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_lzwdec_get,
+                             stm_f_lzwdec_init,
+                             stm_f_lzwdec_apply,
+                             stm_f_lzwdec_deinit,
+                             stm_f_lzwdec_reset);
 
 #define LZW_PARAM_EARLY_CHANGE "EarlyChange"
 
@@ -65,10 +67,9 @@ enum lzw_special_codes_e {
   LZW_FIRST_CODE
 };
 
-/* -- LZW code output/input -- */
+/* -- LZW code output -- */
 /*
- * Object to read and write codes of variable bitsize in a buffer.
- * Warning: using both get and put functions may break the buffer.
+ * Object to write codes of variable bitsize in a buffer.
  */
 struct lzw_buffer_s
 {
@@ -95,40 +96,16 @@ lzw_buffer_init (struct lzw_buffer_s *b,
   b->cache_rp = 0;
 }
 
-static enum pdf_stm_filter_apply_status_e
-lzw_buffer_get_code (struct lzw_buffer_s *b,
-                     pdf_bool_t           finish,
-                     lzw_code_t          *code)   /* out */
+static void
+lzw_buffer_put_byte (struct lzw_buffer_s *b,
+                     pdf_uchar_t          byte)
 {
-  lzw_code_t r;
-
-  while (b->valbits <= LZW_CODE_SIZE - 8 && !finish)
-    {
-      if (!pdf_buffer_eob_p (b->buf))
-        {
-          b->valbuf |=
-            (lzw_code_t) b->buf->data [b->buf->rp++]
-            << (LZW_CODE_SIZE - 8 - b->valbits);
-
-          b->valbits += 8;
-        }
-      else
-        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
-    }
-
-  if (b->valbits < b->bitsize)
-    return PDF_STM_FILTER_APPLY_STATUS_EOF;
-
-  r = b->valbuf >> (LZW_CODE_SIZE - b->bitsize);
-  b->valbuf <<= b->bitsize;
-  b->valbits -= b->bitsize;
-
-  *code = r;
-
-  return PDF_STM_FILTER_APPLY_STATUS_OK;
+  if (pdf_buffer_full_p (b->buf))
+    b->cache [b->cache_wp++] = byte;
+  else
+    b->buf->data [b->buf->wp++] = byte;
 }
 
-/* Once finished, call with 0 as code value to flush the buffer. */
 static void
 lzw_buffer_put_code (struct lzw_buffer_s *b,
                      lzw_code_t           code)
@@ -138,21 +115,25 @@ lzw_buffer_put_code (struct lzw_buffer_s *b,
 
   while (b->valbits >= 8)
     {
-      if (pdf_buffer_full_p (b->buf))
-        {
-          b->cache [b->cache_wp++] =
-            (pdf_uchar_t) (b->valbuf >> (LZW_CODE_SIZE - 8));
-        }
-      else
-        {
-          b->buf->data [b->buf->wp++] =
-            (pdf_uchar_t) (b->valbuf >> (LZW_CODE_SIZE - 8));
-        }
+      lzw_buffer_put_byte (b, (pdf_uchar_t) (b->valbuf >> (LZW_CODE_SIZE - 8)));
       b->valbuf <<= 8;
       b->valbits -= 8;
     }
 }
 
+/* Once finished, call to pad the last code with zeros up to the next
+   byte boundary. */
+static void
+lzw_buffer_put_padding (struct lzw_buffer_s *b)
+{
+  if (b->valbits > 0)
+    {
+      lzw_buffer_put_byte (b, (pdf_uchar_t) (b->valbuf >> (LZW_CODE_SIZE - 8)));
+      b->valbuf = 0;
+      b->valbits = 0;
+    }
+}
+
 static pdf_bool_t
 lzw_buffer_flush (struct lzw_buffer_s *b)
 {
@@ -191,107 +172,58 @@ lzw_buffer_set_bitsize (struct lzw_buffer_s *b,
   b->maxval = (1 << newsize) - 1;
 }
 
-/* -- LZW dictionary handler -- */
+/* -- LZW encoder dictionary -- */
 
 /*
- * The strings are stored in a non balanced ordered binary tree.
+ * The strings are stored in an open addressing hash table, keyed by the
+ * code of their prefix string and their last character.  Each slot
+ * packs the key and the code of the string; as no string is ever added
+ * with a code below LZW_FIRST_CODE, a zero slot is an empty one.
  */
-struct lzw_string_s
-{
-  lzw_code_t prefix;   /* Prefix string code */
-  pdf_uchar_t suffix; /* Appended character */
-
-  lzw_code_t first; /* First string with the same prefix.  */
-  lzw_code_t left;  /* Next string with smaller suffix and same prefix. */
-  lzw_code_t right; /* Next string with greater suffix and same prefix. */
-};
+#define LZW_HASH_BITS     13
+#define LZW_HASH_SIZE     (1 << LZW_HASH_BITS)
+#define LZW_HASH_KEY(prefix, suffix) (((prefix) << 8) | (suffix))
+#define LZW_HASH_INDEX(key)                                     \
+  ((((key) * 2654435761U) & 0xFFFFFFFFU) >> (32 - LZW_HASH_BITS))
 
 struct lzw_dict_s
 {
-  struct lzw_string_s table [LZW_MAX_DICTSIZE];
+  pdf_u32_t table [LZW_HASH_SIZE];
   pdf_size_t size;
 };
 
-static void
-lzw_string_init (struct lzw_string_s *s)
-{
-  memset (s, 0xFF, sizeof (struct lzw_string_s));
-}
-
 static void
 lzw_dict_init (struct lzw_dict_s *d)
 {
-  int i;
-
-  memset (d->table,
-          0xFF,
-          sizeof (struct lzw_string_s) * LZW_MAX_DICTSIZE);
-
-  for (i = 0; i < LZW_FIRST_CODE; i++)
-    {
-      d->table[i].suffix = (pdf_uchar_t) (i & 0xFF);
-    }
-
+  memset (d->table, 0, sizeof (d->table));
   d->size = LZW_FIRST_CODE;
 }
 
+/* Look for the string made of the string coded as PREFIX followed by
+ * SUFFIX.  If found, its code is stored in PREFIX and PDF_FALSE is
+ * returned; otherwise the string is added to the dictionary. */
 static pdf_bool_t
-lzw_dict_add (struct lzw_dict_s   *d,
-              struct lzw_string_s *s)
+lzw_dict_add (struct lzw_dict_s *d,
+              lzw_code_t        *prefix,
+              pdf_uchar_t        suffix)
 {
-  lzw_code_t index;
-  pdf_bool_t must_add;
-
-  if (s->prefix == LZW_NULL_INDEX)
-    {
-      s->prefix = s->suffix;
-      return PDF_FALSE; /* The string is a basic character, found! */
-    }
+  pdf_u32_t key;
+  pdf_u32_t index;
 
-  index = d->table[s->prefix].first;
+  key = LZW_HASH_KEY (*prefix, suffix);
+  index = LZW_HASH_INDEX (key);
 
-  if (index == LZW_NULL_INDEX)
-    {
-      d->table[s->prefix].first = d->size;
-    }
-  else
+  while (d->table[index] != 0)
     {
-      must_add = PDF_FALSE;
-      while (!must_add)
+      if ((d->table[index] >> LZW_MAX_BITSIZE) == key)
         {
-          if (s->suffix == d->table[index].suffix)
-            {
-              s->prefix = index;
-              return PDF_FALSE; /* The string is already in the table, found! */
-            }
-          else if (s->suffix < d->table[index].suffix)
-            {
-              if (d->table[index].left == LZW_NULL_INDEX)
-                {
-                  d->table[index].left = d->size;
-                  must_add = PDF_TRUE;
-                }
-              else
-                {
-                  index = d->table[index].left;
-                }
-            }
-          else
-            {
-              if (d->table[index].right == LZW_NULL_INDEX)
-                {
-                  d->table[index].right = d->size;
-                  must_add = PDF_TRUE;
-                }
-              else
-                {
-                  index = d->table[index].right;
-                }
-            }
+          *prefix = d->table[index] & (LZW_MAX_DICTSIZE - 1);
+          return PDF_FALSE; /* The string is already in the table, found! */
         }
+      index = (index + 1) & (LZW_HASH_SIZE - 1);
     }
 
-  d->table[d->size++] = *s;
+  d->table[index] = (key << LZW_MAX_BITSIZE) | d->size++;
 
   return PDF_TRUE;
 }
@@ -302,35 +234,6 @@ lzw_dict_reset (struct lzw_dict_s *dict)
   lzw_dict_init (dict);
 }
 
-static void
-lzw_dict_fast_add (struct lzw_dict_s *d,
-                   lzw_code_t         prefix,
-                   pdf_uchar_t        suffix)
-{
-  d->table[d->size].prefix = prefix;
-  d->table[d->size].suffix = suffix;
-  d->size++;
-}
-
-static void
-lzw_dict_decode (struct lzw_dict_s  *d,
-                 lzw_code_t          code,
-                 pdf_uchar_t       **decode,
-                 pdf_size_t         *size)
-{
-  *size = 0;
-
-  do
-    {
-      *(*decode)-- = d->table[code].suffix;
-      ++(*size);
-      code = d->table[code].prefix;
-    }
-  while (code != LZW_NULL_INDEX);
-
-  (*decode)++;
-}
-
 /* -- THE ENCODER -- */
 
 struct lzwenc_state_s
@@ -342,7 +245,7 @@ struct lzwenc_state_s
   pdf_bool_t           must_reset;
   struct lzw_buffer_s  buffer;
   struct lzw_dict_s    dict;
-  struct lzw_string_s  string;
+  lzw_code_t           prefix;
 
   pdf_bool_t           really_finish;
 };
@@ -376,13 +279,24 @@ stm_f_lzwenc_init (const pdf_hash_t  *params,
                                                       LZW_PARAM_EARLY_CHANGE);
     }
 
+  stm_f_lzwenc_reset (filter_state, NULL);
+
+  *state = filter_state;
+  return PDF_TRUE;
+}
+
+static pdf_bool_t
+stm_f_lzwenc_reset (void         *state,
+                    pdf_error_t **error)
+{
+  struct lzwenc_state_s *filter_state = state;
+
   lzw_buffer_init (&filter_state->buffer, LZW_MIN_BITSIZE);
   lzw_dict_init (&filter_state->dict);
-  lzw_string_init (&filter_state->string);
+  filter_state->prefix = LZW_NULL_INDEX;
   filter_state->must_reset = PDF_TRUE;
   filter_state->really_finish = PDF_FALSE;
 
-  *state = filter_state;
   return PDF_TRUE;
 }
 
@@ -410,51 +324,64 @@ stm_f_lzwenc_apply (void          *state,
       st->must_reset = PDF_FALSE;
     }
 
+  if (st->prefix == LZW_NULL_INDEX &&
+      !pdf_buffer_eob_p (in))
+    st->prefix = in->data [in->rp++];
+
   while (!pdf_buffer_eob_p (in) &&
          !pdf_buffer_full_p (out))
     {
-      st->string.suffix = in->data [in->rp++];
-      if (lzw_dict_add (&st->dict, &st->string))
-        {
-          lzw_buffer_put_code (&st->buffer, st->string.prefix);
-          st->string.prefix = st->string.suffix;
+      pdf_uchar_t suffix;
 
-          if (st->dict.size == st->buffer.maxval - st->early_change)
+      suffix = in->data [in->rp++];
+      if (lzw_dict_add (&st->dict, &st->prefix, suffix))
+        {
+          lzw_buffer_put_code (&st->buffer, st->prefix);
+          st->prefix = suffix;
+
+          /* The decoder adds each string one code later than the
+           * encoder, and switches to a wider code once its next code
+           * (plus one with EarlyChange) doesn't fit anymore.  Reset
+           * before the table is full, as the TIFF encoders do. */
+          if (st->dict.size == LZW_MAX_DICTSIZE - 2)
+            {
+              lzw_buffer_put_code (&st->buffer, LZW_RESET_CODE);
+              lzw_buffer_set_bitsize (&st->buffer, LZW_MIN_BITSIZE);
+              lzw_dict_reset (&st->dict);
+            }
+          else if (st->dict.size ==
+                   st->buffer.maxval + 2 - st->early_change)
             {
               PDF_DEBUG_BASE ("[LZW encoder] Increasing bitsize... "
-                              "(dictsize[%d] == maxval[%d] - earlychange[%d])",
+                              "(dictsize[%d] == maxval[%d] + 2 - earlychange[%d])",
                               st->dict.size,
                               st->buffer.maxval,
                               st->early_change);
-              if (!lzw_buffer_inc_bitsize (&st->buffer))
-                {
-                  lzw_buffer_put_code (&st->buffer, LZW_RESET_CODE);
-                  lzw_buffer_set_bitsize (&st->buffer, LZW_MIN_BITSIZE);
-                  lzw_dict_reset (&st->dict);
-                }
+              lzw_buffer_inc_bitsize (&st->buffer);
             }
         }
     }
 
   if (finish)
     {
-      lzw_buffer_put_code (&st->buffer, st->string.prefix);
-      if (st->dict.size == st->buffer.maxval - st->early_change)
+      /* An empty input is encoded as just the reset and EOD codes */
+      if (st->prefix != LZW_NULL_INDEX)
         {
-          PDF_DEBUG_BASE ("[LZW encoder] Increasing bitsize (FINISHING)... "
-                          "(dictsize[%d] == maxval[%d] - earlychange[%d])",
-                          st->dict.size,
-                          st->buffer.maxval,
-                          st->early_change);
-          lzw_buffer_inc_bitsize (&st->buffer);
+          /* The decoder still adds a string after the last code */
+          lzw_buffer_put_code (&st->buffer, st->prefix);
+          if (st->dict.size + 1 == st->buffer.maxval + 2 - st->early_change)
+            {
+              PDF_DEBUG_BASE ("[LZW encoder] Increasing bitsize (FINISHING)... "
+                              "(dictsize[%d] + 1 == maxval[%d] + 2 - earlychange[%d])",
+                              st->dict.size,
+                              st->buffer.maxval,
+                              st->early_change);
+              lzw_buffer_inc_bitsize (&st->buffer);
+            }
         }
 
       lzw_buffer_put_code (&st->buffer, LZW_EOD_CODE);
-      lzw_buffer_put_code (&st->buffer, 0); /* flush */
-
-      /* Delete 0 byte if buffer was already aligned before flush.  */
-      if (out->data[out->wp - 1] == 0x0)
-        out->wp--;
+      lzw_buffer_put_padding (&st->buffer);
 
       st->really_finish = PDF_TRUE;
 
@@ -478,43 +405,83 @@ stm_f_lzwenc_deinit (void *state)
 
 /* -- THE DECODER -- */
 
-enum lzwdec_state
-  {
-    LZWDEC_STATE_START,
-    LZWDEC_STATE_CLEAN,
-    LZWDEC_STATE_WRITE,
-    LZWDEC_STATE_READ,
-    LZWDEC_STATE_LOOP_WRITE,
-    LZWDEC_STATE_LOOP_READ
-  };
+/*
+ * Each string added to the dictionary is the previously decoded string
+ * followed by the first character of the string decoded right after it.
+ * All the strings decoded since the last reset are therefore kept one
+ * after the other in a history buffer, so that any dictionary entry is
+ * just the offset and length of its string in the history, and decoding
+ * a code is a single memcpy.  The history starts with the 256 single
+ * character strings.
+ */
+struct lzwdec_entry_s
+{
+  pdf_u32_t offset;  /* Offset of the string in the history */
+  pdf_u16_t length;  /* Length of the string */
+  pdf_uchar_t first; /* First character of the string */
+};
+
+/* Initial size of the history, grown on demand */
+#define LZWDEC_HISTORY_SIZE  (64 * 1024)
+
+/* Strings up to this length are copied in fixed size blocks, which
+ * needs the same amount of slack after the end of both the history and
+ * the output. */
+#define LZWDEC_SHORT_STRING  16
+
+static inline void
+lzwdec_copy_short (pdf_uchar_t       *dst,
+                   const pdf_uchar_t *src)
+{
+  memcpy (dst, src, 8);
+  memcpy (dst + 8, src + 8, 8);
+}
 
 struct lzwdec_state_s
 {
   /* cached params */
   pdf_i32_t early_change;
 
-  /* state */
-  pdf_uchar_t  dec_buf [LZW_MAX_DICTSIZE];
-  pdf_uchar_t *decoded;
-  pdf_size_t   dec_size;
+  /* dictionary */
+  struct lzwdec_entry_s dict [LZW_MAX_DICTSIZE];
+  pdf_size_t dict_size;
+  pdf_uchar_t *history;
+  pdf_size_t history_size;
+  pdf_size_t history_wp;
 
-  lzw_code_t new_code;
-  lzw_code_t old_code;
+  /* code input */
+  pdf_u64_t valbuf;
+  int valbits;
+  int bitsize;
+  lzw_code_t maxval;
 
-  /* flow managment */
-  enum lzwdec_state state_pos;
-  pdf_error_t *tmp_error;
+  /* last decoded string */
+  lzw_code_t old_code;
+  pdf_size_t old_offset;
+  pdf_size_t old_length;
 
-  struct lzw_buffer_s buffer;
-  struct lzw_dict_s   dict;
+  /* part of the last decoded string not written yet */
+  pdf_size_t pending_offset;
+  pdf_size_t pending_size;
 };
 
+static void
+lzwdec_dict_reset (struct lzwdec_state_s *st)
+{
+  st->dict_size = LZW_FIRST_CODE;
+  st->history_wp = LZW_RESET_CODE;
+  st->bitsize = LZW_MIN_BITSIZE;
+  st->maxval = (1 << LZW_MIN_BITSIZE) - 1;
+  st->old_code = LZW_NULL_INDEX;
+}
+
 static pdf_bool_t
 stm_f_lzwdec_init (const pdf_hash_t  *params,
                    void             **state,
                    pdf_error_t      **error)
 {
   struct lzwdec_state_s *filter_state;
+  int i;
 
   filter_state = pdf_alloc (sizeof (struct lzwdec_state_s));
   if (!filter_state)
@@ -528,6 +495,29 @@ stm_f_lzwdec_init (const pdf_hash_t  *params,
       return PDF_FALSE;
     }
 
+  filter_state->history = pdf_alloc (LZWDEC_HISTORY_SIZE);
+  if (!filter_state->history)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot create LZW decoder internal state: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) LZWDEC_HISTORY_SIZE);
+      pdf_dealloc (filter_state);
+      return PDF_FALSE;
+    }
+  filter_state->history_size = LZWDEC_HISTORY_SIZE;
+
+  /* The single character strings never change */
+  for (i = 0; i < LZW_RESET_CODE; i++)
+    {
+      filter_state->history[i] = (pdf_uchar_t) i;
+      filter_state->dict[i].offset = i;
+      filter_state->dict[i].length = 1;
+      filter_state->dict[i].first = (pdf_uchar_t) i;
+    }
+
   filter_state->early_change = LZW_DEFAULT_EARLY_CHANGE; /* set default */
 
   /* EarlyChange is optional! */
@@ -537,76 +527,65 @@ stm_f_lzwdec_init (const pdf_hash_t  *params,
       filter_state->early_change = pdf_hash_get_bool (params, LZW_PARAM_EARLY_CHANGE);
     }
 
-  lzw_buffer_init (&filter_state->buffer, LZW_MIN_BITSIZE);
-  lzw_dict_init (&filter_state->dict);
-  filter_state->old_code = LZW_NULL_INDEX;
-  filter_state->decoded = filter_state->dec_buf + (LZW_MAX_DICTSIZE-2);
-  filter_state->dec_size = 0;
-  filter_state->state_pos = LZWDEC_STATE_START;
-  filter_state->tmp_error = NULL;
+  stm_f_lzwdec_reset (filter_state, NULL);
 
   *state = filter_state;
   return PDF_TRUE;
 }
 
-static void
-stm_f_lzwdec_deinit (void *state)
-{
-  pdf_dealloc (state);
-}
-
-/* Returns PDF_FALSE if no more output */
 static pdf_bool_t
-lzwdec_put_decoded (struct lzwdec_state_s *st,
-                    pdf_buffer_t          *out)
+stm_f_lzwdec_reset (void         *state,
+                    pdf_error_t **error)
 {
-  pdf_bool_t no_output = PDF_FALSE;
-
-  if (st->dec_size)
-    {
-      pdf_size_t to_write;
+  struct lzwdec_state_s *filter_state = state;
 
-      PDF_ASSERT (out->size >= out->wp);
+  lzwdec_dict_reset (filter_state);
+  filter_state->valbuf = 0;
+  filter_state->valbits = 0;
+  filter_state->pending_size = 0;
 
-      /* output the decoded string */
-      to_write = st->dec_size;
-      if (st->dec_size > (out->size - out->wp))
-        {
-          to_write = out->size - out->wp;
-          no_output = PDF_TRUE;
-        }
+  return PDF_TRUE;
+}
 
-      memcpy (out->data + out->wp, st->decoded, to_write);
-      out->wp += to_write;
-      st->decoded += to_write;
-      st->dec_size -= to_write;
-    }
+static void
+stm_f_lzwdec_deinit (void *state)
+{
+  struct lzwdec_state_s *filter_state = state;
 
-  return !no_output;
+  pdf_dealloc (filter_state->history);
+  pdf_dealloc (filter_state);
 }
 
-/* Returns PDF_FALSE if no more output */
+/* Make room for SIZE more bytes in the history */
 static pdf_bool_t
-lzwdec_put_code (struct lzwdec_state_s *st,
-                 pdf_buffer_t          *out,
-                 unsigned long          code)
+lzwdec_grow_history (struct lzwdec_state_s  *st,
+                     pdf_size_t              size,
+                     pdf_error_t           **error)
 {
-  if (pdf_buffer_full_p (out))
-    return PDF_FALSE;
+  pdf_size_t new_size;
+  pdf_uchar_t *new_history;
+
+  new_size = st->history_size;
+  while (new_size - st->history_wp < size)
+    new_size *= 2;
 
-  out->data [out->wp++] = (pdf_uchar_t) (code & 0xFF);
+  new_history = pdf_realloc (st->history, new_size);
+  if (!new_history)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "cannot grow LZW decoder history: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) new_size);
+      return PDF_FALSE;
+    }
+
+  st->history = new_history;
+  st->history_size = new_size;
   return PDF_TRUE;
 }
 
-#define LZWDEC_CHECK(st, pos, what)                         \
-  do {                                                      \
-    enum pdf_stm_filter_apply_status_e ret;                 \
-                                                            \
-    (st)->state_pos = (pos);                                \
-    if ((ret = (what)) != PDF_STM_FILTER_APPLY_STATUS_OK)	\
-      { return ret; }                                       \
-  } while (0);
-
 static enum pdf_stm_filter_apply_status_e
 stm_f_lzwdec_apply (void          *state,
                     pdf_buffer_t  *in,
@@ -615,109 +594,185 @@ stm_f_lzwdec_apply (void          *state,
                     pdf_error_t  **error)
 {
   struct lzwdec_state_s *st;
+  enum pdf_stm_filter_apply_status_e ret;
+  pdf_u64_t valbuf;
+  int valbits;
 
   st = state;
-  st->buffer.buf = in;
 
-  switch (st->state_pos)
+  /* Output what is left from the last decoded string */
+  if (st->pending_size > 0)
     {
-    case LZWDEC_STATE_START:
-      break;
-    case LZWDEC_STATE_CLEAN:
-      goto lzwdec_state_clean;
-    case LZWDEC_STATE_WRITE:
-      goto lzwdec_state_write;
-    case LZWDEC_STATE_READ:
-      goto lzwdec_state_read;
-    case LZWDEC_STATE_LOOP_WRITE:
-      goto lzwdec_state_loop_write;
-    case LZWDEC_STATE_LOOP_READ:
-      goto lzwdec_state_loop_read;
-    default:
-      break;
+      pdf_size_t to_write;
+
+      to_write = PDF_MIN (st->pending_size, out->size - out->wp);
+      memcpy (out->data + out->wp, st->history + st->pending_offset, to_write);
+      out->wp += to_write;
+      st->pending_offset += to_write;
+      st->pending_size -= to_write;
+
+      if (st->pending_size > 0)
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
     }
 
-  do
+  /* The bit buffer is kept in locals while decoding */
+  valbuf = st->valbuf;
+  valbits = st->valbits;
+
+  while (1)
     {
-      /* need a reset */
-      lzw_buffer_set_bitsize (&st->buffer, LZW_MIN_BITSIZE);
-      lzw_dict_reset (&st->dict);
+      lzw_code_t code;
+      pdf_size_t offset;
+      pdf_size_t length;
+      pdf_size_t to_write;
+
+      if (pdf_buffer_full_p (out))
+        {
+          ret = PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+          break;
+        }
+
+      /* Get the next code, refilling the bit buffer if needed */
+      if (valbits < st->bitsize)
+        {
+          while (valbits <= 56 &&
+                 !pdf_buffer_eob_p (in))
+            {
+              valbuf = (valbuf << 8) | in->data [in->rp++];
+              valbits += 8;
+            }
+
+          if (valbits < st->bitsize)
+            {
+              ret = (finish ?
+                     PDF_STM_FILTER_APPLY_STATUS_EOF :
+                     PDF_STM_FILTER_APPLY_STATUS_NO_INPUT);
+              break;
+            }
+        }
 
-      do
+      valbits -= st->bitsize;
+      code = (lzw_code_t) (valbuf >> valbits) & st->maxval;
+
+      if (code == LZW_RESET_CODE)
         {
-        lzwdec_state_clean:
-          LZWDEC_CHECK (st,
-                        LZWDEC_STATE_CLEAN,
-                        lzw_buffer_get_code (&st->buffer,
-                                             finish,
-                                             &st->new_code));
+          lzwdec_dict_reset (st);
+          continue;
         }
-      while (st->new_code == LZW_RESET_CODE);
 
-      if (st->new_code != LZW_EOD_CODE)
+      if (code == LZW_EOD_CODE)
         {
-        lzwdec_state_write:
-          st->state_pos = LZWDEC_STATE_WRITE;
-          if (!lzwdec_put_code (st, out, st->new_code))
-            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT; /* No more output */
-
-          st->old_code = st->new_code;
-
-        lzwdec_state_read:
-          LZWDEC_CHECK (st,
-                        LZWDEC_STATE_READ,
-                        lzw_buffer_get_code (&st->buffer,
-                                             finish,
-                                             &st->new_code));
+          ret = PDF_STM_FILTER_APPLY_STATUS_EOF;
+          break;
         }
 
-      while (st->new_code != LZW_EOD_CODE &&
-             st->new_code != LZW_RESET_CODE)
+      if (code > st->dict_size ||
+          (code == st->dict_size &&
+           st->old_code == LZW_NULL_INDEX))
         {
-          st->decoded = st->dec_buf + (LZW_MAX_DICTSIZE - 2);
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_EBADDATA,
+                         "Invalid code found in LZW decoder: %u",
+                         code);
+          ret = PDF_STM_FILTER_APPLY_STATUS_ERROR;
+          break;
+        }
 
-          /* Is new code in the dict? */
-          if (st->new_code < st->dict.size)
+      if (st->dict_size < LZW_MAX_DICTSIZE)
+        {
+          /* Append the decoded string to the history */
+          length = (code < st->dict_size ?
+                    st->dict[code].length :
+                    st->old_length + 1);
+
+          if (st->history_size - st->history_wp <
+              length + LZWDEC_SHORT_STRING &&
+              !lzwdec_grow_history (st,
+                                    length + LZWDEC_SHORT_STRING,
+                                    error))
             {
-              lzw_dict_decode (&st->dict, st->new_code,
-                               &st->decoded, &st->dec_size);
-              lzw_dict_fast_add (&st->dict, st->old_code, st->decoded[0]);
+              ret = PDF_STM_FILTER_APPLY_STATUS_ERROR;
+              break;
+            }
+
+          offset = st->history_wp;
+          if (code < st->dict_size)
+            {
+              if (length <= LZWDEC_SHORT_STRING)
+                lzwdec_copy_short (st->history + offset,
+                                   st->history + st->dict[code].offset);
+              else
+                memcpy (st->history + offset,
+                        st->history + st->dict[code].offset,
+                        length);
             }
           else
             {
-              lzw_dict_decode (&st->dict, st->old_code,
-                               &st->decoded, &st->dec_size);
-              lzw_dict_fast_add (&st->dict, st->old_code, st->decoded[0]);
-              st->decoded [st->dec_size++] = st->decoded [0];
+              /* The string is the previous one plus its first char */
+              memcpy (st->history + offset,
+                      st->history + st->old_offset,
+                      st->old_length);
+              st->history[offset + st->old_length] =
+                st->dict[st->old_code].first;
             }
+          st->history_wp += length;
 
-          /* output the decoded string */
-        lzwdec_state_loop_write:
-          st->state_pos = LZWDEC_STATE_LOOP_WRITE;
-          if (!lzwdec_put_decoded (st, out))
-            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT; /* No more output */
-
-          if (st->dict.size == st->buffer.maxval - 1 - st->early_change)
+          /* The previous string plus the first char of this one is
+           * already in the history, just after it */
+          if (st->old_code != LZW_NULL_INDEX)
             {
-              lzw_buffer_inc_bitsize (&st->buffer);
-              /* break; We must wait for the reset code, don't reset yet. */
+              st->dict[st->dict_size].offset = st->old_offset;
+              st->dict[st->dict_size].length = st->old_length + 1;
+              st->dict[st->dict_size].first = st->dict[st->old_code].first;
+              st->dict_size++;
+
+              if (st->dict_size == st->maxval + 1 - st->early_change &&
+                  st->bitsize < LZW_MAX_BITSIZE)
+                {
+                  /* We must wait for the reset code, don't reset yet. */
+                  st->bitsize++;
+                  st->maxval = (1 << st->bitsize) - 1;
+                }
             }
 
-          /* get next code */
-          st->old_code = st->new_code;
+          st->old_offset = offset;
+          st->old_length = length;
+        }
+      else
+        {
+          /* The dictionary is full: no history needed until a reset */
+          offset = st->dict[code].offset;
+          length = st->dict[code].length;
+        }
+      st->old_code = code;
+
+      /* Output the decoded string */
+      if (length <= LZWDEC_SHORT_STRING &&
+          out->size - out->wp >= LZWDEC_SHORT_STRING)
+        {
+          lzwdec_copy_short (out->data + out->wp, st->history + offset);
+          out->wp += length;
+          continue;
+        }
+
+      to_write = PDF_MIN (length, out->size - out->wp);
+      memcpy (out->data + out->wp, st->history + offset, to_write);
+      out->wp += to_write;
 
-        lzwdec_state_loop_read:
-          LZWDEC_CHECK (st,
-                        LZWDEC_STATE_LOOP_READ,
-                        lzw_buffer_get_code (&st->buffer,
-                                             finish,
-                                             &st->new_code));
+      if (to_write < length)
+        {
+          st->pending_offset = offset + to_write;
+          st->pending_size = length - to_write;
+          ret = PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+          break;
         }
     }
-  while (st->new_code != LZW_EOD_CODE);
 
-  st->state_pos = LZWDEC_STATE_START;
-  return PDF_STM_FILTER_APPLY_STATUS_EOF;
+  st->valbuf = valbuf;
+  st->valbits = valbits;
+
+  return ret;
 }
 
 /* End of pdf_stm_f_lzw.c */
@@ -35,10 +35,11 @@
 #include <pdf-stm-f-md5.h>
 
 /* Define MD5 encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_md5enc_get,
-                       stm_f_md5enc_init,
-                       stm_f_md5enc_apply,
-                       stm_f_md5enc_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_md5enc_get,
+                             stm_f_md5enc_init,
+                             stm_f_md5enc_apply,
+                             stm_f_md5enc_deinit,
+                             stm_f_md5enc_reset);
 
 #define MD5_OUTPUT_SIZE 16
 
@@ -99,6 +100,24 @@ stm_f_md5enc_deinit (void *state)
   pdf_dealloc (state);
 }
 
+static pdf_bool_t
+stm_f_md5enc_reset (void         *state,
+                    pdf_error_t **error)
+{
+  struct pdf_stm_f_md5_s *filter_state = state;
+
+  /* Reading the hash starts it again, so that the data hashed before the
+   * reset is dropped */
+  if (!pdf_crypt_md_read (filter_state->md,
+                          (pdf_char_t *)filter_state->cache->data,
+                          filter_state->cache->size,
+                          error))
+    return PDF_FALSE;
+  pdf_buffer_rewind (filter_state->cache);
+
+  return PDF_TRUE;
+}
+
 static enum pdf_stm_filter_apply_status_e
 stm_f_md5enc_apply (void          *state,
                     pdf_buffer_t  *in,
@@ -117,7 +136,7 @@ stm_f_md5enc_apply (void          *state,
   in_size = in->wp - in->rp;
 
   if (!pdf_crypt_md_write (filter_state->md,
-                           (pdf_char_t *)in->data,
+                           (pdf_char_t *)in->data + in->rp,
                            in_size,
                            error))
     return PDF_STM_FILTER_APPLY_STATUS_ERROR;
@@ -145,7 +164,7 @@ stm_f_md5enc_apply (void          *state,
   cache_size = cache->wp - cache->rp;
   bytes_to_write = PDF_MIN (out_size, cache_size);
 
-  memcpy (out->data, cache->data + cache->rp, bytes_to_write);
+  memcpy (out->data + out->wp, cache->data + cache->rp, bytes_to_write);
 
   cache->rp += bytes_to_write;
   out->wp   += bytes_to_write;
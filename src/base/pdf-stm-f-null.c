@@ -32,9 +32,11 @@
 #include <pdf-stm-f-null.h>
 #include <pdf-hash.h>
 
-/* Define NULL filter */
-PDF_STM_FILTER_DEFINE_STATELESS (pdf_stm_f_null_get,
-                                 stm_f_null_apply);
+/* Define NULL filter. Filled input buffers are handed over to the output
+ * by the filter chain, so the apply method only copies data when the
+ * output buffer already holds some pending data. */
+PDF_STM_FILTER_DEFINE_PASSTHROUGH (pdf_stm_f_null_get,
+                                   stm_f_null_apply);
 
 static enum pdf_stm_filter_apply_status_e
 stm_f_null_apply (void          *state,
@@ -57,8 +59,8 @@ stm_f_null_apply (void          *state,
   bytes_to_copy = PDF_MIN (out_size, in_size);
   if (bytes_to_copy != 0)
     {
-      memcpy (out->data,
-              in->data,
+      memcpy (out->data + out->wp,
+              in->data + in->rp,
               bytes_to_copy);
 
       in->rp += bytes_to_copy;
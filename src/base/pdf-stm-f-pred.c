@@ -33,17 +33,24 @@
 #include <pdf-stm-f-pred.h>
 #include <pdf-hash-helper.h>
 
+#if defined __SSE2__
+# include <emmintrin.h>
+# define PRED_SSE2 1
+#endif /* __SSE2__ */
+
 /* Define predictor encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_predenc_get,
-                       stm_f_pred_init,
-                       stm_f_predenc_apply,
-                       stm_f_pred_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_predenc_get,
+                             stm_f_pred_init,
+                             stm_f_predenc_apply,
+                             stm_f_pred_deinit,
+                             stm_f_pred_reset);
 
 /* Define predictor decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_preddec_get,
-                       stm_f_pred_init,
-                       stm_f_preddec_apply,
-                       stm_f_pred_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_preddec_get,
+                             stm_f_pred_init,
+                             stm_f_preddec_apply,
+                             stm_f_pred_deinit,
+                             stm_f_pred_reset);
 
 #define PRED_PARAM_PREDICTOR "Predictor"
 #define PRED_PARAM_COLORS "Colors"
@@ -76,7 +83,8 @@ typedef enum
   PDF_STM_F_PREDDEC_PNG_SUB = 1,
   PDF_STM_F_PREDDEC_PNG_UP = 2,
   PDF_STM_F_PREDDEC_PNG_AVERAGE = 3,
-  PDF_STM_F_PREDDEC_PNG_PAETH = 4
+  PDF_STM_F_PREDDEC_PNG_PAETH = 4,
+  PDF_STM_F_PREDDEC_PNG_OPTIMUM = 5 /* encoder only: best type per row */
 } pdf_stm_f_predec_png_type_t;
 
 
@@ -84,6 +92,14 @@ typedef enum
 
 /* Configuration structure */
 
+/* Encoder or decoder of a PNG row: filters the LEN bytes of IN into OUT,
+   given the previous row of image data PREV and BPP bytes per pixel */
+typedef void (*pred_png_row_fn_t) (const pdf_uchar_t *in,
+                                   pdf_uchar_t       *out,
+                                   const pdf_uchar_t *prev,
+                                   pdf_size_t         len,
+                                   pdf_size_t         bpp);
+
 /* Private state */
 
 typedef struct pdf_stm_f_pred_s
@@ -109,6 +125,12 @@ typedef struct pdf_stm_f_pred_s
                                      row. Default value: 1 */
 
   pdf_size_t scanline_len;        /* will be calculated from params */
+  pdf_size_t bpp;                 /* bytes per pixel, at least 1; the
+                                     distance back used by the PNG
+                                     predictors */
+
+  /* PNG row decoders, indexed by the filter type of the row */
+  pred_png_row_fn_t png_decode_row[PDF_STM_F_PREDDEC_PNG_PAETH + 1];
 
   /* previous and current buffers for scanlines (rows) 
      encoder uses prev_row_buf for last input row to the filter
@@ -118,8 +140,13 @@ typedef struct pdf_stm_f_pred_s
 
   /* buffer for output scanline (already filtered) */
   pdf_buffer_t *out_row_buf;
+
+  /* scratch buffer for the rows encoded with PNG predictors, or NULL */
+  pdf_buffer_t *try_row_buf;
 } pdf_stm_f_pred_t;
 
+static void png_select_decoders (pdf_stm_f_pred_t *fs);
+
 
 #define PNG_ENC_PREDICTOR_P(pred)                      \
   ((pred) == PDF_STM_F_PREDENC_PNG_NONE_ALL_ROWS ||    \
@@ -279,9 +306,7 @@ stm_f_pred_init (const pdf_hash_t  *params,
       if ((method >= PDF_STM_F_PREDDICT_PNG_NONE_ALL_ROWS)
 	  && (method <= PDF_STM_F_PREDDICT_PNG_OPTIMUM)) {
 	filter_state->type = PDF_STM_F_PREDDEC_PNG;
-	filter_state->predictor = method == PDF_STM_F_PREDDICT_PNG_OPTIMUM
-	  ? PDF_STM_F_PREDDICT_PNG_PAETH_ALL_ROWS
-	  : method - 10;
+	filter_state->predictor = method - PDF_STM_F_PREDDICT_PNG_NONE_ALL_ROWS;
       }
       else {
 	if (method == PDF_STM_F_PREDDICT_TIFF_PREDICTOR_2) {
@@ -303,7 +328,9 @@ stm_f_pred_init (const pdf_hash_t  *params,
    * is multiplier of eight. */
   actual_len = filter_state->columns * filter_state->colors * 
                filter_state->bits_per_component;
-  filter_state->scanline_len = (actual_len >> 3) + (actual_len & 7); 
+  filter_state->scanline_len = (actual_len + 7) >> 3;
+  filter_state->bpp = (filter_state->colors * filter_state->bits_per_component
+                       + 7) >> 3;
 
   /* one extra byte for PNG predictor */
   filter_state->prev_row_buf = pdf_buffer_new (filter_state->scanline_len + 1,
@@ -319,9 +346,10 @@ stm_f_pred_init (const pdf_hash_t  *params,
       return PDF_FALSE;
     }
 
-  /* hint for further optimizing (if necessary): if scanlines are smaller than 
-     in and out buffers, curr_row_buf and out_row_buf are not needed and two 
-     memcpys per scanline can be omitted */
+  /* rows are only gathered in curr_row_buf when they are split across
+     input buffers; hint for further optimizing (if necessary): if
+     scanlines are smaller than the out buffer, out_row_buf is not needed
+     and one memcpy per scanline can be omitted */
   filter_state->curr_row_buf = pdf_buffer_new (filter_state->scanline_len + 1, 
                                                error);
   if (!(filter_state->curr_row_buf))
@@ -347,136 +375,767 @@ stm_f_pred_init (const pdf_hash_t  *params,
       return PDF_FALSE;
     }
 
+  filter_state->try_row_buf = NULL;
+  if (filter_state->type == PDF_STM_F_PREDDEC_PNG)
+    {
+      filter_state->try_row_buf =
+        pdf_buffer_new (filter_state->scanline_len + 1, error);
+      if (!(filter_state->try_row_buf))
+        {
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_ENOMEM,
+                         "cannot create predictor encoder/decoder internal "
+                         "buffer: couldn't allocate %lu bytes",
+                         (unsigned long) filter_state->scanline_len + 1);
+          return PDF_FALSE;
+        }
+    }
+
+  png_select_decoders (filter_state);
+
   *state = filter_state;
+  return stm_f_pred_reset (filter_state, error);
+}
+
+static pdf_bool_t
+stm_f_pred_reset (void         *state,
+                  pdf_error_t **error)
+{
+  pdf_stm_f_pred_t *filter_state = state;
+
+  pdf_buffer_rewind (filter_state->prev_row_buf);
+  pdf_buffer_rewind (filter_state->curr_row_buf);
+  pdf_buffer_rewind (filter_state->out_row_buf);
+  if (filter_state->try_row_buf)
+    pdf_buffer_rewind (filter_state->try_row_buf);
+
+  /* Both the encoder and the decoder start with an all-zeros previous
+     row */
+  memset (filter_state->prev_row_buf->data, 0,
+          filter_state->prev_row_buf->size);
+  memset (filter_state->out_row_buf->data, 0,
+          filter_state->out_row_buf->size);
+
   return PDF_TRUE;
 }
 
 
+
+/*
+ * PNG row decoders.
+ *
+ * The PNG filters work on bytes: `a' is the byte `bpp' positions back in
+ * the current row (the same component of the previous pixel), `b' is the
+ * byte above it in the previous row and `c' the one above `a'.  Bytes
+ * before the start of a row count as zero, and so does the previous row
+ * of the first one, which is kept zeroed in `prev_row_buf'.
+ *
+ * A set of kernels is chosen at init time from the number of bytes per
+ * pixel; each row then picks one of them from its filter type byte.
+ */
+
 static void
-encode_row_none(pdf_uchar_t* cur, 
-                pdf_uchar_t* prev, 
-                pdf_uchar_t* out,
-                pdf_stm_f_pred_t* state) 
+png_decode_none (const pdf_uchar_t *in,
+                 pdf_uchar_t       *cur,
+                 const pdf_uchar_t *prev,
+                 pdf_size_t         len,
+                 pdf_size_t         bpp)
+{
+  memcpy (cur, in, len);
+}
+
+static inline void
+png_decode_sub (const pdf_uchar_t *in,
+                pdf_uchar_t       *cur,
+                const pdf_uchar_t *prev,
+                pdf_size_t         len,
+                pdf_size_t         bpp)
+{
+  pdf_size_t i;
+
+  for (i = 0; i < bpp && i < len; i++)
+    cur[i] = in[i];
+  for (; i < len; i++)
+    cur[i] = in[i] + cur[i - bpp];
+}
+
+static inline void
+png_decode_up (const pdf_uchar_t *in,
+               pdf_uchar_t       *cur,
+               const pdf_uchar_t *prev,
+               pdf_size_t         len,
+               pdf_size_t         bpp)
 {
-  memcpy(out, cur, state->scanline_len);
+  pdf_size_t i;
+
+  for (i = 0; i < len; i++)
+    cur[i] = in[i] + prev[i];
 }
 
+static inline void
+png_decode_average (const pdf_uchar_t *in,
+                    pdf_uchar_t       *cur,
+                    const pdf_uchar_t *prev,
+                    pdf_size_t         len,
+                    pdf_size_t         bpp)
+{
+  pdf_size_t i;
+
+  for (i = 0; i < bpp && i < len; i++)
+    cur[i] = in[i] + (prev[i] >> 1);
+  for (; i < len; i++)
+    cur[i] = in[i] + ((cur[i - bpp] + prev[i]) >> 1);
+}
+
+/* Paeth predictor without branches, which would be mispredicted all the
+ * time on image data: ties go to `a', then to `b' */
+static inline int
+png_paeth (int a,
+           int b,
+           int c)
+{
+  int pa;
+  int pb;
+  int pc;
+  int use_a;
+  int use_b;
+
+  pa = abs (b - c);
+  pb = abs (a - c);
+  pc = abs (a + b - c - c);
+
+  use_a = -((pa <= pb) & (pa <= pc));
+  use_b = -(pb <= pc);
+
+  return (a & use_a) | (~use_a & ((b & use_b) | (c & ~use_b)));
+}
+
+static inline void
+png_decode_paeth (const pdf_uchar_t *in,
+                  pdf_uchar_t       *cur,
+                  const pdf_uchar_t *prev,
+                  pdf_size_t         len,
+                  pdf_size_t         bpp)
+{
+  pdf_size_t i;
+
+  /* With a = c = 0 the predictor is always b */
+  for (i = 0; i < bpp && i < len; i++)
+    cur[i] = in[i] + prev[i];
+  for (; i < len; i++)
+    cur[i] = in[i] + png_paeth (cur[i - bpp], prev[i], prev[i - bpp]);
+}
+
+/* Versions of the generic kernels with a constant pixel size, so that the
+ * compiler can unroll the inner loops */
+#define PNG_DECODE_BPP(name, n)                                 \
+  static void                                                   \
+  name##_##n (const pdf_uchar_t *in,                            \
+              pdf_uchar_t       *cur,                           \
+              const pdf_uchar_t *prev,                          \
+              pdf_size_t         len,                           \
+              pdf_size_t         bpp)                           \
+  {                                                             \
+    name (in, cur, prev, len, n);                               \
+  }
+
+PNG_DECODE_BPP (png_decode_up, 1)
+PNG_DECODE_BPP (png_decode_sub, 1)
+PNG_DECODE_BPP (png_decode_sub, 2)
+PNG_DECODE_BPP (png_decode_sub, 3)
+PNG_DECODE_BPP (png_decode_sub, 4)
+PNG_DECODE_BPP (png_decode_average, 1)
+PNG_DECODE_BPP (png_decode_average, 2)
+PNG_DECODE_BPP (png_decode_average, 3)
+PNG_DECODE_BPP (png_decode_average, 4)
+PNG_DECODE_BPP (png_decode_paeth, 1)
+PNG_DECODE_BPP (png_decode_paeth, 2)
+PNG_DECODE_BPP (png_decode_paeth, 3)
+PNG_DECODE_BPP (png_decode_paeth, 4)
+
 static void
-encode_row_sub(pdf_uchar_t* cur, 
-               pdf_uchar_t* prev, 
-               pdf_uchar_t* out,
-               pdf_stm_f_pred_t* state)
+png_decode_sub_n (const pdf_uchar_t *in,
+                  pdf_uchar_t       *cur,
+                  const pdf_uchar_t *prev,
+                  pdf_size_t         len,
+                  pdf_size_t         bpp)
+{
+  png_decode_sub (in, cur, prev, len, bpp);
+}
+
+static void
+png_decode_average_n (const pdf_uchar_t *in,
+                      pdf_uchar_t       *cur,
+                      const pdf_uchar_t *prev,
+                      pdf_size_t         len,
+                      pdf_size_t         bpp)
+{
+  png_decode_average (in, cur, prev, len, bpp);
+}
+
+static void
+png_decode_paeth_n (const pdf_uchar_t *in,
+                    pdf_uchar_t       *cur,
+                    const pdf_uchar_t *prev,
+                    pdf_size_t         len,
+                    pdf_size_t         bpp)
+{
+  png_decode_paeth (in, cur, prev, len, bpp);
+}
+
+#if defined PRED_SSE2
+
+/*
+ * SSE2 kernels.  Up is a plain vertical add.  Sub is a running sum along
+ * the row, done as a prefix sum over whole pixels inside each 16-byte
+ * register plus the last pixel of the previous register.  Average and
+ * Paeth depend on the pixel just decoded, so they work one pixel at a
+ * time, but keep it in a register for RGB and RGBA/CMYK data.  Only the
+ * 16-byte steps fully inside the row are vectorised; the remaining bytes
+ * go through the scalar loops.
+ */
+
+static void
+png_decode_up_sse2 (const pdf_uchar_t *in,
+                    pdf_uchar_t       *cur,
+                    const pdf_uchar_t *prev,
+                    pdf_size_t         len,
+                    pdf_size_t         bpp)
 {
   pdf_size_t i;
-  *out++ = *cur++;
-  for (i = 1; i < state->scanline_len; i++) 
+
+  for (i = 0; i + 16 <= len; i += 16)
     {
-      *out++ = *cur - *(cur-1);
-      cur++;
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (prev + i));
+
+      _mm_storeu_si128 ((__m128i *) (cur + i), _mm_add_epi8 (x, b));
     }
+  for (; i < len; i++)
+    cur[i] = in[i] + prev[i];
+}
+
+/* Finish a Sub row from byte I on */
+static inline void
+png_decode_sub_tail (const pdf_uchar_t *in,
+                     pdf_uchar_t       *cur,
+                     pdf_size_t         i,
+                     pdf_size_t         len,
+                     pdf_size_t         bpp)
+{
+  for (; i < len; i++)
+    cur[i] = in[i] + (i >= bpp ? cur[i - bpp] : 0);
 }
 
 static void
-encode_row_up(pdf_uchar_t* cur, 
-              pdf_uchar_t* prev, 
-              pdf_uchar_t* out,
-              pdf_stm_f_pred_t* state)
+png_decode_sub_sse2_1 (const pdf_uchar_t *in,
+                       pdf_uchar_t       *cur,
+                       const pdf_uchar_t *prev,
+                       pdf_size_t         len,
+                       pdf_size_t         bpp)
 {
+  __m128i last = _mm_setzero_si128 ();
   pdf_size_t i;
-  if (prev != NULL) 
+
+  for (i = 0; i + 16 <= len; i += 16)
     {
-      for (i = 0; i < state->scanline_len; i++)
-        {
-          *out++ = *cur++ - *prev++;
-        }
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 1));
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 2));
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 4));
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 8));
+      x = _mm_add_epi8 (x, last);
+      _mm_storeu_si128 ((__m128i *) (cur + i), x);
+
+      /* Broadcast the last byte */
+      last = _mm_unpackhi_epi8 (x, x);
+      last = _mm_shufflehi_epi16 (last, 0xFF);
+      last = _mm_shuffle_epi32 (last, 0xFF);
     }
-  else
+  png_decode_sub_tail (in, cur, i, len, 1);
+}
+
+static void
+png_decode_sub_sse2_3 (const pdf_uchar_t *in,
+                       pdf_uchar_t       *cur,
+                       const pdf_uchar_t *prev,
+                       pdf_size_t         len,
+                       pdf_size_t         bpp)
+{
+  const __m128i mask = _mm_cvtsi32_si128 (0xFFFFFF);
+  __m128i last = _mm_setzero_si128 ();
+  pdf_size_t i;
+
+  /* Four pixels per step; the top four bytes of each store are garbage,
+     rewritten by the next step or by the scalar tail */
+  for (i = 0; i + 16 <= len; i += 12)
     {
-      memcpy(out, cur, state->scanline_len);
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 3));
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 6));
+      x = _mm_add_epi8 (x, last);
+      _mm_storeu_si128 ((__m128i *) (cur + i), x);
+
+      /* Repeat the fourth pixel over the low twelve bytes */
+      last = _mm_and_si128 (_mm_srli_si128 (x, 9), mask);
+      last = _mm_or_si128 (last, _mm_slli_si128 (last, 3));
+      last = _mm_or_si128 (last, _mm_slli_si128 (last, 6));
     }
+  png_decode_sub_tail (in, cur, i, len, 3);
 }
 
 static void
-encode_row_average(pdf_uchar_t* cur,
-                   pdf_uchar_t* prev,
-                   pdf_uchar_t* out,
-                   pdf_stm_f_pred_t* state)
+png_decode_sub_sse2_4 (const pdf_uchar_t *in,
+                       pdf_uchar_t       *cur,
+                       const pdf_uchar_t *prev,
+                       pdf_size_t         len,
+                       pdf_size_t         bpp)
 {
+  __m128i last = _mm_setzero_si128 ();
   pdf_size_t i;
-  if (prev != NULL)
+
+  for (i = 0; i + 16 <= len; i += 16)
     {
-      *out++ = *cur++ - (*prev++ >> 1);
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
 
-      for (i = 1; i < state->scanline_len; i++) 
-        {
-          *out++ = *cur - (pdf_uchar_t)(((int)*(cur-1) + (int)*prev) >> 1);
-          cur++;
-          prev++;
-        }
-    } 
-  else 
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 4));
+      x = _mm_add_epi8 (x, _mm_slli_si128 (x, 8));
+      x = _mm_add_epi8 (x, last);
+      _mm_storeu_si128 ((__m128i *) (cur + i), x);
+
+      last = _mm_shuffle_epi32 (x, 0xFF);
+    }
+  png_decode_sub_tail (in, cur, i, len, 4);
+}
+
+/* Load and store a single pixel of N (3 or 4) bytes.  RGB pixels are
+ * moved as four bytes while a whole fourth byte is left in the row: the
+ * extra lane is garbage, but the lanes never mix and the byte stored past
+ * the pixel is overwritten by the next one */
+static inline __m128i
+png_load_pixel (const pdf_uchar_t *p,
+                pdf_size_t         n)
+{
+  pdf_u32_t v = 0;
+
+  memcpy (&v, p, n);
+  return _mm_cvtsi32_si128 (v);
+}
+
+static inline void
+png_store_pixel (pdf_uchar_t *p,
+                 __m128i      x,
+                 pdf_size_t   n)
+{
+  pdf_u32_t v = _mm_cvtsi128_si32 (x);
+
+  memcpy (p, &v, n);
+}
+
+/* Decode a pixel X given the left one A and the one above B */
+static inline __m128i
+png_average_step (__m128i a,
+                  __m128i b,
+                  __m128i x)
+{
+  __m128i avg;
+
+  /* pavgb rounds up; the low bit of a ^ b says when it did */
+  avg = _mm_avg_epu8 (a, b);
+  avg = _mm_sub_epi8 (avg, _mm_and_si128 (_mm_xor_si128 (a, b),
+                                          _mm_set1_epi8 (1)));
+  return _mm_add_epi8 (x, avg);
+}
+
+static inline void
+png_decode_average_sse2 (const pdf_uchar_t *in,
+                         pdf_uchar_t       *cur,
+                         const pdf_uchar_t *prev,
+                         pdf_size_t         len,
+                         pdf_size_t         bpp)
+{
+  __m128i a = _mm_setzero_si128 ();
+  pdf_size_t i;
+
+  for (i = 0; i + 4 <= len; i += bpp)
     {
-      *out++ = *cur++;
+      a = png_average_step (a,
+                            png_load_pixel (prev + i, 4),
+                            png_load_pixel (in + i, 4));
+      png_store_pixel (cur + i, a, 4);
+    }
+  if (i + bpp <= len)
+    {
+      a = png_average_step (a,
+                            png_load_pixel (prev + i, bpp),
+                            png_load_pixel (in + i, bpp));
+      png_store_pixel (cur + i, a, bpp);
+      i += bpp;
+    }
 
-      for (i = 1; i < state->scanline_len; i++) 
-        {
-          *out++ = *cur - (*(cur-1) >> 1);
-          cur++;
-        }
+  /* Partial pixel left when the samples are smaller than a byte */
+  for (; i < len; i++)
+    cur[i] = in[i] + (((i >= bpp ? cur[i - bpp] : 0) + prev[i]) >> 1);
+}
+
+/* Paeth predictor of the neighbours A, B and C of each pixel.  Everything
+ * is unpacked to 16-bit lanes, so that the distances don't overflow */
+static inline __m128i
+png_paeth_sse2 (__m128i a,
+                __m128i b,
+                __m128i c)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i pa;
+  __m128i pb;
+  __m128i pc;
+  __m128i smallest;
+  __m128i nearest;
+  __m128i mask;
+
+  /* p - a = b - c, p - b = a - c and p - c = (b - c) + (a - c) */
+  pa = _mm_sub_epi16 (b, c);
+  pb = _mm_sub_epi16 (a, c);
+  pc = _mm_add_epi16 (pa, pb);
+
+  pa = _mm_max_epi16 (pa, _mm_sub_epi16 (zero, pa));
+  pb = _mm_max_epi16 (pb, _mm_sub_epi16 (zero, pb));
+  pc = _mm_max_epi16 (pc, _mm_sub_epi16 (zero, pc));
+
+  smallest = _mm_min_epi16 (pc, _mm_min_epi16 (pa, pb));
+
+  mask = _mm_cmpeq_epi16 (smallest, pb);
+  nearest = _mm_or_si128 (_mm_and_si128 (mask, b),
+                          _mm_andnot_si128 (mask, c));
+  mask = _mm_cmpeq_epi16 (smallest, pa);
+  return _mm_or_si128 (_mm_and_si128 (mask, a),
+                       _mm_andnot_si128 (mask, nearest));
+}
+
+/* Decode a pixel X given its neighbours A, B and C, all unpacked */
+static inline __m128i
+png_paeth_step (__m128i a,
+                __m128i b,
+                __m128i c,
+                __m128i x)
+{
+  /* Wrap around each byte; the high bytes of the lanes stay zero */
+  return _mm_add_epi8 (x, png_paeth_sse2 (a, b, c));
+}
+
+static inline void
+png_decode_paeth_sse2 (const pdf_uchar_t *in,
+                       pdf_uchar_t       *cur,
+                       const pdf_uchar_t *prev,
+                       pdf_size_t         len,
+                       pdf_size_t         bpp)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i a = zero;
+  __m128i b;
+  __m128i c = zero;
+  pdf_size_t i;
+
+  for (i = 0; i + 4 <= len; i += bpp)
+    {
+      b = _mm_unpacklo_epi8 (png_load_pixel (prev + i, 4), zero);
+      a = png_paeth_step (a, b, c,
+                          _mm_unpacklo_epi8 (png_load_pixel (in + i, 4),
+                                             zero));
+      png_store_pixel (cur + i, _mm_packus_epi16 (a, a), 4);
+      c = b;
     }
+  if (i + bpp <= len)
+    {
+      b = _mm_unpacklo_epi8 (png_load_pixel (prev + i, bpp), zero);
+      a = png_paeth_step (a, b, c,
+                          _mm_unpacklo_epi8 (png_load_pixel (in + i, bpp),
+                                             zero));
+      png_store_pixel (cur + i, _mm_packus_epi16 (a, a), bpp);
+      i += bpp;
+    }
+
+  for (; i < len; i++)
+    cur[i] = in[i] + (i >= bpp
+                      ? png_paeth (cur[i - bpp], prev[i], prev[i - bpp])
+                      : prev[i]);
+}
+
+PNG_DECODE_BPP (png_decode_average_sse2, 3)
+PNG_DECODE_BPP (png_decode_average_sse2, 4)
+PNG_DECODE_BPP (png_decode_paeth_sse2, 3)
+PNG_DECODE_BPP (png_decode_paeth_sse2, 4)
+
+#endif /* PRED_SSE2 */
+
+/* Pick the PNG row decoders for the pixel size of the image */
+static void
+png_select_decoders (pdf_stm_f_pred_t *fs)
+{
+  pred_png_row_fn_t *fns = fs->png_decode_row;
+
+  fns[PDF_STM_F_PREDDEC_PNG_NONE] = png_decode_none;
+  fns[PDF_STM_F_PREDDEC_PNG_UP] = png_decode_up_1;
+
+  switch (fs->bpp)
+    {
+    case 1:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_1;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_1;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_1;
+      break;
+    case 2:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_2;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_2;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_2;
+      break;
+    case 3:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_3;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_3;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_3;
+      break;
+    case 4:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_4;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_4;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_4;
+      break;
+    default:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_n;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_n;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_n;
+      break;
+    }
+
+#if defined PRED_SSE2
+  fns[PDF_STM_F_PREDDEC_PNG_UP] = png_decode_up_sse2;
+
+  switch (fs->bpp)
+    {
+    case 1:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_sse2_1;
+      break;
+    case 3:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_sse2_3;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_sse2_3;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_sse2_3;
+      break;
+    case 4:
+      fns[PDF_STM_F_PREDDEC_PNG_SUB] = png_decode_sub_sse2_4;
+      fns[PDF_STM_F_PREDDEC_PNG_AVERAGE] = png_decode_average_sse2_4;
+      fns[PDF_STM_F_PREDDEC_PNG_PAETH] = png_decode_paeth_sse2_4;
+      break;
+    default:
+      break;
+    }
+#endif /* PRED_SSE2 */
 }
 
+/*
+ * PNG row encoders.
+ *
+ * Unlike decoding, every byte of a filtered row only depends on the
+ * image data, so the same kernels serve any pixel size and the SSE2
+ * loops work on 16 bytes at a time.  The first pixel of a row, which
+ * has no left neighbour, is always done by the scalar code.
+ */
+
 static void
-encode_row_paeth (pdf_uchar_t* cur, 
-                  pdf_uchar_t* prev, 
-                  pdf_uchar_t* out,
-                  pdf_stm_f_pred_t* state)
+png_encode_none (const pdf_uchar_t *in,
+                 pdf_uchar_t       *out,
+                 const pdf_uchar_t *prev,
+                 pdf_size_t         len,
+                 pdf_size_t         bpp)
+{
+  memcpy (out, in, len);
+}
+
+static void
+png_encode_sub (const pdf_uchar_t *in,
+                pdf_uchar_t       *out,
+                const pdf_uchar_t *prev,
+                pdf_size_t         len,
+                pdf_size_t         bpp)
 {
   pdf_size_t i;
-  int p;
-  int pa;
-  int pb;
-  int pc;
 
-  if (prev != NULL) 
+  for (i = 0; i < bpp && i < len; i++)
+    out[i] = in[i];
+#if defined PRED_SSE2
+  for (; i + 16 <= len; i += 16)
     {
-      *out++ = *cur++ - *prev++; 
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+      __m128i a = _mm_loadu_si128 ((const __m128i *) (in + i - bpp));
 
-      for (i = 0; i < state->scanline_len; i++) 
-        {
-          p = *(cur-1) + *(prev) - *(prev-1);
-          pa = abs(p - *(cur-1));
-          pb = abs(p - *(prev));
-          pc = abs(p - *(prev-1));
+      _mm_storeu_si128 ((__m128i *) (out + i), _mm_sub_epi8 (x, a));
+    }
+#endif /* PRED_SSE2 */
+  for (; i < len; i++)
+    out[i] = in[i] - in[i - bpp];
+}
 
-          if (pa <= pb && pa <= pc) 
-            {
-              *out++ = *cur - *(cur-1);
-            }
-          else 
-            {
-              if (pb <= pc) 
-                {
-                  *out++ = *cur - *(prev);
-                }
-              else 
-                { 
-                  *out++ = *cur - *(prev-1);
-                }
-            }
+static void
+png_encode_up (const pdf_uchar_t *in,
+               pdf_uchar_t       *out,
+               const pdf_uchar_t *prev,
+               pdf_size_t         len,
+               pdf_size_t         bpp)
+{
+  pdf_size_t i = 0;
 
-          cur++;
-          prev++;
-        }
-    } 
-  else 
+#if defined PRED_SSE2
+  for (; i + 16 <= len; i += 16)
     {
-      *out++ = *cur++;
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (prev + i));
 
-      for (i = 1; i < state->scanline_len; i++) 
+      _mm_storeu_si128 ((__m128i *) (out + i), _mm_sub_epi8 (x, b));
+    }
+#endif /* PRED_SSE2 */
+  for (; i < len; i++)
+    out[i] = in[i] - prev[i];
+}
+
+static void
+png_encode_average (const pdf_uchar_t *in,
+                    pdf_uchar_t       *out,
+                    const pdf_uchar_t *prev,
+                    pdf_size_t         len,
+                    pdf_size_t         bpp)
+{
+  pdf_size_t i;
+
+  for (i = 0; i < bpp && i < len; i++)
+    out[i] = in[i] - (prev[i] >> 1);
+#if defined PRED_SSE2
+  for (; i + 16 <= len; i += 16)
+    {
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+      __m128i a = _mm_loadu_si128 ((const __m128i *) (in + i - bpp));
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (prev + i));
+      __m128i avg;
+
+      avg = _mm_avg_epu8 (a, b);
+      avg = _mm_sub_epi8 (avg, _mm_and_si128 (_mm_xor_si128 (a, b),
+                                              _mm_set1_epi8 (1)));
+      _mm_storeu_si128 ((__m128i *) (out + i), _mm_sub_epi8 (x, avg));
+    }
+#endif /* PRED_SSE2 */
+  for (; i < len; i++)
+    out[i] = in[i] - ((in[i - bpp] + prev[i]) >> 1);
+}
+
+static void
+png_encode_paeth (const pdf_uchar_t *in,
+                  pdf_uchar_t       *out,
+                  const pdf_uchar_t *prev,
+                  pdf_size_t         len,
+                  pdf_size_t         bpp)
+{
+  pdf_size_t i;
+
+  for (i = 0; i < bpp && i < len; i++)
+    out[i] = in[i] - prev[i];
+#if defined PRED_SSE2
+  for (; i + 16 <= len; i += 16)
+    {
+      const __m128i zero = _mm_setzero_si128 ();
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (in + i));
+      __m128i a = _mm_loadu_si128 ((const __m128i *) (in + i - bpp));
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (prev + i));
+      __m128i c = _mm_loadu_si128 ((const __m128i *) (prev + i - bpp));
+      __m128i lo;
+      __m128i hi;
+
+      lo = png_paeth_sse2 (_mm_unpacklo_epi8 (a, zero),
+                           _mm_unpacklo_epi8 (b, zero),
+                           _mm_unpacklo_epi8 (c, zero));
+      hi = png_paeth_sse2 (_mm_unpackhi_epi8 (a, zero),
+                           _mm_unpackhi_epi8 (b, zero),
+                           _mm_unpackhi_epi8 (c, zero));
+      _mm_storeu_si128 ((__m128i *) (out + i),
+                        _mm_sub_epi8 (x, _mm_packus_epi16 (lo, hi)));
+    }
+#endif /* PRED_SSE2 */
+  for (; i < len; i++)
+    out[i] = in[i] - png_paeth (in[i - bpp], prev[i], prev[i - bpp]);
+}
+
+static const pred_png_row_fn_t png_encode_row[] =
+  {
+    png_encode_none,
+    png_encode_sub,
+    png_encode_up,
+    png_encode_average,
+    png_encode_paeth
+  };
+
+/* Cost of a filtered row for the choice of its filter type: the sum of
+ * its bytes taken as signed values, as the PNG specification suggests.
+ * Rows of small differences compress better with Flate. */
+static pdf_size_t
+png_row_cost (const pdf_uchar_t *row,
+              pdf_size_t         len)
+{
+  pdf_size_t cost = 0;
+  pdf_size_t i = 0;
+
+#if defined PRED_SSE2
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i acc = zero;
+  pdf_u64_t sum;
+
+  for (; i + 16 <= len; i += 16)
+    {
+      __m128i x = _mm_loadu_si128 ((const __m128i *) (row + i));
+
+      /* |x| as unsigned bytes is the smallest of x and -x */
+      x = _mm_min_epu8 (x, _mm_sub_epi8 (zero, x));
+      acc = _mm_add_epi64 (acc, _mm_sad_epu8 (x, zero));
+    }
+  acc = _mm_add_epi64 (acc, _mm_unpackhi_epi64 (acc, acc));
+  _mm_storel_epi64 ((__m128i *) &sum, acc);
+  cost = sum;
+#endif /* PRED_SSE2 */
+
+  for (; i < len; i++)
+    cost += (row[i] < 128 ? row[i] : 256 - row[i]);
+  return cost;
+}
+
+/* Filter a row with every PNG filter type and keep the cheapest one in
+ * `out_row_buf', using `try_row_buf' as scratch space */
+static void
+png_encode_optimum (const pdf_uchar_t *in,
+                    const pdf_uchar_t *prev,
+                    pdf_stm_f_pred_t  *fs)
+{
+  pdf_buffer_t *tmp;
+  pdf_size_t best_cost;
+  pdf_size_t cost;
+  int type;
+
+  fs->out_row_buf->data[0] = PDF_STM_F_PREDDEC_PNG_NONE;
+  png_encode_none (in, fs->out_row_buf->data + 1, prev,
+                   fs->scanline_len, fs->bpp);
+  best_cost = png_row_cost (fs->out_row_buf->data + 1, fs->scanline_len);
+
+  for (type = PDF_STM_F_PREDDEC_PNG_SUB;
+       type <= PDF_STM_F_PREDDEC_PNG_PAETH && best_cost > 0;
+       type++)
+    {
+      fs->try_row_buf->data[0] = type;
+      png_encode_row[type] (in, fs->try_row_buf->data + 1, prev,
+                            fs->scanline_len, fs->bpp);
+      cost = png_row_cost (fs->try_row_buf->data + 1, fs->scanline_len);
+      if (cost < best_cost)
         {
-          *out++ = *cur - *(cur-1);
-          cur++;
+          best_cost = cost;
+          tmp = fs->out_row_buf;
+          fs->out_row_buf = fs->try_row_buf;
+          fs->try_row_buf = tmp;
         }
     }
 }
@@ -579,15 +1238,16 @@ encode_row_sub_colorl8 (pdf_uchar_t *cur,
 static int
 encode_row (pdf_uchar_t *cur,
             pdf_uchar_t *prev,
-            pdf_uchar_t *out,
             pdf_stm_f_pred_t* state,
             pdf_error_t **error)
 {
+  pdf_uchar_t *out = state->out_row_buf->data;
+
   switch (state->type)
     {
     case PDF_STM_F_PREDDEC_NO_PREDICTION:
       {
-        encode_row_none(cur, prev, out, state);
+        memcpy (out, cur, state->scanline_len);
         break;
       }
     case PDF_STM_F_PREDDEC_TIFF_PREDICTOR_2:
@@ -624,185 +1284,18 @@ encode_row (pdf_uchar_t *cur,
 
         break;
       }
-    case PDF_STM_F_PREDDEC_PNG: {
-      switch (state->predictor) {
-      case PDF_STM_F_PREDDEC_PNG_NONE:
-	{
-	  encode_row_none (cur, prev, out, state);
-	  break;
-      }
-      case PDF_STM_F_PREDDEC_PNG_SUB:
-	{
-	  encode_row_sub (cur, prev, out, state);
-	  break;
-      }
-      case PDF_STM_F_PREDDEC_PNG_UP:
-	{
-	  encode_row_up(cur, prev, out, state);
-	  break;
-	}
-      case PDF_STM_F_PREDDEC_PNG_AVERAGE:
-	{
-	  encode_row_average(cur, prev, out, state);
-	  break;
-	}
-      case PDF_STM_F_PREDDEC_PNG_PAETH:
-	{
-	  encode_row_paeth(cur, prev, out, state);
-	  break;
-	}
-      default:
-	{
-	  pdf_set_error (error,
-			 PDF_EDOMAIN_BASE_STM,
-			 PDF_EBADDATA,
-			 "bad png predictor value in input data: "
-			 "expected 0, 1, 2, 3, 4 got %d",
-			 (state->predictor));
-	  return PDF_ERROR;
-	  break;
-	}
+    case PDF_STM_F_PREDDEC_PNG:
+      {
+        /* Each row starts with the filter type used for it, so the
+           best one is picked for every row whatever the PNG predictor
+           given */
+        png_encode_optimum (cur, prev, state);
+        break;
       }
     }
-    }
   return PDF_OK;
 }
 
-static void
-decode_row_none (pdf_uchar_t* in, 
-                 pdf_uchar_t* cur, 
-                 pdf_uchar_t* prev,
-                 pdf_stm_f_pred_t* state)
-{
-  memcpy (cur, in, state->scanline_len);
-}
-
-static void
-decode_row_sub (pdf_uchar_t* in, 
-                pdf_uchar_t* cur, 
-                pdf_uchar_t* prev,
-                pdf_stm_f_pred_t* state)
-{
-  pdf_size_t i;
-
-  *cur++ = *in++;
-
-  for (i = 1; i < state->scanline_len; i++) 
-    {
-      *cur = *in++ + *(cur-1);
-      cur++; 
-    }
-}
-
-static void
-decode_row_up (pdf_uchar_t* in, 
-               pdf_uchar_t* cur, 
-               pdf_uchar_t* prev,
-               pdf_stm_f_pred_t* state)
-{
-  pdf_size_t i;
-
-  if (prev != NULL) 
-    {
-      for (i = 0; i < state->scanline_len; i++)
-        {
-          *cur++ = *in++ + *prev++;
-        }
-
-    } 
-  else
-    {
-      memcpy (cur, in, state->scanline_len);
-    }
-}
-
-static void
-decode_row_average (pdf_uchar_t* in, 
-                    pdf_uchar_t* cur, 
-                    pdf_uchar_t* prev,
-                    pdf_stm_f_pred_t* state)
-{
-  pdf_size_t i;
-
-  if (prev != NULL) 
-    {
-      *cur++ = *in++ + (*prev++ >> 1);
-
-      for (i = 1; i < state->scanline_len; i++) 
-        {
-          *cur = *in++ + (pdf_uchar_t)(((int)*(cur-1) + (int)*prev) >> 1);
-          cur++;
-          prev++;
-        }
-    } 
-  else 
-    {
-      *cur++ = *in++;
-
-      for (i = 1; i < state->scanline_len; i++) 
-        {
-          *cur = *in++ + (*(cur-1) >> 1);
-          cur++;
-        }
-    }
-}
-
-static void
-decode_row_paeth (pdf_uchar_t* in, 
-                  pdf_uchar_t* cur, 
-                  pdf_uchar_t* prev,
-                  pdf_stm_f_pred_t* state)
-{
-  int p;
-  int pa;
-  int pb;
-  int pc;
-  pdf_size_t i;
-
-  if (prev != NULL) 
-    {
-      *cur++ = *in++ + *prev++; 
-
-      for (i = 0; i < state->scanline_len; i++) 
-        {
-          p = *(cur-1) + *(prev) - *(prev-1);
-          pa = abs(p - *(cur-1));
-          pb = abs(p - *(prev));
-          pc = abs(p - *(prev-1));
-
-          if (pa <= pb && pa <= pc) 
-            {
-              *cur = *in + *(cur-1);
-            }
-          else 
-            {
-              if (pb <= pc) 
-                {
-                  *cur = *in + *(prev);
-                }
-              else 
-                {
-                  *cur = *in + *(prev-1);
-                }
-            }
-
-          in++;
-          prev++;
-          cur++;
-        }
-    } 
-  else 
-    {
-      *cur++ = *in++;
-
-      for (i = 1; i < state->scanline_len; i++) 
-        {
-          *cur = *in++ + *(cur-1);
-          cur++; 
-        }
-    }
-}
-
 static void
 decode_row_sub_color16 (pdf_uchar_t* in, pdf_uchar_t* cur, pdf_uchar_t* prev,
                         pdf_stm_f_pred_t* state)
@@ -942,48 +1435,25 @@ decode_row (pdf_uchar_t* in,
       }
     case PDF_STM_F_PREDDEC_NO_PREDICTION:
       {
-        decode_row_none (in, cur, prev, state);
+        memcpy (cur, in, state->scanline_len);
         break;
       }
-    case PDF_STM_F_PREDDEC_PNG: {
-	switch (state->predictor) {
-	case PDF_STM_F_PREDDEC_PNG_NONE:
-	  {
-	    decode_row_none (in, cur, prev, state);
-	    break;
-	  }
-	case PDF_STM_F_PREDDEC_PNG_SUB:
-	  {
-	    decode_row_sub (in, cur, prev, state);
-	    break;
-	  }
-	case PDF_STM_F_PREDDEC_PNG_UP:
-	  {
-	    decode_row_up (in, cur, prev, state);
-	    break;
-	  }
-	case PDF_STM_F_PREDDEC_PNG_AVERAGE:
-	  {
-	    decode_row_average (in, cur, prev, state);
-	    break;
-	  }
-	case PDF_STM_F_PREDDEC_PNG_PAETH:
-	  {
-	    decode_row_paeth (in, cur, prev, state);
-	    break;
-	  }
-	default:
-	  {
-	    pdf_set_error (error,
-			   PDF_EDOMAIN_BASE_STM,
-			   PDF_EBADDATA,
-			   "bad png predictor value for decode: "
-               "expected 0, 1, 2, 3, 4 got %d",
-               (state->predictor));
-	    return PDF_ERROR;
-	    break;
-	  }
-	}
+    case PDF_STM_F_PREDDEC_PNG:
+      {
+        /* The first byte of each row selects its filter */
+        if (in[0] > PDF_STM_F_PREDDEC_PNG_PAETH)
+          {
+            pdf_set_error (error,
+                           PDF_EDOMAIN_BASE_STM,
+                           PDF_EBADDATA,
+                           "bad png predictor value for decode: "
+                           "expected 0, 1, 2, 3, 4 got %d",
+                           in[0]);
+            return PDF_ERROR;
+          }
+        state->png_decode_row[in[0]] (in + 1, cur, prev,
+                                      state->scanline_len, state->bpp);
+        break;
       }
     }
 
@@ -998,115 +1468,95 @@ stm_f_predenc_apply (void          *state,
                      pdf_error_t  **error)
 {
   pdf_stm_f_pred_t *fs = state; /* filter state */
+  pdf_buffer_t *tmp;
+  pdf_uchar_t *row;
+  pdf_size_t tocpy;
 
-  pdf_bool_t is_png_predictor;
-  is_png_predictor = fs->type == PDF_STM_F_PREDDEC_PNG;
-
-  pdf_uchar_t *curr_row;
-  pdf_uchar_t *prev_row = NULL;
-  pdf_uchar_t *out_buf;
-
-  pdf_size_t in_size;
   PDF_ASSERT (in->wp >= in->rp);
 
-  size_t tocpy;
-
-  /* copy all at once instead of copying each scanline for predictor 1; 
-     this is needed because we may not know real scanline_len and therefor use 
-     scanline_len = 1 which would be very slow */
+  /* Without prediction there are no rows: copy as much as possible at
+     once */
   if (fs->type == PDF_STM_F_PREDDEC_NO_PREDICTION)
     {
       tocpy = PDF_MIN (out->size - out->wp, in->wp - in->rp);
-      memcpy(out->data + out->wp, in->data + in->rp, tocpy);
+      memcpy (out->data + out->wp, in->data + in->rp, tocpy);
       out->wp += tocpy;
       in->rp += tocpy;
+
+      if (!pdf_buffer_eob_p (in))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+      return (finish ?
+              PDF_STM_FILTER_APPLY_STATUS_EOF :
+              PDF_STM_FILTER_APPLY_STATUS_NO_INPUT);
     }
 
-  /* copy in->data to buffer and filter it */
-  do
+  while (1)
     {
-      in_size = in->wp - in->rp;
-      tocpy = PDF_MIN (fs->curr_row_buf->size - fs->curr_row_buf->wp - 1,
-                       in_size);
-
-      memcpy (fs->curr_row_buf->data + fs->curr_row_buf->wp, in->data + in->rp, 
-              tocpy);
-
-      fs->curr_row_buf->wp += tocpy;
-      in->rp += tocpy;
-
-      /* one scanline is in curr_row_buf ready for filtering */
-      if (fs->curr_row_buf->wp - fs->curr_row_buf->rp == fs->scanline_len)
+      /* Write out what is left of the last encoded row */
+      if (!pdf_buffer_eob_p (fs->out_row_buf))
         {
-          /* check if out buffer has enough space left */
-          pdf_size_t left;
-          left = fs->out_row_buf->size - fs->out_row_buf->wp;
-          /* PNG predictor needs extra byte per row */
-          if (left >= fs->scanline_len + (is_png_predictor? 1 : 0))
-            {
-              /* write/read PNG predictor at first byte of a row */
-              if (is_png_predictor)
-                fs->out_row_buf->data[fs->out_row_buf->wp++] = fs->predictor;
+          tocpy = PDF_MIN (fs->out_row_buf->wp - fs->out_row_buf->rp,
+                           out->size - out->wp);
+          memcpy (out->data + out->wp,
+                  fs->out_row_buf->data + fs->out_row_buf->rp,
+                  tocpy);
+          out->wp += tocpy;
+          fs->out_row_buf->rp += tocpy;
 
-              curr_row = (pdf_uchar_t*) fs->curr_row_buf->data;
-              out_buf  = (pdf_uchar_t*) fs->out_row_buf->data 
-                                       + fs->out_row_buf->wp;
+          if (!pdf_buffer_eob_p (fs->out_row_buf))
+            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+        }
 
-              /* at first row encode_row expects prev_row to be NULL */
-              if (fs->prev_row_buf->wp == 0)
-                prev_row = NULL;
-              else
-                prev_row = (pdf_uchar_t*) fs->prev_row_buf->data;
+      /* Encode whole rows straight from the input buffer, and gather
+         them in curr_row_buf only when they are split across calls */
+      if (fs->curr_row_buf->wp == 0
+          && in->wp - in->rp >= fs->scanline_len)
+        {
+          row = in->data + in->rp;
+          in->rp += fs->scanline_len;
+        }
+      else
+        {
+          tocpy = PDF_MIN (fs->scanline_len - fs->curr_row_buf->wp,
+                           in->wp - in->rp);
+          memcpy (fs->curr_row_buf->data + fs->curr_row_buf->wp,
+                  in->data + in->rp,
+                  tocpy);
+          fs->curr_row_buf->wp += tocpy;
+          in->rp += tocpy;
 
-              if (encode_row (curr_row, prev_row, out_buf, fs, error) 
-                  == PDF_ERROR)
-                return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+          if (fs->curr_row_buf->wp < fs->scanline_len)
+            break;
 
-              fs->out_row_buf->wp += fs->scanline_len;
+          row = fs->curr_row_buf->data;
+          pdf_buffer_rewind (fs->curr_row_buf);
+        }
 
-              /* instead of copying curr to prev, swap addresses */
-              pdf_buffer_t *swap_tmp_buf = fs->prev_row_buf;
-              fs->prev_row_buf = fs->curr_row_buf;
-              fs->curr_row_buf = swap_tmp_buf;
+      if (encode_row (row, fs->prev_row_buf->data, fs, error) == PDF_ERROR)
+        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
 
-              pdf_buffer_rewind (fs->curr_row_buf);
-            }
-       }
+      fs->out_row_buf->rp = 0;
+      fs->out_row_buf->wp = (fs->scanline_len
+                             + (fs->type == PDF_STM_F_PREDDEC_PNG ? 1 : 0));
 
-      /* out_row_buf has data that can be written to out buffer */
-      if (out->size - out->wp > 0 && !pdf_buffer_eob_p (fs->out_row_buf))
+      /* Keep the row to predict the next one from it */
+      if (row == fs->curr_row_buf->data)
         {
-          tocpy = PDF_MIN (fs->out_row_buf->wp - fs->out_row_buf->rp, 
-                           out->size - out->wp);
-
-          memcpy (out->data + out->wp, 
-                  fs->out_row_buf->data + fs->out_row_buf->rp, 
-                  tocpy);
-
-          out->wp += tocpy;
-          fs->out_row_buf->rp += tocpy;
+          tmp = fs->prev_row_buf;
+          fs->prev_row_buf = fs->curr_row_buf;
+          fs->curr_row_buf = tmp;
         }
-      if (pdf_buffer_eob_p (fs->out_row_buf))
+      else
         {
-          pdf_buffer_rewind (fs->out_row_buf);
+          memcpy (fs->prev_row_buf->data, row, fs->scanline_len);
         }
-
     }
-  while (!pdf_buffer_eob_p (in) && !pdf_buffer_full_p (out));
 
-  /* if we do PNG prediction (is_png_predictor) and in->size == out->size
-   * it happens that out->data is full and we have not read all of in->data */
-  if (pdf_buffer_full_p (out) && !pdf_buffer_eob_p (in))
-    return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-
-  /* final call of this filter; empty out_row_buf */
-  if (finish && in->wp - in->rp < 1)
+  /* final call of this filter */
+  if (finish)
     {
-      /* out_row_buf has data because out is full */
-      if (!pdf_buffer_eob_p (fs->out_row_buf))
-        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
       /* input % scanline_len != 0 */
-      if (!pdf_buffer_eob_p (fs->curr_row_buf))
+      if (fs->curr_row_buf->wp != 0)
         {
           pdf_set_error (error,
                          PDF_EDOMAIN_BASE_STM,
@@ -1130,113 +1580,95 @@ stm_f_preddec_apply (void          *state,
                      pdf_error_t  **error)
 {
   pdf_stm_f_pred_t *fs = state; /* filter state */
+  pdf_buffer_t *tmp;
+  pdf_uchar_t *row;
+  pdf_size_t row_len;
+  pdf_size_t tocpy;
 
-  pdf_bool_t is_png_predictor;
-  is_png_predictor = fs->type == PDF_STM_F_PREDDEC_PNG;
-
-  pdf_uchar_t *curr_row;
-  pdf_uchar_t *prev_row = NULL;
-  pdf_uchar_t *out_buf;
-
-  pdf_size_t in_size;
   PDF_ASSERT (in->wp >= in->rp);
 
-  size_t tocpy;
-
-  /* copy all at once instead of copying each scanline for predictor 1; 
-     this is needed because we may not know real scanline_len and therefor use 
-     scanline_len = 1 which would be very slow */
-  if (fs->predictor == PDF_STM_F_PREDDEC_NO_PREDICTION)
+  /* Without prediction there are no rows: copy as much as possible at
+     once */
+  if (fs->type == PDF_STM_F_PREDDEC_NO_PREDICTION)
     {
       tocpy = PDF_MIN (out->size - out->wp, in->wp - in->rp);
-      memcpy(out->data + out->wp, in->data + in->rp, tocpy);
+      memcpy (out->data + out->wp, in->data + in->rp, tocpy);
       out->wp += tocpy;
       in->rp += tocpy;
-    }
 
-  /* copy in->data to buffer and filter it */
-  do
-    {
-      in_size = in->wp - in->rp;
-      tocpy = fs->curr_row_buf->size - fs->curr_row_buf->wp;
-      /* PNG predictor needs 1 byte more in a scanline */
-      tocpy -= (is_png_predictor? 0 : 1);
-      tocpy = PDF_MIN (in_size, tocpy);
-
-      memcpy (fs->curr_row_buf->data + fs->curr_row_buf->wp, in->data + in->rp,
-              tocpy);
-
-      fs->curr_row_buf->wp += tocpy;
-      in->rp += tocpy;
+      if (!pdf_buffer_eob_p (in))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+      return (finish ?
+              PDF_STM_FILTER_APPLY_STATUS_EOF :
+              PDF_STM_FILTER_APPLY_STATUS_NO_INPUT);
+    }
 
-      /* curr_row_buf has a scanline (+PNG predictor) and is ready to filter */
-      if (fs->scanline_len == fs->curr_row_buf->wp - fs->curr_row_buf->rp
-                              - (is_png_predictor ? 1 : 0))
-        {
-          /* check if out buffer has enough space left */
-          pdf_size_t left;
-          left = fs->out_row_buf->size - fs->out_row_buf->wp;
-          /* PNG predictor needs extra byte per row */
-          if (left >= fs->scanline_len + (is_png_predictor? 1 : 0))
-            {
-              /* write/read PNG predictor at first byte of a row */
-              if (is_png_predictor)
-                fs->predictor = fs->curr_row_buf->data[fs->curr_row_buf->rp++];
-
-              curr_row = (pdf_uchar_t*) fs->curr_row_buf->data 
-                                       + fs->curr_row_buf->rp;
-              out_buf  = (pdf_uchar_t*) fs->out_row_buf->data 
-                                       + fs->out_row_buf->wp;
-
-              /* at first row decode_row expects prev_row to be NULL */
-              if (fs->prev_row_buf->wp == 0)
-                prev_row = NULL;
-              else
-                prev_row = (pdf_uchar_t*) fs->prev_row_buf->data;
-
-              if (decode_row (curr_row, out_buf, prev_row, fs, error)
-                  == PDF_ERROR)
-                return PDF_STM_FILTER_APPLY_STATUS_ERROR;
-
-              fs->out_row_buf->wp += fs->scanline_len;
-
-              /* copying out_row to prev_row */
-              memcpy (fs->prev_row_buf->data, fs->out_row_buf->data,
-                  fs->out_row_buf->size);
-              fs->prev_row_buf->rp = fs->out_row_buf->rp;
-              fs->prev_row_buf->wp = fs->out_row_buf->wp;
-
-              pdf_buffer_rewind (fs->curr_row_buf);
-            }
-       }
+  /* PNG rows start with the filter type byte */
+  row_len = fs->scanline_len + (fs->type == PDF_STM_F_PREDDEC_PNG ? 1 : 0);
 
-      /* out_row_buf has data that can be written to out buffer */
-      if (out->size - out->wp > 0 && !pdf_buffer_eob_p (fs->out_row_buf))
+  while (1)
+    {
+      /* Write out what is left of the last decoded row */
+      if (!pdf_buffer_eob_p (fs->out_row_buf))
         {
           tocpy = PDF_MIN (fs->out_row_buf->wp - fs->out_row_buf->rp,
-              out->size - out->wp);
-
+                           out->size - out->wp);
           memcpy (out->data + out->wp,
-              fs->out_row_buf->data + fs->out_row_buf->rp, tocpy);
-
+                  fs->out_row_buf->data + fs->out_row_buf->rp,
+                  tocpy);
           out->wp += tocpy;
           fs->out_row_buf->rp += tocpy;
+
+          if (!pdf_buffer_eob_p (fs->out_row_buf))
+            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
         }
-      if (pdf_buffer_eob_p (fs->out_row_buf))
+
+      /* Decode whole rows straight from the input buffer, and gather
+         them in curr_row_buf only when they are split across calls */
+      if (fs->curr_row_buf->wp == 0
+          && in->wp - in->rp >= row_len)
+        {
+          row = in->data + in->rp;
+          in->rp += row_len;
+        }
+      else
         {
-          pdf_buffer_rewind (fs->out_row_buf);
+          tocpy = PDF_MIN (row_len - fs->curr_row_buf->wp,
+                           in->wp - in->rp);
+          memcpy (fs->curr_row_buf->data + fs->curr_row_buf->wp,
+                  in->data + in->rp,
+                  tocpy);
+          fs->curr_row_buf->wp += tocpy;
+          in->rp += tocpy;
+
+          if (fs->curr_row_buf->wp < row_len)
+            break;
+
+          row = fs->curr_row_buf->data;
+          pdf_buffer_rewind (fs->curr_row_buf);
         }
+
+      /* The row decoded last becomes the previous one */
+      tmp = fs->prev_row_buf;
+      fs->prev_row_buf = fs->out_row_buf;
+      fs->out_row_buf = tmp;
+
+      if (decode_row (row,
+                      fs->out_row_buf->data,
+                      fs->prev_row_buf->data,
+                      fs,
+                      error) == PDF_ERROR)
+        return PDF_STM_FILTER_APPLY_STATUS_ERROR;
+
+      fs->out_row_buf->rp = 0;
+      fs->out_row_buf->wp = fs->scanline_len;
     }
-  while (!pdf_buffer_eob_p (in));
 
-  /* final call of this filter; empty out_row_buf */
-  if (finish && in->wp - in->rp < 1)
+  /* final call of this filter */
+  if (finish)
     {
-      /* out_row_buf has data because out is full */
-      if (!pdf_buffer_eob_p (fs->out_row_buf))
-          return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
       /* input % scanline_len != 0 */
-      if (!pdf_buffer_eob_p (fs->curr_row_buf))
+      if (fs->curr_row_buf->wp != 0)
         {
           pdf_set_error (error,
                          PDF_EDOMAIN_BASE_STM,
@@ -1261,6 +1693,8 @@ stm_f_pred_deinit (void *state)
   pdf_buffer_destroy (filter_state->prev_row_buf);
   pdf_buffer_destroy (filter_state->curr_row_buf);
   pdf_buffer_destroy (filter_state->out_row_buf);
+  if (filter_state->try_row_buf)
+    pdf_buffer_destroy (filter_state->try_row_buf);
   pdf_dealloc (state);
 }
 
@@ -35,45 +35,44 @@
 #include <pdf-hash.h>
 
 /* Define RL encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_rlenc_get,
-                       stm_f_rl_init,
-                       stm_f_rlenc_apply,
-                       stm_f_rl_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_rlenc_get,
+                             stm_f_rl_init,
+                             stm_f_rlenc_apply,
+                             stm_f_rl_deinit,
+                             stm_f_rl_reset);
 
 /* Define RL decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_rldec_get,
-                       stm_f_rl_init,
-                       stm_f_rldec_apply,
-                       stm_f_rl_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_rldec_get,
+                             stm_f_rl_init,
+                             stm_f_rldec_apply,
+                             stm_f_rl_deinit,
+                             stm_f_rl_reset);
 
-typedef enum
-{
-  PDF_STM_F_RL_WRL,
-  PDF_STM_F_RL_NONE
-} pdf_stm_f_rl_enc_e;
+/* Longest literal or repeat run of a RunLength block */
+#define RL_MAX_BLOCK 128
+/* End of data marker */
+#define RL_EOD 128
 
 /* Internal state */
 struct pdf_stm_f_rl_s
 {
-  pdf_uchar_t curchar;
+  /* Encoder: literal bytes gathered so far, a repeat run being counted
+   * and an encoded block which didn't fit in the output buffer */
+  pdf_uchar_t lit[RL_MAX_BLOCK];
+  pdf_size_t lit_len;
   pdf_uchar_t rlchar;
-  pdf_uchar_t dec_count;
-  pdf_i32_t rl;
-  pdf_bool_t run_p;
-  pdf_bool_t dec_p;
-  pdf_stm_f_rl_enc_e enc_p;
+  pdf_size_t rl;
+  pdf_uchar_t pend[RL_MAX_BLOCK + 1];
+  pdf_size_t pend_pos;
+  pdf_size_t pend_len;
+
+  /* Decoder: bytes left of the current block, whether it is a literal
+   * one, and whether the byte of a repeat run is still to be read */
+  pdf_size_t dec_count;
+  pdf_bool_t literal_p;
+  pdf_bool_t need_char_p;
 };
 
-static pdf_bool_t encode_rl_char (struct pdf_stm_f_rl_s *st,
-                                  pdf_buffer_t          *out);
-
-static pdf_bool_t decode_rl_char (struct pdf_stm_f_rl_s *st,
-                                  pdf_buffer_t          *out);
-
-static int copy_next_bytes (struct pdf_stm_f_rl_s *st,
-                            pdf_buffer_t          *in,
-                            pdf_buffer_t          *out);
-
 /* Common implementation */
 
 static pdf_bool_t
@@ -96,13 +95,7 @@ stm_f_rl_init (const pdf_hash_t  *params,
     }
 
   /* Initialize fields */
-  filter_state->curchar = 0;
-  filter_state->rlchar = 0;
-  filter_state->run_p = PDF_FALSE;
-  filter_state->rl = -1;
-  filter_state->dec_p = PDF_FALSE;;
-  filter_state->dec_count = 0;
-  filter_state->enc_p = PDF_STM_F_RL_NONE;
+  stm_f_rl_reset (filter_state, NULL);
 
   *state = (void *) filter_state;
 
@@ -115,8 +108,180 @@ stm_f_rl_deinit (void *state)
   pdf_dealloc (state);
 }
 
+static pdf_bool_t
+stm_f_rl_reset (void         *state,
+                pdf_error_t **error)
+{
+  struct pdf_stm_f_rl_s *filter_state = state;
+
+  filter_state->lit_len = 0;
+  filter_state->rlchar = 0;
+  filter_state->rl = 0;
+  filter_state->pend_pos = 0;
+  filter_state->pend_len = 0;
+  filter_state->dec_count = 0;
+  filter_state->literal_p = PDF_FALSE;
+  filter_state->need_char_p = PDF_FALSE;
+
+  return PDF_TRUE;
+}
+
+/* Word-at-a-time scanning */
+
+#define RL_ONES  ((pdf_u64_t) 0x0101010101010101ULL)
+#define RL_LOW7  ((pdf_u64_t) 0x7f7f7f7f7f7f7f7fULL)
+#define RL_HIGH  ((pdf_u64_t) 0x8080808080808080ULL)
+
+static inline pdf_u64_t
+rl_load (const pdf_uchar_t *p)
+{
+  pdf_u64_t w;
+
+  memcpy (&w, p, sizeof w);
+  return w;
+}
+
+/* Set the high bit of exactly the nonzero bytes of X */
+static inline pdf_u64_t
+rl_nonzero_bytes (pdf_u64_t x)
+{
+  return (((x & RL_LOW7) + RL_LOW7) | x) & RL_HIGH;
+}
+
+/* Index, in memory order, of the first byte flagged in MASK */
+static inline pdf_size_t
+rl_first_byte (pdf_u64_t mask)
+{
+#if defined __GNUC__
+# if defined WORDS_BIGENDIAN
+  return __builtin_clzll (mask) >> 3;
+# else
+  return __builtin_ctzll (mask) >> 3;
+# endif /* WORDS_BIGENDIAN */
+#else
+  pdf_size_t i;
+  pdf_uchar_t bytes[8];
+
+  memcpy (bytes, &mask, sizeof bytes);
+  for (i = 0; !bytes[i]; i++)
+    ;
+  return i;
+#endif /* __GNUC__ */
+}
+
+/* Number of leading bytes of P, up to MAX, equal to C */
+static pdf_size_t
+rl_run_length (const pdf_uchar_t *p,
+               pdf_size_t         max,
+               pdf_uchar_t        c)
+{
+  const pdf_u64_t pattern = RL_ONES * c;
+  pdf_u64_t mask;
+  pdf_size_t i = 0;
+
+  for (; i + 8 <= max; i += 8)
+    {
+      mask = rl_nonzero_bytes (rl_load (p + i) ^ pattern);
+      if (mask)
+        return i + rl_first_byte (mask);
+    }
+  while (i < max && p[i] == c)
+    i++;
+  return i;
+}
+
+/* Number of leading bytes of the LEN bytes at P, up to MAX, before the
+ * first pair of equal bytes; MAX or LEN if there is none */
+static pdf_size_t
+rl_literal_length (const pdf_uchar_t *p,
+                   pdf_size_t         len,
+                   pdf_size_t         max)
+{
+  pdf_u64_t mask;
+  pdf_size_t i = 0;
+
+  for (; i + 9 <= len && i < max; i += 8)
+    {
+      /* Bytes equal to their successor are zero in the difference */
+      mask = rl_load (p + i) ^ rl_load (p + i + 1);
+      mask = ~rl_nonzero_bytes (mask) & RL_HIGH;
+      if (mask)
+        {
+          i += rl_first_byte (mask);
+          return PDF_MIN (i, max);
+        }
+    }
+  for (; i + 1 < len && i < max; i++)
+    {
+      if (p[i] == p[i + 1])
+        return i;
+    }
+  return PDF_MIN (len, max);
+}
+
 /* Encoder implementation */
 
+/* Write out what is left of the pending block */
+static pdf_bool_t
+rl_flush (struct pdf_stm_f_rl_s *st,
+          pdf_buffer_t          *out)
+{
+  pdf_size_t n;
+
+  n = PDF_MIN (st->pend_len - st->pend_pos, out->size - out->wp);
+  memcpy (out->data + out->wp, st->pend + st->pend_pos, n);
+  out->wp += n;
+  st->pend_pos += n;
+  if (st->pend_pos < st->pend_len)
+    return PDF_FALSE;
+
+  st->pend_pos = 0;
+  st->pend_len = 0;
+  return PDF_TRUE;
+}
+
+/* Emit a block made of the HEADER byte and the LEN bytes at DATA,
+ * straight into the output buffer if it fits in */
+static void
+rl_put_block (struct pdf_stm_f_rl_s *st,
+              pdf_buffer_t          *out,
+              pdf_uchar_t            header,
+              const pdf_uchar_t     *data,
+              pdf_size_t             len)
+{
+  pdf_uchar_t *dst;
+
+  if (out->size - out->wp > len)
+    {
+      dst = out->data + out->wp;
+      out->wp += len + 1;
+    }
+  else
+    {
+      dst = st->pend;
+      st->pend_len = len + 1;
+    }
+  dst[0] = header;
+  memcpy (dst + 1, data, len);
+}
+
+static void
+rl_put_literal (struct pdf_stm_f_rl_s *st,
+                pdf_buffer_t          *out)
+{
+  if (st->lit_len > 0)
+    rl_put_block (st, out, st->lit_len - 1, st->lit, st->lit_len);
+  st->lit_len = 0;
+}
+
+static void
+rl_put_run (struct pdf_stm_f_rl_s *st,
+            pdf_buffer_t          *out)
+{
+  rl_put_block (st, out, 257 - st->rl, &st->rlchar, 1);
+  st->rl = 0;
+}
+
 static enum pdf_stm_filter_apply_status_e
 stm_f_rlenc_apply (void          *state,
                    pdf_buffer_t  *in,
@@ -124,68 +289,99 @@ stm_f_rlenc_apply (void          *state,
                    pdf_bool_t     finish,
                    pdf_error_t  **error)
 {
-  struct pdf_stm_f_rl_s *filter_state;
+  struct pdf_stm_f_rl_s *st = state;
+  const pdf_uchar_t *p;
+  pdf_size_t avail;
+  pdf_size_t n;
+
+  /* Runs of two or more equal bytes become repeat blocks, and anything
+   * between them literal blocks.  Only one block is emitted at a time,
+   * so that it can be kept aside when the output buffer fills up. */
+  for (;;)
+    {
+      if (!rl_flush (st, out))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+      if (pdf_buffer_eob_p (in))
+        break;
 
-  filter_state = (struct pdf_stm_f_rl_s *) state;
+      p = in->data + in->rp;
+      avail = in->wp - in->rp;
 
-  while (!pdf_buffer_eob_p (in))
-    {
-      filter_state->curchar = in->data[in->rp];
+      if (st->rl > 0)
+        {
+          /* Extend the current run */
+          n = rl_run_length (p, PDF_MIN (avail, RL_MAX_BLOCK - st->rl),
+                             st->rlchar);
+          st->rl += n;
+          in->rp += n;
+          if (st->rl == RL_MAX_BLOCK || !pdf_buffer_eob_p (in))
+            rl_put_run (st, out);
+          continue;
+        }
 
-      /* we're not encoding any character yet */
-      if (!filter_state->run_p)
+      if (st->lit_len > 0 && st->lit[st->lit_len - 1] == p[0])
         {
-          filter_state->rlchar = filter_state->curchar;
-          filter_state->run_p = PDF_TRUE;
-          filter_state->rl++;
+          /* The last literal byte starts a run */
+          st->lit_len--;
+          rl_put_literal (st, out);
+          st->rlchar = p[0];
+          st->rl = 2;
           in->rp++;
+          continue;
         }
-      /* we're encoding some character now */
-      else if (filter_state->curchar == filter_state->rlchar &&
-               filter_state->rl < 127)
+
+      n = rl_literal_length (p, avail, RL_MAX_BLOCK - st->lit_len);
+      in->rp += n;
+      if (st->lit_len == 0 && n < avail)
         {
-          filter_state->rl++;
-          in->rp++;
+          /* The whole literal is in the input buffer */
+          if (n > 0)
+            rl_put_block (st, out, n - 1, p, n);
         }
-      /*
-       * the rl code is too long or the rl char is different,
-       * so we write what we encoded so far.
-       */
       else
         {
-          if (!encode_rl_char (filter_state, out))
-            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
+          /* A literal ending with the input buffer is kept, even when
+           * full, as its last byte may start a run */
+          memcpy (st->lit + st->lit_len, p, n);
+          st->lit_len += n;
+          if (n < avail)
+            rl_put_literal (st, out);
+        }
 
-          filter_state->rl = -1;
-          filter_state->run_p = PDF_FALSE;
+      /* Start a run with the pair of equal bytes which ended the
+       * literal, unless it was ended by its size limit */
+      if (in->rp + 1 < in->wp
+          && in->data[in->rp] == in->data[in->rp + 1])
+        {
+          st->rlchar = in->data[in->rp];
+          st->rl = 2;
+          in->rp += 2;
         }
     }
 
-  /*
-   * we may have finished with some history, we save it if needed,
-   * then we add the EOD.
-   */
+  /* We may have finished with some history, we save it if needed,
+   * then we add the EOD. */
   if (finish)
     {
-      if (filter_state->run_p)
-        {
-          if (!encode_rl_char (filter_state, out))
-            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-
-          filter_state->rl = -1;
-          filter_state->run_p = PDF_FALSE;
-        }
+      if (st->lit_len > 0)
+        rl_put_literal (st, out);
+      else if (st->rl > 0)
+        rl_put_run (st, out);
+      if (!rl_flush (st, out))
+        return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
 
       /* Insert EOD marker */
       if (pdf_buffer_full_p (out))
         return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-      out->data[out->wp++] = 128;
+      out->data[out->wp++] = RL_EOD;
       return PDF_STM_FILTER_APPLY_STATUS_EOF;
     }
 
   return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
 }
 
+/* Decoder implementation */
+
 static enum pdf_stm_filter_apply_status_e
 stm_f_rldec_apply (void          *state,
                    pdf_buffer_t  *in,
@@ -193,132 +389,64 @@ stm_f_rldec_apply (void          *state,
                    pdf_bool_t     finish,
                    pdf_error_t  **error)
 {
-  struct pdf_stm_f_rl_s *filter_state;
-
-  filter_state = (struct pdf_stm_f_rl_s *) state;
+  struct pdf_stm_f_rl_s *st = state;
+  pdf_uchar_t code;
+  pdf_size_t n;
 
-  while (!pdf_buffer_eob_p (in))
+  for (;;)
     {
-      filter_state->curchar = in->data[in->rp];
-
-      /* we're not decoding any character yet */
-      if (!filter_state->run_p)
-        {
-          filter_state->rlchar = filter_state->curchar;
-          filter_state->run_p = PDF_TRUE;
-          in->rp++;
-        }
-      /* copy the following 1 to 128 bytes literally */
-      else if (filter_state->rlchar < 128)
+      if (st->need_char_p)
         {
-          int copied;
-
-          copied = copy_next_bytes (filter_state, in, out);
-          if (copied < 0)
-            return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-          if (copied > 0)
+          /* The byte to repeat */
+          if (pdf_buffer_eob_p (in))
             return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
-          filter_state->run_p = PDF_FALSE;
+          st->rlchar = in->data[in->rp++];
+          st->need_char_p = PDF_FALSE;
         }
-      /* copy the next char 257 - length (2 to 128) times */
-      else if (filter_state->rlchar > 128)
+
+      if (st->dec_count > 0)
         {
-          if (!decode_rl_char (filter_state, out))
+          if (pdf_buffer_full_p (out))
             return PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT;
-          filter_state->run_p = PDF_FALSE;
-          in->rp++;
-        }
-      /* EOD mark */
-      else
-        {
-          filter_state->run_p = PDF_FALSE;
-          return PDF_STM_FILTER_APPLY_STATUS_EOF;
-        }
-    }
-
-  return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
-}
-
-/* Helper functions */
-
-static pdf_bool_t
-encode_rl_char (struct pdf_stm_f_rl_s *st,
-                pdf_buffer_t          *out)
-{
-  if (pdf_buffer_full_p (out))
-    return PDF_FALSE;
 
-  switch (st->enc_p)
-    {
-    case PDF_STM_F_RL_NONE:
-      out->data[out->wp++] = (st->rl == 0) ? 0 : 256 - st->rl;
-      st->enc_p = PDF_STM_F_RL_WRL;
-      /* Continue to RL_WRL! */
-    case PDF_STM_F_RL_WRL:
-      out->data[out->wp++] = st->rlchar;
-      st->enc_p = PDF_STM_F_RL_NONE;
-      break;
-    }
-
-  return PDF_TRUE;
-}
-
-static pdf_bool_t
-decode_rl_char (struct pdf_stm_f_rl_s *st,
-                pdf_buffer_t          *out)
-{
-  if (!st->dec_p)
-    {
-      st->dec_count = 257 - st->rlchar;
-      st->dec_p = PDF_TRUE;
-    }
-
-  while (st->dec_count > 0)
-    {
-      if (pdf_buffer_full_p (out))
-        return PDF_FALSE;
-
-      out->data[out->wp++] = st->curchar;
-      st->dec_count--;
-    }
-
-  st->dec_p = PDF_FALSE;
-  return PDF_TRUE;
-}
-
-static int
-copy_next_bytes (struct pdf_stm_f_rl_s *st,
-                 pdf_buffer_t          *in,
-                 pdf_buffer_t          *out)
-{
-  if (!st->dec_p)
-    {
-      if (pdf_buffer_full_p (out))
-        return -1;
-
-      st->dec_count = st->rlchar + 1;
-      st->dec_p = PDF_TRUE;
-      out->data[out->wp++] = st->curchar;
-      in->rp++;
-      st->dec_count--;
-    }
+          n = PDF_MIN (st->dec_count, out->size - out->wp);
+          if (st->literal_p)
+            {
+              /* Copy as much of the literal as the buffers allow */
+              if (pdf_buffer_eob_p (in))
+                return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
+              n = PDF_MIN (n, in->wp - in->rp);
+              memcpy (out->data + out->wp, in->data + in->rp, n);
+              in->rp += n;
+            }
+          else
+            memset (out->data + out->wp, st->rlchar, n);
+          out->wp += n;
+          st->dec_count -= n;
+          continue;
+        }
 
-  while (st->dec_count > 0)
-    {
       if (pdf_buffer_eob_p (in))
-        return 1;
-
-      if (pdf_buffer_full_p (out))
-        return -1;
+        return PDF_STM_FILTER_APPLY_STATUS_NO_INPUT;
 
-      out->data[out->wp] = in->data[in->rp];
-      out->wp++;
+      code = in->data[in->rp];
+      if (code < RL_EOD)
+        {
+          /* Copy the following 1 to 128 bytes literally */
+          st->dec_count = code + 1;
+          st->literal_p = PDF_TRUE;
+        }
+      else if (code > RL_EOD)
+        {
+          /* Copy the next byte 257 - length (2 to 128) times */
+          st->dec_count = 257 - code;
+          st->literal_p = PDF_FALSE;
+          st->need_char_p = PDF_TRUE;
+        }
+      else
+        return PDF_STM_FILTER_APPLY_STATUS_EOF;
       in->rp++;
-      st->dec_count--;
     }
-
-  st->dec_p = PDF_FALSE;
-  return 0;
 }
 
 /* End of pdf_stm_f_rl.c */
@@ -34,16 +34,18 @@
 #include <pdf-hash-helper.h>
 
 /* Define V2 encoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_v2enc_get,
-                       stm_f_v2_init,
-                       stm_f_v2enc_apply,
-                       stm_f_v2_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_v2enc_get,
+                             stm_f_v2_init,
+                             stm_f_v2enc_apply,
+                             stm_f_v2_deinit,
+                             stm_f_v2_reset);
 
 /* Define V2 decoder */
-PDF_STM_FILTER_DEFINE (pdf_stm_f_v2dec_get,
-                       stm_f_v2_init,
-                       stm_f_v2dec_apply,
-                       stm_f_v2_deinit);
+PDF_STM_FILTER_DEFINE_RESET (pdf_stm_f_v2dec_get,
+                             stm_f_v2_init,
+                             stm_f_v2dec_apply,
+                             stm_f_v2_deinit,
+                             stm_f_v2_reset);
 
 #define V2_PARAM_KEY      "Key"
 #define V2_PARAM_KEY_SIZE "KeySize"
@@ -58,9 +60,6 @@ typedef enum {
 struct pdf_stm_f_v2_s
 {
   pdf_crypt_cipher_t *cipher;
-
-  pdf_char_t *key;
-  pdf_size_t keysize;
 };
 
 /* Common implementation */
@@ -103,28 +102,10 @@ stm_f_v2_init (const pdf_hash_t  *params,
       return PDF_FALSE;
     }
 
-  filter_state->cipher = NULL;
-
   /* Note that Key may NOT be NUL-terminated */
   key = pdf_hash_get_value (params, V2_PARAM_KEY);
   keysize = pdf_hash_get_size (params, V2_PARAM_KEY_SIZE);
 
-  /* Keep a copy of the key in the filter */
-  filter_state->key = (pdf_char_t *)pdf_alloc (keysize);
-  if (!filter_state->key)
-    {
-      pdf_set_error (error,
-                     PDF_EDOMAIN_BASE_STM,
-                     PDF_ENOMEM,
-                     "cannot copy V2 key: "
-                     "couldn't allocate %lu bytes",
-                     (unsigned long)keysize);
-      stm_f_v2_deinit (filter_state);
-      return PDF_FALSE;
-    }
-  filter_state->keysize = keysize;
-  memcpy (filter_state->key, key, keysize);
-
   filter_state->cipher = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_V2, error);
   if (!filter_state->cipher)
     {
@@ -133,8 +114,8 @@ stm_f_v2_init (const pdf_hash_t  *params,
     }
 
   if (!pdf_crypt_cipher_set_key (filter_state->cipher,
-                                 filter_state->key,
-                                 filter_state->keysize,
+                                 key,
+                                 keysize,
                                  error))
     {
       stm_f_v2_deinit (filter_state);
@@ -152,11 +133,20 @@ stm_f_v2_deinit (void *state)
 
   if (filter_state->cipher)
     pdf_crypt_cipher_destroy (filter_state->cipher);
-  if (filter_state->key)
-    pdf_dealloc (filter_state->key);
   pdf_dealloc (state);
 }
 
+static pdf_bool_t
+stm_f_v2_reset (void         *state,
+                pdf_error_t **error)
+{
+  struct pdf_stm_f_v2_s *filter_state = state;
+
+  /* The cipher keeps the key schedule to restart the keystream */
+  pdf_crypt_cipher_reset (filter_state->cipher);
+  return PDF_TRUE;
+}
+
 static enum pdf_stm_filter_apply_status_e
 stm_f_v2_apply (pdf_stm_f_v2_mode_e   mode,
                 void                 *state,
@@ -169,7 +159,6 @@ stm_f_v2_apply (pdf_stm_f_v2_mode_e   mode,
   pdf_size_t in_size;
   pdf_size_t out_size;
   pdf_size_t bytes_to_copy;
-  pdf_size_t written;
 
   PDF_ASSERT (in->wp >= in->rp);
   PDF_ASSERT (out->size >= out->wp);
@@ -179,6 +168,8 @@ stm_f_v2_apply (pdf_stm_f_v2_mode_e   mode,
 
   bytes_to_copy = PDF_MIN (out_size, in_size);
 
+  /* Process the data straight from the input buffer to the output
+   * buffer */
   if (bytes_to_copy != 0)
     {
       switch (mode)
@@ -186,11 +177,12 @@ stm_f_v2_apply (pdf_stm_f_v2_mode_e   mode,
         case PDF_STM_F_V2_MODE_ENCODE:
           {
             if (!pdf_crypt_cipher_encrypt (filter_state->cipher,
-                                           (pdf_char_t *)out->data,
-                                           out_size,
-                                           (const pdf_char_t *)in->data,
-                                           in_size,
-                                           &written,
+                                           (pdf_char_t *)out->data + out->wp,
+                                           bytes_to_copy,
+                                           ((const pdf_char_t *)in->data +
+                                            in->rp),
+                                           bytes_to_copy,
+                                           NULL,
                                            error))
               return PDF_STM_FILTER_APPLY_STATUS_ERROR;
             break;
@@ -198,11 +190,12 @@ stm_f_v2_apply (pdf_stm_f_v2_mode_e   mode,
         case PDF_STM_F_V2_MODE_DECODE:
           {
             if (!pdf_crypt_cipher_decrypt (filter_state->cipher,
-                                           (pdf_char_t *)out->data,
-                                           out_size,
-                                           (const pdf_char_t *)in->data,
-                                           in_size,
-                                           &written,
+                                           (pdf_char_t *)out->data + out->wp,
+                                           bytes_to_copy,
+                                           ((const pdf_char_t *)in->data +
+                                            in->rp),
+                                           bytes_to_copy,
+                                           NULL,
                                            error))
               return PDF_STM_FILTER_APPLY_STATUS_ERROR;
             break;
@@ -210,7 +203,7 @@ stm_f_v2_apply (pdf_stm_f_v2_mode_e   mode,
         }
 
       in->rp  += bytes_to_copy;
-      out->wp += written;
+      out->wp += bytes_to_copy;
     }
 
   return (in_size > out_size ?
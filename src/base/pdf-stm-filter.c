@@ -25,6 +25,8 @@
 
 #include <config.h>
 
+#include <string.h>
+
 #include <pdf-stm-filter.h>
 #include <pdf-stm-f-null.h>
 #include <pdf-stm-f-ahex.h>
@@ -32,9 +34,11 @@
 #include <pdf-stm-f-v2.h>
 #include <pdf-stm-f-aesv2.h>
 #include <pdf-stm-f-md5.h>
+#include <pdf-stm-f-digest.h>
 #include <pdf-stm-f-lzw.h>
 #include <pdf-stm-f-a85.h>
 #include <pdf-stm-f-pred.h>
+#include <pdf-stm-f-fax.h>
 
 /* Build-dependent filters */
 
@@ -62,6 +66,8 @@ static pdf_bool_t pdf_stm_filter_get_input (pdf_stm_filter_t  *filter,
                                             pdf_bool_t        *eof,
                                             pdf_error_t      **error);
 
+static pdf_bool_t pdf_stm_filter_hand_over (pdf_stm_filter_t *filter);
+
 /* Filter definition */
 struct stm_filter_s {
   /* Filter name */
@@ -85,7 +91,7 @@ static const struct stm_filter_s filters[PDF_STM_FILTER_LAST] = {
   { "RunLength encoder", pdf_stm_f_rlenc_get    },
   { "RunLength decoder", pdf_stm_f_rldec_get    },
   { "CCITT Fax encoder", NULL                   },
-  { "CCITT Fax decoder", NULL                   },
+  { "CCITT Fax decoder", pdf_stm_f_faxdec_get   },
   { "JBIG2 encoder",     NULL                   },
   { "JBIG2 decoder",     pdf_stm_f_jbig2dec_get },
   { "DCT encoder",       NULL                   },
@@ -99,9 +105,13 @@ static const struct stm_filter_s filters[PDF_STM_FILTER_LAST] = {
   { "AESv2 encoder",     pdf_stm_f_aesv2enc_get },
   { "AESv2 decoder",     pdf_stm_f_aesv2dec_get },
   { "V2 encoder",        pdf_stm_f_v2enc_get    },
-  { "V2 decoder",        pdf_stm_f_v2enc_get    },
+  { "V2 decoder",        pdf_stm_f_v2dec_get    },
   /* Hash filters */
   { "MD5 encoder",       pdf_stm_f_md5enc_get   },
+  { "Digest",            pdf_stm_f_digest_get   },
+  /* Newer filters */
+  { "AESv3 encoder",     pdf_stm_f_aesv3enc_get },
+  { "AESv3 decoder",     pdf_stm_f_aesv3dec_get },
 };
 
 /* Filter data type */
@@ -128,6 +138,14 @@ struct pdf_stm_filter_s
 
   /* Operation mode */
   enum pdf_stm_filter_mode_e mode;
+
+  /* Copy counters, only for pass-through filters */
+  pdf_size_t copied_bytes;
+  pdf_size_t forwarded_bytes;
+
+  /* Performance counters, only collected if enabled */
+  pdf_bool_t stats_enabled;
+  struct pdf_stm_filter_stats_s stats;
 };
 
 /*
@@ -140,6 +158,68 @@ pdf_stm_filter_p (enum pdf_stm_filter_type_e type)
   return (filters[type].get_impl != NULL ? PDF_TRUE : PDF_FALSE);
 }
 
+pdf_bool_t
+pdf_stm_filter_check (enum pdf_stm_filter_type_e   type,
+                      const pdf_hash_t            *params,
+                      pdf_error_t                **error)
+{
+  const pdf_stm_filter_impl_t *impl;
+  void *state = NULL;
+
+  PDF_ASSERT_RETURN_VAL (type >= PDF_STM_FILTER_NULL, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (type < PDF_STM_FILTER_LAST, PDF_FALSE);
+
+  if (!filters[type].get_impl)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EBADDATA,
+                     "filter type `%s' not supported",
+                     filters[type].name);
+      return PDF_FALSE;
+    }
+
+  /* The parameters are only validated by the implementation when
+   * initializing it */
+  impl = filters[type].get_impl ();
+  if (impl->init_fn)
+    {
+      if (!impl->init_fn (params, &state, error))
+        {
+          pdf_prefix_error (error,
+                            "invalid parameters for filter `%s': ",
+                            filters[type].name);
+          return PDF_FALSE;
+        }
+      if (impl->deinit_fn)
+        impl->deinit_fn (state);
+    }
+
+  return PDF_TRUE;
+}
+
+pdf_size_t
+pdf_stm_filter_get_buffer_size (enum pdf_stm_filter_type_e type,
+                                pdf_size_t                 size)
+{
+  const pdf_stm_filter_impl_t *impl;
+  pdf_size_t block_size;
+
+  PDF_ASSERT_RETURN_VAL (type >= PDF_STM_FILTER_NULL, size);
+  PDF_ASSERT_RETURN_VAL (type < PDF_STM_FILTER_LAST, size);
+
+  if (!filters[type].get_impl)
+    return size;
+
+  impl = filters[type].get_impl ();
+  block_size = impl->block_size;
+  if (block_size == 0)
+    return size;
+
+  /* Round up to a multiple of the block size */
+  return ((size + block_size - 1) / block_size) * block_size;
+}
+
 pdf_stm_filter_t *
 pdf_stm_filter_new (enum pdf_stm_filter_type_e   type,
                     const pdf_hash_t            *params,
@@ -206,6 +286,9 @@ pdf_stm_filter_new (enum pdf_stm_filter_type_e   type,
   filter->error = NULL;
   filter->eof = PDF_FALSE;
   filter->really_finish = PDF_FALSE;
+  filter->copied_bytes = 0;
+  filter->forwarded_bytes = 0;
+  pdf_stm_filter_enable_stats (filter, PDF_FALSE);
 
   /* Error initializing the filter implementation? */
   if (filter->impl->init_fn &&
@@ -268,6 +351,18 @@ pdf_stm_filter_get_in (pdf_stm_filter_t *filter)
   return filter->in;
 }
 
+enum pdf_stm_filter_type_e
+pdf_stm_filter_get_type (pdf_stm_filter_t *filter)
+{
+  return filter->type;
+}
+
+const pdf_char_t *
+pdf_stm_filter_get_name (pdf_stm_filter_t *filter)
+{
+  return filters[filter->type].name;
+}
+
 pdf_stm_filter_t *
 pdf_stm_filter_get_next (pdf_stm_filter_t *filter)
 {
@@ -307,13 +402,67 @@ pdf_stm_filter_apply (pdf_stm_filter_t  *filter,
       pdf_error_t *inner_error = NULL;
       enum pdf_stm_filter_apply_status_e filter_status;
       pdf_bool_t input_eof;
+      pdf_size_t out_wp;
+      pdf_size_t in_rp;
+      pdf_u64_t start = 0;
+
+      /* Pass-through filters give their filled input buffer to the output
+       * instead of copying it. The output is then returned as it is, so
+       * that the next input buffer can also be handed over. */
+      if (filter->impl->passthrough &&
+          pdf_stm_filter_hand_over (filter))
+        {
+          if (filter->impl->peek_fn)
+            {
+              pdf_bool_t peek_ok;
+
+              if (filter->stats_enabled)
+                start = pdf_stm_be_clock ();
+              peek_ok = filter->impl->peek_fn (filter->state,
+                                               (filter->out->data +
+                                                filter->out->rp),
+                                               (filter->out->wp -
+                                                filter->out->rp),
+                                               &(filter->error));
+              if (filter->stats_enabled)
+                filter->stats.apply_usecs += pdf_stm_be_clock () - start;
+
+              if (!peek_ok)
+                {
+                  /* The error is copied, the original is left untouched */
+                  pdf_propagate_error_dup (error, filter->error);
+                  return PDF_FALSE;
+                }
+            }
+          break;
+        }
 
       /* Generate output */
+      out_wp = filter->out->wp;
+      in_rp = filter->in->rp;
+      if (filter->stats_enabled)
+        start = pdf_stm_be_clock ();
       filter_status = filter->impl->apply_fn (filter->state,
                                               filter->in,
                                               filter->out,
                                               filter->really_finish,
                                               &(filter->error));
+      if (filter->impl->passthrough)
+        filter->copied_bytes += filter->out->wp - out_wp;
+
+      if (filter->stats_enabled)
+        {
+          filter->stats.apply_usecs += pdf_stm_be_clock () - start;
+          filter->stats.n_applies++;
+          if (filter->in->rp > in_rp)
+            filter->stats.bytes_in += filter->in->rp - in_rp;
+          if (filter->out->wp > out_wp)
+            filter->stats.bytes_out += filter->out->wp - out_wp;
+          if (filter_status == PDF_STM_FILTER_APPLY_STATUS_NO_INPUT)
+            filter->stats.n_no_input++;
+          else if (filter_status == PDF_STM_FILTER_APPLY_STATUS_NO_OUTPUT)
+            filter->stats.n_no_output++;
+        }
 
       if (filter_status == PDF_STM_FILTER_APPLY_STATUS_ERROR)
         {
@@ -382,25 +531,94 @@ pdf_stm_filter_apply (pdf_stm_filter_t  *filter,
   return PDF_TRUE;
 }
 
-/* NOTE: This method is not public and not used anywhere, do we need it? */
+void
+pdf_stm_filter_get_copy_counters (pdf_stm_filter_t *filter,
+                                  pdf_size_t       *copied_bytes,
+                                  pdf_size_t       *forwarded_bytes)
+{
+  *copied_bytes = filter->copied_bytes;
+  *forwarded_bytes = filter->forwarded_bytes;
+}
+
+void
+pdf_stm_filter_enable_stats (pdf_stm_filter_t *filter,
+                             pdf_bool_t        enable)
+{
+  filter->stats_enabled = enable;
+
+  memset (&(filter->stats), 0, sizeof (filter->stats));
+  filter->stats.type = filter->type;
+  filter->stats.name = filters[filter->type].name;
+}
+
+void
+pdf_stm_filter_get_stats (pdf_stm_filter_t              *filter,
+                          struct pdf_stm_filter_stats_s *stats)
+{
+  *stats = filter->stats;
+}
+
+pdf_bool_t
+pdf_stm_filter_get_digest (pdf_stm_filter_t          *filter,
+                           enum pdf_crypt_md_algo_e   algorithm,
+                           pdf_char_t                *digest,
+                           pdf_size_t                 size,
+                           pdf_size_t                *digest_size,
+                           pdf_error_t              **error)
+{
+  PDF_ASSERT_POINTER_RETURN_VAL (filter, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (digest, PDF_FALSE);
+
+  if (filter->type != PDF_STM_FILTER_DIGEST)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMATCH,
+                     "cannot read digest: not a digest filter");
+      return PDF_FALSE;
+    }
+
+  return pdf_stm_f_digest_read (filter->state,
+                                algorithm,
+                                digest,
+                                size,
+                                digest_size,
+                                error);
+}
+
+pdf_bool_t
+pdf_stm_filter_can_reset_p (pdf_stm_filter_t *filter)
+{
+  /* Filters without state are always in their initial state */
+  return (filter->impl->init_fn == NULL ||
+          filter->impl->reset_fn != NULL);
+}
+
 pdf_bool_t
 pdf_stm_filter_reset (pdf_stm_filter_t  *filter,
-                      const pdf_hash_t  *params,
                       pdf_error_t      **error)
 {
+  PDF_ASSERT_POINTER_RETURN_VAL (filter, PDF_FALSE);
+
+  if (!pdf_stm_filter_can_reset_p (filter))
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVOP,
+                     "filter type `%s' cannot be reset",
+                     filters[filter->type].name);
+      return PDF_FALSE;
+    }
+
   pdf_clear_error (&(filter->error));
   filter->really_finish = PDF_FALSE;
   filter->eof = PDF_FALSE;
+  filter->copied_bytes = 0;
+  filter->forwarded_bytes = 0;
+  pdf_buffer_rewind (filter->in);
 
-  /* Deinit before re-init */
-  if (filter->impl->deinit_fn)
-    filter->impl->deinit_fn (filter->state);
-
-  /* Re-init */
-  return (filter->impl->init_fn ?
-          filter->impl->init_fn (params,
-                                 &(filter->state),
-                                 error) :
+  return (filter->impl->reset_fn ?
+          filter->impl->reset_fn (filter->state, error) :
           PDF_TRUE);
 }
 
@@ -443,4 +661,42 @@ pdf_stm_filter_get_input (pdf_stm_filter_t  *filter,
   return PDF_TRUE;
 }
 
+static pdf_bool_t
+pdf_stm_filter_hand_over (pdf_stm_filter_t *filter)
+{
+  pdf_buffer_t *in = filter->in;
+  pdf_buffer_t *out = filter->out;
+  pdf_uchar_t *data;
+  pdf_size_t size;
+
+  /* Only possible if there is something to give and the output buffer
+   * is empty */
+  if (pdf_buffer_eob_p (in) ||
+      !pdf_buffer_eob_p (out))
+    return PDF_FALSE;
+
+  /* Swap the internal memory of the buffers, along with its size, as
+   * the buffers next to a filter with a block size or grown by an
+   * adaptive stream may not be as large. Each buffer control structure
+   * keeps on owning exactly one block of memory. */
+  data = out->data;
+  size = out->size;
+  out->data = in->data;
+  out->size = in->size;
+  out->rp = in->rp;
+  out->wp = in->wp;
+  in->data = data;
+  in->size = size;
+  pdf_buffer_rewind (in);
+
+  filter->forwarded_bytes += out->wp - out->rp;
+  if (filter->stats_enabled)
+    {
+      filter->stats.bytes_in += out->wp - out->rp;
+      filter->stats.bytes_out += out->wp - out->rp;
+    }
+
+  return PDF_TRUE;
+}
+
 /* End of pdf-stm-filter.c */
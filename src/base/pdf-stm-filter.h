@@ -31,6 +31,7 @@
 #include <pdf-types.h>
 #include <pdf-types-buffer.h>
 #include <pdf-hash.h>
+#include <pdf-crypt.h>
 #include <pdf-stm-be.h>
 
 /* BEGIN PUBLIC */
@@ -60,7 +61,7 @@ enum pdf_stm_filter_type_e
   PDF_STM_FILTER_RL_ENC,
   PDF_STM_FILTER_RL_DEC,
   PDF_STM_FILTER_CCITTFAX_ENC, /* TODO */
-  PDF_STM_FILTER_CCITTFAX_DEC, /* TODO */
+  PDF_STM_FILTER_CCITTFAX_DEC,
   PDF_STM_FILTER_JBIG2_ENC, /* TODO, see FS#100 */
   PDF_STM_FILTER_JBIG2_DEC, /* Only if libjbig2dec available */
   PDF_STM_FILTER_DCT_ENC,   /* TODO, see FS#73 */
@@ -69,8 +70,8 @@ enum pdf_stm_filter_type_e
   PDF_STM_FILTER_JPX_DEC,
 
   /* Predictors */
-  PDF_STM_FILTER_PRED_ENC, /* TODO, see FS#48 */
-  PDF_STM_FILTER_PRED_DEC, /* TODO, see FS#48 */
+  PDF_STM_FILTER_PRED_ENC,
+  PDF_STM_FILTER_PRED_DEC,
 
   /* Crypt filters */
   PDF_STM_FILTER_AESV2_ENC,
@@ -80,10 +81,29 @@ enum pdf_stm_filter_type_e
 
   /* Hash filters */
   PDF_STM_FILTER_MD5_ENC,
+  PDF_STM_FILTER_DIGEST,
+
+  /* Newer filters are added here, so that the values of the ones
+     above don't change */
+  PDF_STM_FILTER_AESV3_ENC,
+  PDF_STM_FILTER_AESV3_DEC,
 
   PDF_STM_FILTER_LAST
 };
 
+/* Performance counters of a filter */
+struct pdf_stm_filter_stats_s
+{
+  enum pdf_stm_filter_type_e type;
+  const pdf_char_t *name;
+  pdf_size_t n_applies;    /* Calls to the filter implementation */
+  pdf_size_t bytes_in;     /* Octets taken from the input buffer */
+  pdf_size_t bytes_out;    /* Octets put in the output buffer */
+  pdf_size_t n_no_input;   /* Times the filter stopped to get more input */
+  pdf_size_t n_no_output;  /* Times the filter stopped with its output full */
+  pdf_u64_t apply_usecs;   /* Time spent in the filter implementation */
+};
+
 /* END PUBLIC */
 
 enum pdf_stm_filter_mode_e
@@ -117,12 +137,35 @@ typedef struct {
 
   /* Deinitialize filter */
   void (* deinit_fn) (void *state);
+
+  /* Bring the state back to the one just after the initialization,
+   * with the same parameters, without reallocating it. Optional. */
+  pdf_bool_t (* reset_fn) (void         *state,
+                           pdf_error_t **error);
+
+  /* The output of the filter is always equal to its input, so filled
+   * input buffers can be handed over to the output without copying */
+  pdf_bool_t passthrough;
+
+  /* Look at the data handed over by a pass-through filter, which is not
+   * given to apply_fn. Optional. */
+  pdf_bool_t (* peek_fn) (void               *state,
+                          const pdf_uchar_t  *data,
+                          pdf_size_t          size,
+                          pdf_error_t       **error);
+
+  /* Natural size of the chunks of input processed by the filter, or 0.
+   * Input buffers are sized to multiples of it when possible. */
+  pdf_size_t block_size;
 } pdf_stm_filter_impl_t;
 
 typedef struct pdf_stm_filter_s pdf_stm_filter_t;
 
 /* Helper macros to define filters */
 #define PDF_STM_FILTER_DEFINE(GET,INIT,APPLY,DEINIT)                    \
+  PDF_STM_FILTER_DEFINE_BLOCK (GET,INIT,APPLY,DEINIT,0)
+
+#define PDF_STM_FILTER_DEFINE_BLOCK(GET,INIT,APPLY,DEINIT,BLOCK_SIZE)   \
   static pdf_bool_t INIT (const pdf_hash_t  *params,                    \
                           void             **state,                     \
                           pdf_error_t      **error);                    \
@@ -133,9 +176,38 @@ typedef struct pdf_stm_filter_s pdf_stm_filter_t;
                                                    pdf_bool_t     finish, \
                                                    pdf_error_t  **error); \
   static const pdf_stm_filter_impl_t GET##_impl = {                     \
-    .init_fn   = INIT,                                                  \
-    .apply_fn  = APPLY,                                                 \
-    .deinit_fn = DEINIT,                                                \
+    .init_fn    = INIT,                                                 \
+    .apply_fn   = APPLY,                                                \
+    .deinit_fn  = DEINIT,                                               \
+    .block_size = BLOCK_SIZE,                                           \
+  };                                                                    \
+                                                                        \
+  const pdf_stm_filter_impl_t * GET (void)                              \
+  {                                                                     \
+    return &GET##_impl;                                                 \
+  }
+
+#define PDF_STM_FILTER_DEFINE_RESET(GET,INIT,APPLY,DEINIT,RESET)        \
+  PDF_STM_FILTER_DEFINE_FULL (GET,INIT,APPLY,DEINIT,RESET,0)
+
+#define PDF_STM_FILTER_DEFINE_FULL(GET,INIT,APPLY,DEINIT,RESET,BLOCK_SIZE) \
+  static pdf_bool_t INIT (const pdf_hash_t  *params,                    \
+                          void             **state,                     \
+                          pdf_error_t      **error);                    \
+  static void DEINIT (void *state);                                     \
+  static pdf_bool_t RESET (void         *state,                         \
+                           pdf_error_t **error);                        \
+  static enum pdf_stm_filter_apply_status_e APPLY (void          *state, \
+                                                   pdf_buffer_t  *in,   \
+                                                   pdf_buffer_t  *out,  \
+                                                   pdf_bool_t     finish, \
+                                                   pdf_error_t  **error); \
+  static const pdf_stm_filter_impl_t GET##_impl = {                     \
+    .init_fn    = INIT,                                                 \
+    .apply_fn   = APPLY,                                                \
+    .deinit_fn  = DEINIT,                                               \
+    .reset_fn   = RESET,                                                \
+    .block_size = BLOCK_SIZE,                                           \
   };                                                                    \
                                                                         \
   const pdf_stm_filter_impl_t * GET (void)                              \
@@ -160,9 +232,36 @@ typedef struct pdf_stm_filter_s pdf_stm_filter_t;
     return &GET##_impl;                                                 \
   }
 
+#define PDF_STM_FILTER_DEFINE_PASSTHROUGH(GET,APPLY)                    \
+  static enum pdf_stm_filter_apply_status_e APPLY (void          *state, \
+                                                   pdf_buffer_t  *in,   \
+                                                   pdf_buffer_t  *out,  \
+                                                   pdf_bool_t     finish, \
+                                                   pdf_error_t  **error); \
+  static const pdf_stm_filter_impl_t GET##_impl = {                     \
+    .init_fn     = NULL,                                                \
+    .apply_fn    = APPLY,                                               \
+    .deinit_fn   = NULL,                                                \
+    .passthrough = PDF_TRUE,                                            \
+  };                                                                    \
+                                                                        \
+  const pdf_stm_filter_impl_t * GET (void)                              \
+  {                                                                     \
+    return &GET##_impl;                                                 \
+  }
+
 
 pdf_bool_t pdf_stm_filter_p (enum pdf_stm_filter_type_e type);
 
+/* Check that a filter is supported and accepts the given parameters */
+pdf_bool_t pdf_stm_filter_check (enum pdf_stm_filter_type_e   type,
+                                 const pdf_hash_t            *params,
+                                 pdf_error_t                **error);
+
+/* Size of the input buffer of a filter, given the requested one */
+pdf_size_t pdf_stm_filter_get_buffer_size (enum pdf_stm_filter_type_e type,
+                                           pdf_size_t                 size);
+
 pdf_stm_filter_t *pdf_stm_filter_new (enum pdf_stm_filter_type_e   type,
                                       const pdf_hash_t            *params,
                                       pdf_size_t                   buffer_size,
@@ -182,6 +281,10 @@ void pdf_stm_filter_set_out (pdf_stm_filter_t *filter,
 
 pdf_buffer_t *pdf_stm_filter_get_in (pdf_stm_filter_t *filter);
 
+enum pdf_stm_filter_type_e pdf_stm_filter_get_type (pdf_stm_filter_t *filter);
+
+const pdf_char_t *pdf_stm_filter_get_name (pdf_stm_filter_t *filter);
+
 pdf_stm_filter_t *pdf_stm_filter_get_next (pdf_stm_filter_t *filter);
 
 pdf_stm_filter_t *pdf_stm_filter_get_tail (pdf_stm_filter_t *filter);
@@ -191,8 +294,36 @@ pdf_bool_t pdf_stm_filter_apply (pdf_stm_filter_t  *filter,
                                  pdf_bool_t        *eof,
                                  pdf_error_t      **error);
 
+/* Number of octets copied and handed over without copying by the filter
+ * between its input and output buffers. Only pass-through filters are
+ * accounted, as in the other ones the output is a transformation of the
+ * input. */
+void pdf_stm_filter_get_copy_counters (pdf_stm_filter_t *filter,
+                                       pdf_size_t       *copied_bytes,
+                                       pdf_size_t       *forwarded_bytes);
+
+/* Start or stop collecting the performance counters of the filter.
+ * Enabling them resets them. */
+void pdf_stm_filter_enable_stats (pdf_stm_filter_t *filter,
+                                  pdf_bool_t        enable);
+
+void pdf_stm_filter_get_stats (pdf_stm_filter_t              *filter,
+                               struct pdf_stm_filter_stats_s *stats);
+
+/* Copy the digest computed with ALGORITHM by a digest filter, once it
+ * reached EOF */
+pdf_bool_t pdf_stm_filter_get_digest (pdf_stm_filter_t          *filter,
+                                      enum pdf_crypt_md_algo_e   algorithm,
+                                      pdf_char_t                *digest,
+                                      pdf_size_t                 size,
+                                      pdf_size_t                *digest_size,
+                                      pdf_error_t              **error);
+
+/* Whether the filter can be brought back to its initial state */
+pdf_bool_t pdf_stm_filter_can_reset_p (pdf_stm_filter_t *filter);
+
+/* Reset the filter in place, discarding any pending data */
 pdf_bool_t pdf_stm_filter_reset (pdf_stm_filter_t  *filter,
-                                 const pdf_hash_t  *params,
                                  pdf_error_t      **error);
 
 #endif /* ! PDF_STM_FILTER_H */
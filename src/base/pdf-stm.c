@@ -27,6 +27,7 @@
 
 #include <unistd.h>
 #include <string.h>
+#include <pthread.h>
 
 #include <pdf-alloc.h>
 #include <pdf-stm.h>
@@ -34,6 +35,8 @@
 #include <pdf-stm-be-mem.h>
 #include <pdf-stm-be-cfile.h>
 #include <pdf-stm-be-file.h>
+#include <pdf-stm-be-mmap.h>
+#include <pdf-jobs.h>
 
 /* Forward declarations */
 
@@ -47,6 +50,43 @@ static pdf_bool_t pdf_stm_read_peek_char (pdf_stm_t     *stm,
                                           pdf_bool_t     peek,
                                           pdf_error_t  **error);
 
+static pdf_bool_t pdf_stm_refill_cache (pdf_stm_t    *stm,
+                                        pdf_bool_t   *eof,
+                                        pdf_error_t **error);
+
+static void pdf_stm_decode_job (void *job);
+
+static pdf_bool_t pdf_stm_grow_cache (pdf_stm_t *stm);
+
+static pdf_size_t pdf_stm_get_buffers_size (pdf_stm_t *stm);
+
+static void pdf_stm_push_filter (pdf_stm_t        *stm,
+                                 pdf_stm_filter_t *filter);
+
+static pdf_bool_t pdf_stm_check_reset (pdf_stm_t    *stm,
+                                       pdf_error_t **error);
+
+static pdf_bool_t pdf_stm_reset_chain (pdf_stm_t    *stm,
+                                       pdf_error_t **error);
+
+/* Number of consecutive runs of the filter chain using up the cache
+ * after which the buffers of an adaptive stream are grown */
+#define PDF_STM_CACHE_GROW_STREAK 2
+
+/* Memory used by the grown buffers of all the streams */
+struct pdf_stm_cache_budget_s
+{
+  pthread_mutex_t lock;
+  pdf_size_t budget;
+  pdf_size_t used;
+};
+
+static struct pdf_stm_cache_budget_s cache_budget = {
+  PTHREAD_MUTEX_INITIALIZER,
+  PDF_STM_DEFAULT_CACHE_BUDGET,
+  0
+};
+
 /*
  * Public functions
  */
@@ -137,6 +177,51 @@ pdf_stm_file_new (pdf_fsys_file_t      *file,
   return stm;
 }
 
+pdf_stm_t *
+pdf_stm_mmap_new (pdf_fsys_file_t              *file,
+                  pdf_off_t                     offset,
+                  pdf_size_t                    cache_size,
+                  enum pdf_fsys_file_access_e   access,
+                  pdf_error_t                 **error)
+{
+  pdf_stm_t *stm;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (file, NULL);
+  /* Note: if cache_size == 0, we'll use the default one */
+
+  /* Allocate memory for the new stream */
+  stm = pdf_alloc (sizeof (struct pdf_stm_s));
+  if (!stm)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "not enough memory to create a stream: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) sizeof (struct pdf_stm_s));
+      return NULL;
+    }
+
+  /* Initialize a mapped file stream. Nothing else is initialized yet,
+   * so a failure here must not go through pdf_stm_destroy() */
+  stm->type = PDF_STM_FILE;
+  stm->backend = pdf_stm_be_new_mmap (file, offset, access, error);
+  if (!stm->backend)
+    {
+      pdf_dealloc (stm);
+      return NULL;
+    }
+
+  /* Initialize the common parts. Mapped streams are always read
+   * streams. */
+  if (!pdf_stm_init (stm, cache_size, PDF_STM_READ, error))
+    {
+      pdf_stm_destroy (stm);
+      return NULL;
+    }
+  return stm;
+}
+
 pdf_stm_t *
 pdf_stm_mem_new (pdf_uchar_t          *buffer,
                  pdf_size_t            size,
@@ -194,6 +279,11 @@ pdf_stm_destroy (pdf_stm_t *stm)
   /* Destroy the backend */
   pdf_stm_be_destroy (stm->backend);
 
+  /* Give back the memory taken from the cache budget */
+  pthread_mutex_lock (&cache_budget.lock);
+  cache_budget.used -= stm->cache_reserved;
+  pthread_mutex_unlock (&cache_budget.lock);
+
   /* Destroy the cache */
   pdf_buffer_destroy (stm->cache);
 
@@ -212,6 +302,77 @@ pdf_stm_destroy (pdf_stm_t *stm)
   pdf_dealloc (stm);
 }
 
+pdf_bool_t
+pdf_stm_reset (pdf_stm_t    *stm,
+               pdf_off_t     pos,
+               pdf_error_t **error)
+{
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+
+  if (!pdf_stm_check_reset (stm, error))
+    return PDF_FALSE;
+
+  if (pdf_stm_be_seek (stm->backend, pos) < 0)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ERROR,
+                     "cannot reset stream: "
+                     "couldn't seek the backend to position %ld",
+                     (long) pos);
+      return PDF_FALSE;
+    }
+
+  return pdf_stm_reset_chain (stm, error);
+}
+
+pdf_bool_t
+pdf_stm_mem_reset (pdf_stm_t    *stm,
+                   pdf_uchar_t  *buffer,
+                   pdf_size_t    size,
+                   pdf_error_t **error)
+{
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (stm->type == PDF_STM_MEM, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (buffer, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (size > 0, PDF_FALSE);
+
+  if (!pdf_stm_check_reset (stm, error))
+    return PDF_FALSE;
+
+  pdf_stm_be_mem_set_buffer (stm->backend, buffer, size);
+
+  return pdf_stm_reset_chain (stm, error);
+}
+
+pdf_bool_t
+pdf_stm_file_reset (pdf_stm_t    *stm,
+                    pdf_off_t     offset,
+                    pdf_size_t    length,
+                    pdf_error_t **error)
+{
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (stm->type == PDF_STM_FILE, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (offset >= 0, PDF_FALSE);
+
+  if (!pdf_stm_check_reset (stm, error))
+    return PDF_FALSE;
+
+  if (!pdf_stm_be_can_set_range_p (stm->backend))
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVOP,
+                     "cannot reset stream: "
+                     "the backend cannot be moved to a new range");
+      return PDF_FALSE;
+    }
+
+  pdf_stm_be_set_range (stm->backend, offset, length);
+
+  return pdf_stm_reset_chain (stm, error);
+}
+
 enum pdf_stm_mode_e
 pdf_stm_get_mode (pdf_stm_t *stm)
 {
@@ -220,6 +381,48 @@ pdf_stm_get_mode (pdf_stm_t *stm)
   return stm->mode;
 }
 
+void
+pdf_stm_set_cache_policy (pdf_stm_t                   *stm,
+                          enum pdf_stm_cache_policy_e  policy,
+                          pdf_size_t                   expected_size)
+{
+  PDF_ASSERT_POINTER_RETURN (stm);
+  PDF_ASSERT_RETURN (policy == PDF_STM_CACHE_FIXED ||
+                     policy == PDF_STM_CACHE_ADAPTIVE);
+
+  stm->cache_policy = policy;
+  stm->cache_full_streak = 0;
+
+  /* Buffers bigger than the whole stream would be wasted. Already grown
+   * buffers are kept. */
+  stm->cache_max_size = PDF_STM_MAX_CACHE_SIZE;
+  if (expected_size > 0)
+    stm->cache_max_size = PDF_MIN (stm->cache_max_size, expected_size);
+  stm->cache_max_size = PDF_MAX (stm->cache_max_size, stm->cache->size);
+}
+
+void
+pdf_stm_set_cache_budget (pdf_size_t budget)
+{
+  /* Streams already over the new budget keep their buffers, but won't
+   * grow them any more */
+  pthread_mutex_lock (&cache_budget.lock);
+  cache_budget.budget = budget;
+  pthread_mutex_unlock (&cache_budget.lock);
+}
+
+void
+pdf_stm_get_cache_budget (pdf_size_t *budget,
+                          pdf_size_t *used)
+{
+  pthread_mutex_lock (&cache_budget.lock);
+  if (budget)
+    *budget = cache_budget.budget;
+  if (used)
+    *used = cache_budget.used;
+  pthread_mutex_unlock (&cache_budget.lock);
+}
+
 pdf_bool_t
 pdf_stm_read (pdf_stm_t    *stm,
               pdf_uchar_t  *buf,
@@ -254,23 +457,9 @@ pdf_stm_read (pdf_stm_t    *stm,
       pdf_size_t cache_size;
 
       /* If the cache is empty, refill it with filtered data */
-      if (pdf_buffer_eob_p (stm->cache))
-        {
-          pdf_error_t *inner_error = NULL;
-
-          pdf_buffer_rewind (stm->cache);
-
-          /* Break if apply fails */
-          if (!pdf_stm_filter_apply (stm->filter,
-                                     PDF_FALSE,
-                                     &eof,
-                                     &inner_error))
-            {
-              /* Report error */
-              pdf_propagate_error (error, inner_error);
-              return PDF_FALSE;
-            }
-        }
+      if (pdf_buffer_eob_p (stm->cache) &&
+          !pdf_stm_refill_cache (stm, &eof, error))
+        return PDF_FALSE;
 
       /* Read data from the cache */
       PDF_ASSERT (stm->cache->wp >= stm->cache->rp);
@@ -286,6 +475,8 @@ pdf_stm_read (pdf_stm_t    *stm,
       stm->cache->rp += to_copy_bytes;
     }
 
+  stm->copied_bytes += *read_bytes;
+
   /* Update the sequential counter */
   stm->seq_counter += *read_bytes;
 
@@ -336,6 +527,12 @@ pdf_stm_write (pdf_stm_t         *stm,
           pdf_size_t flushed_bytes = 0;
           pdf_error_t *inner_error = NULL;
 
+          /* Data is being written in bulk: give more room to it instead
+           * of flushing */
+          if (++stm->cache_full_streak >= PDF_STM_CACHE_GROW_STREAK &&
+              pdf_stm_grow_cache (stm))
+            continue;
+
           /* Flush the cache */
           if (!pdf_stm_flush (stm,
                               PDF_FALSE,
@@ -375,6 +572,8 @@ pdf_stm_write (pdf_stm_t         *stm,
         }
     }
 
+  stm->copied_bytes += *written_bytes;
+
   /* Update the sequential counter */
   stm->seq_counter += *written_bytes;
 
@@ -422,6 +621,8 @@ pdf_stm_flush (pdf_stm_t    *stm,
 
       tail_size = tail_buffer->wp - tail_buffer->rp;
 
+      stm->n_runs++;
+
       /* Break only on error */
       if (!pdf_stm_filter_apply (stm->filter, finish, &eof, &inner_error))
         break;
@@ -470,6 +671,157 @@ pdf_stm_flush (pdf_stm_t    *stm,
   return (eof ? PDF_FALSE : PDF_TRUE);;
 }
 
+void
+pdf_stm_get_copy_counters (pdf_stm_t  *stm,
+                           pdf_size_t *copied_bytes,
+                           pdf_size_t *forwarded_bytes)
+{
+  pdf_stm_filter_t *filter;
+
+  PDF_ASSERT_POINTER_RETURN (stm);
+  PDF_ASSERT_POINTER_RETURN (copied_bytes);
+  PDF_ASSERT_POINTER_RETURN (forwarded_bytes);
+
+  *copied_bytes = stm->copied_bytes;
+  *forwarded_bytes = 0;
+
+  /* Add the counters of every filter in the chain */
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    {
+      pdf_size_t filter_copied;
+      pdf_size_t filter_forwarded;
+
+      pdf_stm_filter_get_copy_counters (filter,
+                                        &filter_copied,
+                                        &filter_forwarded);
+      *copied_bytes += filter_copied;
+      *forwarded_bytes += filter_forwarded;
+    }
+}
+
+pdf_bool_t
+pdf_stm_get_digest (pdf_stm_t                 *stm,
+                    enum pdf_crypt_md_algo_e   algorithm,
+                    pdf_char_t                *digest,
+                    pdf_size_t                 size,
+                    pdf_size_t                *digest_size,
+                    pdf_error_t              **error)
+{
+  pdf_stm_filter_t *filter;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (digest, PDF_FALSE);
+
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    {
+      pdf_error_t *inner_error = NULL;
+
+      if (pdf_stm_filter_get_digest (filter,
+                                     algorithm,
+                                     digest,
+                                     size,
+                                     digest_size,
+                                     &inner_error))
+        return PDF_TRUE;
+
+      /* Skip the filters not computing that digest */
+      if (pdf_error_get_status (inner_error) != PDF_ENOMATCH)
+        {
+          pdf_propagate_error (error, inner_error);
+          return PDF_FALSE;
+        }
+      pdf_error_destroy (inner_error);
+    }
+
+  pdf_set_error (error,
+                 PDF_EDOMAIN_BASE_STM,
+                 PDF_ENOMATCH,
+                 "cannot read digest: "
+                 "no filter in the stream computes it");
+  return PDF_FALSE;
+}
+
+void
+pdf_stm_get_cache_stats (pdf_stm_t                    *stm,
+                         struct pdf_stm_cache_stats_s *stats)
+{
+  PDF_ASSERT_POINTER_RETURN (stm);
+  PDF_ASSERT_POINTER_RETURN (stats);
+
+  stats->policy = stm->cache_policy;
+  stats->initial_size = stm->cache_initial_size;
+  stats->size = stm->cache->size;
+  stats->max_size = stm->cache_max_size;
+  stats->buffers_size = pdf_stm_get_buffers_size (stm);
+  stats->n_runs = stm->n_runs;
+  stats->n_resizes = stm->n_resizes;
+}
+
+void
+pdf_stm_enable_stats (pdf_stm_t  *stm,
+                      pdf_bool_t  enable)
+{
+  pdf_stm_filter_t *filter;
+
+  PDF_ASSERT_POINTER_RETURN (stm);
+
+  stm->stats_enabled = enable;
+
+  memset (&(stm->be_stats), 0, sizeof (stm->be_stats));
+  stm->backend->stats = (enable ? &(stm->be_stats) : NULL);
+
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    pdf_stm_filter_enable_stats (filter, enable);
+}
+
+pdf_bool_t
+pdf_stm_get_stats (pdf_stm_t                     *stm,
+                   struct pdf_stm_stats_s        *stats,
+                   struct pdf_stm_filter_stats_s *filter_stats,
+                   pdf_size_t                     n_filter_stats,
+                   pdf_error_t                  **error)
+{
+  pdf_stm_filter_t *filter;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (stats, PDF_FALSE);
+  PDF_ASSERT_RETURN_VAL (filter_stats || n_filter_stats == 0, PDF_FALSE);
+
+  if (!stm->stats_enabled)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVOP,
+                     "cannot get the stream statistics: "
+                     "they are not being collected");
+      return PDF_FALSE;
+    }
+
+  stats->n_be_reads = stm->be_stats.n_reads;
+  stats->be_read_bytes = stm->be_stats.read_bytes;
+  stats->n_be_writes = stm->be_stats.n_writes;
+  stats->be_written_bytes = stm->be_stats.written_bytes;
+  stats->be_usecs = stm->be_stats.usecs;
+
+  stats->n_filters = 0;
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    {
+      if (stats->n_filters < n_filter_stats)
+        pdf_stm_filter_get_stats (filter, &filter_stats[stats->n_filters]);
+      stats->n_filters++;
+    }
+
+  return PDF_TRUE;
+}
+
 pdf_bool_t
 pdf_stm_supported_filter_p (enum pdf_stm_filter_type_e filter_type)
 {
@@ -479,6 +831,136 @@ pdf_stm_supported_filter_p (enum pdf_stm_filter_type_e filter_type)
   return pdf_stm_filter_p (filter_type);
 }
 
+/* Compiled filter chain */
+struct pdf_stm_filter_chain_s
+{
+  struct pdf_stm_filter_spec_s *filters;
+  pdf_size_t n_filters;
+};
+
+pdf_stm_filter_chain_t *
+pdf_stm_filter_chain_new (const struct pdf_stm_filter_spec_s  *filters,
+                          pdf_size_t                           n_filters,
+                          pdf_error_t                        **error)
+{
+  pdf_stm_filter_chain_t *chain;
+  pdf_size_t i;
+
+  PDF_ASSERT_RETURN_VAL (filters || n_filters == 0, NULL);
+
+  /* Validate all the filters once, so that installing the chain later
+   * only fails if the resources to create the filters are missing */
+  for (i = 0; i < n_filters; i++)
+    {
+      if (!pdf_stm_filter_check (filters[i].type,
+                                 filters[i].params,
+                                 error))
+        return NULL;
+    }
+
+  chain = pdf_alloc (sizeof (struct pdf_stm_filter_chain_s));
+  if (!chain)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "not enough memory to create a filter chain: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) sizeof (struct pdf_stm_filter_chain_s));
+      return NULL;
+    }
+
+  chain->filters = NULL;
+  chain->n_filters = n_filters;
+  if (n_filters > 0)
+    {
+      chain->filters = pdf_alloc (n_filters * sizeof (filters[0]));
+      if (!chain->filters)
+        {
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_ENOMEM,
+                         "not enough memory to create a filter chain: "
+                         "couldn't allocate %lu bytes",
+                         (unsigned long) (n_filters * sizeof (filters[0])));
+          pdf_dealloc (chain);
+          return NULL;
+        }
+      memcpy (chain->filters, filters, n_filters * sizeof (filters[0]));
+    }
+
+  return chain;
+}
+
+void
+pdf_stm_filter_chain_destroy (pdf_stm_filter_chain_t *chain)
+{
+  if (!chain)
+    return;
+
+  pdf_dealloc (chain->filters);
+  pdf_dealloc (chain);
+}
+
+pdf_bool_t
+pdf_stm_install_filter_chain (pdf_stm_t                     *stm,
+                              const pdf_stm_filter_chain_t  *chain,
+                              pdf_error_t                  **error)
+{
+  pdf_stm_filter_t **created;
+  enum pdf_stm_filter_mode_e filter_mode;
+  pdf_size_t i;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (chain, PDF_FALSE);
+
+  if (chain->n_filters == 0)
+    return PDF_TRUE;
+
+  filter_mode = (stm->mode == PDF_STM_READ ?
+                 PDF_STM_FILTER_MODE_READ :
+                 PDF_STM_FILTER_MODE_WRITE);
+
+  created = pdf_alloc (chain->n_filters * sizeof (created[0]));
+  if (!created)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ENOMEM,
+                     "not enough memory to install a filter chain: "
+                     "couldn't allocate %lu bytes",
+                     (unsigned long) (chain->n_filters * sizeof (created[0])));
+      return PDF_FALSE;
+    }
+
+  /* Create all the filters before touching the stream, so that it is
+   * left unchanged if any of them cannot be created */
+  for (i = 0; i < chain->n_filters; i++)
+    {
+      enum pdf_stm_filter_type_e type = chain->filters[i].type;
+
+      created[i] = pdf_stm_filter_new (type,
+                                       chain->filters[i].params,
+                                       pdf_stm_filter_get_buffer_size (type,
+                                                                       stm->cache->size),
+                                       filter_mode,
+                                       error);
+      if (!created[i])
+        {
+          while (i-- > 0)
+            pdf_stm_filter_destroy (created[i]);
+          pdf_dealloc (created);
+          return PDF_FALSE;
+        }
+    }
+
+  for (i = 0; i < chain->n_filters; i++)
+    pdf_stm_push_filter (stm, created[i]);
+
+  pdf_dealloc (created);
+  return PDF_TRUE;
+}
+
 pdf_bool_t
 pdf_stm_install_filter (pdf_stm_t                   *stm,
                         enum pdf_stm_filter_type_e   filter_type,
@@ -495,7 +977,9 @@ pdf_stm_install_filter (pdf_stm_t                   *stm,
                  PDF_STM_FILTER_MODE_WRITE);
 
   /* Create the new filter. Note that filter_params is passed directly to the
-   * filter implementation creator, and that it may well be NULL. */
+   * filter implementation creator, and that it may well be NULL. Unlike
+   * in filter chains, the buffer is not rounded to the block size of the
+   * filter. */
   filter = pdf_stm_filter_new (filter_type,
                                filter_params,
                                stm->cache->size,
@@ -504,11 +988,7 @@ pdf_stm_install_filter (pdf_stm_t                   *stm,
   if (!filter)
     return PDF_FALSE;
 
-  /* Set the new filter as the new head of the filter chain */
-  pdf_stm_filter_set_next (filter, stm->filter);
-  pdf_stm_filter_set_out (filter, stm->cache);
-  pdf_stm_filter_set_out (stm->filter, pdf_stm_filter_get_in (filter));
-  stm->filter = filter;
+  pdf_stm_push_filter (stm, filter);
 
   return PDF_TRUE;
 }
@@ -535,6 +1015,93 @@ pdf_stm_peek_char (pdf_stm_t    *stm,
   return pdf_stm_read_peek_char (stm, read_char, PDF_TRUE, error);
 }
 
+pdf_bool_t
+pdf_stm_read_view (pdf_stm_t          *stm,
+                   const pdf_uchar_t **data,
+                   pdf_size_t         *data_size,
+                   pdf_error_t       **error)
+{
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (data, PDF_FALSE);
+  PDF_ASSERT_POINTER_RETURN_VAL (data_size, PDF_FALSE);
+
+  *data = NULL;
+  *data_size = 0;
+
+  /* Is this a read stream? */
+  if (stm->mode != PDF_STM_READ)
+    {
+      /* Invalid operation */
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVOP,
+                     "cannot read from a write stream");
+      return PDF_FALSE;
+    }
+
+  /* If the cache is empty, refill it with filtered data */
+  if (pdf_buffer_eob_p (stm->cache))
+    {
+      pdf_bool_t eof = PDF_FALSE;
+
+      if (!pdf_stm_refill_cache (stm, &eof, error))
+        return PDF_FALSE;
+    }
+
+  /* If still empty, EOF */
+  if (pdf_buffer_eob_p (stm->cache))
+    return PDF_FALSE;
+
+  /* Lend the pending contents of the cache to the caller. Nothing is
+   * consumed until pdf_stm_consume() is called. */
+  PDF_ASSERT (stm->cache->wp >= stm->cache->rp);
+  *data = stm->cache->data + stm->cache->rp;
+  *data_size = stm->cache->wp - stm->cache->rp;
+
+  return PDF_TRUE;
+}
+
+pdf_bool_t
+pdf_stm_consume (pdf_stm_t    *stm,
+                 pdf_size_t    bytes,
+                 pdf_error_t **error)
+{
+  pdf_size_t cache_size;
+
+  PDF_ASSERT_POINTER_RETURN_VAL (stm, PDF_FALSE);
+
+  /* Is this a read stream? */
+  if (stm->mode != PDF_STM_READ)
+    {
+      /* Invalid operation */
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVOP,
+                     "cannot consume data from a write stream");
+      return PDF_FALSE;
+    }
+
+  /* Only the data lent in the last view can be consumed */
+  cache_size = stm->cache->wp - stm->cache->rp;
+  if (bytes > cache_size)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_EINVRANGE,
+                     "cannot consume %lu bytes: only %lu available in view",
+                     (unsigned long) bytes,
+                     (unsigned long) cache_size);
+      return PDF_FALSE;
+    }
+
+  stm->cache->rp += bytes;
+
+  /* Update the sequential counter */
+  stm->seq_counter += bytes;
+
+  return PDF_TRUE;
+}
+
 pdf_off_t
 pdf_stm_bseek (pdf_stm_t *stm,
                pdf_off_t  pos)
@@ -627,10 +1194,101 @@ pdf_stm_tell (pdf_stm_t *stm)
   return stm->seq_counter;
 }
 
+pdf_bool_t
+pdf_stm_decode_batch (struct pdf_stm_decode_job_s  *jobs,
+                      pdf_size_t                    n_jobs,
+                      pdf_error_t                 **error)
+{
+  pdf_size_t n_failed;
+  pdf_size_t i;
+
+  PDF_ASSERT_RETURN_VAL (jobs || n_jobs == 0, PDF_FALSE);
+
+  if (!pdf_jobs_run (pdf_stm_decode_job,
+                     jobs,
+                     sizeof (struct pdf_stm_decode_job_s),
+                     n_jobs,
+                     error))
+    return PDF_FALSE;
+
+  n_failed = 0;
+  for (i = 0; i < n_jobs; i++)
+    {
+      if (jobs[i].error)
+        n_failed++;
+    }
+
+  if (n_failed > 0)
+    {
+      pdf_set_error (error,
+                     PDF_EDOMAIN_BASE_STM,
+                     PDF_ERROR,
+                     "cannot decode %lu of %lu streams",
+                     (unsigned long) n_failed,
+                     (unsigned long) n_jobs);
+      return PDF_FALSE;
+    }
+
+  return PDF_TRUE;
+}
+
 /*
  * Private functions
  */
 
+/* Check that every filter of the chain of STM can be reset, so that
+ * the stream is left unchanged if it cannot be */
+static pdf_bool_t
+pdf_stm_check_reset (pdf_stm_t    *stm,
+                     pdf_error_t **error)
+{
+  pdf_stm_filter_t *filter;
+
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    {
+      if (!pdf_stm_filter_can_reset_p (filter))
+        {
+          pdf_set_error (error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_EINVOP,
+                         "cannot reset stream: "
+                         "filter type `%s' cannot be reset",
+                         pdf_stm_filter_get_name (filter));
+          return PDF_FALSE;
+        }
+    }
+
+  return PDF_TRUE;
+}
+
+/* Reset the filters of STM in place and empty its cache, once the
+ * backend has been moved */
+static pdf_bool_t
+pdf_stm_reset_chain (pdf_stm_t    *stm,
+                     pdf_error_t **error)
+{
+  pdf_stm_filter_t *filter;
+
+  /* Any pending data is discarded */
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    {
+      if (!pdf_stm_filter_reset (filter, error))
+        return PDF_FALSE;
+    }
+
+  pdf_buffer_rewind (stm->cache);
+
+  stm->seq_counter = 0;
+  stm->copied_bytes = 0;
+  stm->cache_full_streak = 0;
+
+  return PDF_TRUE;
+}
+
 static pdf_bool_t
 pdf_stm_init (pdf_stm_t            *stm,
               pdf_size_t            cache_size,
@@ -643,6 +1301,19 @@ pdf_stm_init (pdf_stm_t            *stm,
 
   /* The sequential counter is initially 0 */
   stm->seq_counter = 0;
+  stm->copied_bytes = 0;
+
+  /* The cache keeps its size until asked otherwise */
+  stm->cache_policy = PDF_STM_CACHE_FIXED;
+  stm->cache_initial_size = cache_size;
+  stm->cache_max_size = cache_size;
+  stm->cache_reserved = 0;
+  stm->cache_full_streak = 0;
+  stm->n_runs = 0;
+  stm->n_resizes = 0;
+
+  /* Performance counters are opt-in */
+  stm->stats_enabled = PDF_FALSE;
 
   stm->filter = pdf_stm_filter_new (PDF_STM_FILTER_NULL,
                                     NULL, /* No filter params needed */
@@ -703,17 +1374,9 @@ pdf_stm_read_peek_char (pdf_stm_t    *stm,
   if (pdf_buffer_eob_p (stm->cache))
     {
       pdf_bool_t eof = PDF_FALSE;
-      pdf_error_t *inner_error = NULL;
 
-      pdf_buffer_rewind (stm->cache);
-      if (!pdf_stm_filter_apply (stm->filter,
-                                 PDF_FALSE,
-                                 &eof,
-                                 &inner_error))
-        {
-          pdf_propagate_error (error, inner_error);
-          return PDF_FALSE;
-        }
+      if (!pdf_stm_refill_cache (stm, &eof, error))
+        return PDF_FALSE;
     }
 
   /* If still empty, EOF */
@@ -732,4 +1395,271 @@ pdf_stm_read_peek_char (pdf_stm_t    *stm,
   return PDF_TRUE;
 }
 
+static pdf_bool_t
+pdf_stm_refill_cache (pdf_stm_t    *stm,
+                      pdf_bool_t   *eof,
+                      pdf_error_t **error)
+{
+  pdf_error_t *inner_error = NULL;
+
+  /* The cache should be empty at this point */
+  pdf_buffer_rewind (stm->cache);
+
+  /* The last runs of the filter chain filled the whole cache, and it was
+   * used up: data flows steadily, so grow the buffers */
+  if (stm->cache_full_streak >= PDF_STM_CACHE_GROW_STREAK)
+    pdf_stm_grow_cache (stm);
+
+  stm->n_runs++;
+  if (!pdf_stm_filter_apply (stm->filter,
+                             PDF_FALSE,
+                             eof,
+                             &inner_error))
+    {
+      pdf_propagate_error (error, inner_error);
+      return PDF_FALSE;
+    }
+
+  if (pdf_buffer_full_p (stm->cache))
+    stm->cache_full_streak++;
+  else
+    stm->cache_full_streak = 0;
+
+  return PDF_TRUE;
+}
+
+/* Double the size of the cache and of the input buffers of the filters
+ * of an adaptive stream, as far as its limit and the cache budget
+ * allow. Pending data is kept in the buffers. */
+static pdf_bool_t
+pdf_stm_grow_cache (pdf_stm_t *stm)
+{
+  pdf_stm_filter_t *filter;
+  pdf_size_t new_size;
+  pdf_size_t old_total;
+  pdf_size_t new_total;
+  pdf_size_t grown;
+  pdf_bool_t reserved;
+
+  stm->cache_full_streak = 0;
+
+  if (stm->cache_policy != PDF_STM_CACHE_ADAPTIVE ||
+      stm->cache->size >= stm->cache_max_size)
+    return PDF_FALSE;
+
+  new_size = PDF_MIN (2 * stm->cache->size, stm->cache_max_size);
+
+  /* Compute the memory needed by the grown buffers */
+  old_total = pdf_stm_get_buffers_size (stm);
+  new_total = new_size;
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    {
+      pdf_size_t in_size;
+
+      in_size = pdf_stm_filter_get_buffer_size (pdf_stm_filter_get_type (filter),
+                                                new_size);
+      new_total += PDF_MAX (in_size, pdf_stm_filter_get_in (filter)->size);
+    }
+
+  pthread_mutex_lock (&cache_budget.lock);
+  reserved = (cache_budget.used <= cache_budget.budget &&
+              new_total - old_total <= cache_budget.budget - cache_budget.used);
+  if (reserved)
+    cache_budget.used += new_total - old_total;
+  pthread_mutex_unlock (&cache_budget.lock);
+
+  if (!reserved)
+    {
+      /* Don't try again */
+      stm->cache_max_size = stm->cache->size;
+      return PDF_FALSE;
+    }
+
+  /* Growing is just an optimization: if memory is missing, keep on with
+   * the buffers reached so far */
+  if (pdf_buffer_resize (stm->cache, new_size, NULL))
+    {
+      for (filter = stm->filter;
+           filter != NULL;
+           filter = pdf_stm_filter_get_next (filter))
+        {
+          pdf_buffer_t *in = pdf_stm_filter_get_in (filter);
+          pdf_size_t in_size;
+
+          in_size = pdf_stm_filter_get_buffer_size (pdf_stm_filter_get_type (filter),
+                                                    new_size);
+          if (in_size > in->size &&
+              !pdf_buffer_resize (in, in_size, NULL))
+            break;
+        }
+    }
+
+  /* Give back what was not used */
+  grown = pdf_stm_get_buffers_size (stm) - old_total;
+  pthread_mutex_lock (&cache_budget.lock);
+  cache_budget.used -= (new_total - old_total) - grown;
+  pthread_mutex_unlock (&cache_budget.lock);
+
+  stm->cache_reserved += grown;
+  if (grown == 0)
+    {
+      stm->cache_max_size = stm->cache->size;
+      return PDF_FALSE;
+    }
+
+  stm->n_resizes++;
+  return PDF_TRUE;
+}
+
+/* Memory used by the cache and the buffers of the filter chain */
+static pdf_size_t
+pdf_stm_get_buffers_size (pdf_stm_t *stm)
+{
+  pdf_stm_filter_t *filter;
+  pdf_size_t size;
+
+  size = stm->cache->size;
+  for (filter = stm->filter;
+       filter != NULL;
+       filter = pdf_stm_filter_get_next (filter))
+    size += pdf_stm_filter_get_in (filter)->size;
+
+  return size;
+}
+
+/* Set FILTER as the new head of the filter chain of STM */
+static void
+pdf_stm_push_filter (pdf_stm_t        *stm,
+                     pdf_stm_filter_t *filter)
+{
+  pdf_stm_filter_set_next (filter, stm->filter);
+  pdf_stm_filter_set_out (filter, stm->cache);
+  if (stm->stats_enabled)
+    pdf_stm_filter_enable_stats (filter, PDF_TRUE);
+  pdf_stm_filter_set_out (stm->filter, pdf_stm_filter_get_in (filter));
+  stm->filter = filter;
+}
+
+/* Run in the job pool: decode the data of a single job */
+static void
+pdf_stm_decode_job (void *job_p)
+{
+  struct pdf_stm_decode_job_s *job = job_p;
+  pdf_uchar_t *raw = NULL;
+  pdf_stm_t *stm = NULL;
+  const pdf_uchar_t *view;
+  pdf_size_t view_size;
+  pdf_size_t capacity;
+
+  job->data = NULL;
+  job->data_size = 0;
+  job->error = NULL;
+
+  if (job->size == 0)
+    return;
+
+  if (job->file)
+    {
+      pdf_size_t read_bytes;
+
+      /* Only positional reads can be done concurrently over the file */
+      if (!pdf_fsys_file_can_pread_p (job->file))
+        {
+          pdf_set_error (&job->error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_EINVOP,
+                         "cannot decode stream: "
+                         "the filesystem doesn't support positional reads");
+          return;
+        }
+
+      raw = pdf_alloc (job->size);
+      if (!raw)
+        {
+          pdf_set_error (&job->error,
+                         PDF_EDOMAIN_BASE_STM,
+                         PDF_ENOMEM,
+                         "cannot decode stream: "
+                         "couldn't allocate %lu bytes",
+                         (unsigned long) job->size);
+          return;
+        }
+
+      if (!pdf_fsys_file_pread (job->file,
+                                (pdf_char_t *)raw,
+                                job->size,
+                                job->offset,
+                                &read_bytes,
+                                &job->error))
+        {
+          if (!job->error)
+            pdf_set_error (&job->error,
+                           PDF_EDOMAIN_BASE_STM,
+                           PDF_EBADDATA,
+                           "cannot decode stream: "
+                           "unexpected end of file after %lu bytes",
+                           (unsigned long) read_bytes);
+          pdf_dealloc (raw);
+          return;
+        }
+    }
+
+  stm = pdf_stm_mem_new (raw ? raw : (pdf_uchar_t *)job->buffer,
+                         job->size,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &job->error);
+  if (!stm)
+    goto out;
+
+  /* The encoded size bounds the buffers needed */
+  pdf_stm_set_cache_policy (stm, PDF_STM_CACHE_ADAPTIVE, job->size);
+
+  if (job->chain &&
+      !pdf_stm_install_filter_chain (stm, job->chain, &job->error))
+    goto out;
+
+  /* Collect the decoded data */
+  capacity = 0;
+  while (pdf_stm_read_view (stm, &view, &view_size, &job->error))
+    {
+      if (job->data_size + view_size > capacity)
+        {
+          pdf_uchar_t *data;
+
+          capacity = PDF_MAX (2 * capacity, job->data_size + view_size);
+          data = pdf_realloc (job->data, capacity);
+          if (!data)
+            {
+              pdf_set_error (&job->error,
+                             PDF_EDOMAIN_BASE_STM,
+                             PDF_ENOMEM,
+                             "cannot decode stream: "
+                             "couldn't allocate %lu bytes",
+                             (unsigned long) capacity);
+              break;
+            }
+          job->data = data;
+        }
+
+      memcpy (job->data + job->data_size, view, view_size);
+      job->data_size += view_size;
+      pdf_stm_consume (stm, view_size, NULL);
+    }
+
+ out:
+  if (job->error)
+    {
+      pdf_dealloc (job->data);
+      job->data = NULL;
+      job->data_size = 0;
+    }
+  if (stm)
+    pdf_stm_destroy (stm);
+  if (raw)
+    pdf_dealloc (raw);
+}
+
 /* End of pdf_stm.c */
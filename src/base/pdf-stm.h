@@ -54,6 +54,7 @@
 #include <pdf-types-buffer.h>
 #include <pdf-hash.h>
 #include <pdf-fsys.h>
+#include <pdf-crypt.h>
 #include <pdf-stm-filter.h>
 #include <pdf-stm-be.h>
 
@@ -64,6 +65,46 @@
 /* Default size for the stream caches */
 #define PDF_STM_DEFAULT_CACHE_SIZE 4096
 
+/* Largest size the stream caches are grown to in adaptive mode */
+#define PDF_STM_MAX_CACHE_SIZE (1024 * 1024)
+
+/* Default memory shared by the grown buffers of all the streams */
+#define PDF_STM_DEFAULT_CACHE_BUDGET (64 * 1024 * 1024)
+
+/* Policies to size the stream caches */
+enum pdf_stm_cache_policy_e
+{
+  /* Keep the cache size given when creating the stream */
+  PDF_STM_CACHE_FIXED = 0,
+  /* Grow the cache and the filter buffers while data flows steadily
+   * through the stream */
+  PDF_STM_CACHE_ADAPTIVE
+};
+
+/* Cache sizing statistics of a stream */
+struct pdf_stm_cache_stats_s
+{
+  enum pdf_stm_cache_policy_e policy;
+  pdf_size_t initial_size;  /* Cache size when the stream was created */
+  pdf_size_t size;          /* Current cache size */
+  pdf_size_t max_size;      /* Limit of the growth of the cache */
+  pdf_size_t buffers_size;  /* Total size of the cache and filter buffers */
+  pdf_size_t n_runs;        /* Times the filter chain was run */
+  pdf_size_t n_resizes;     /* Times the buffers were grown */
+};
+
+/* Performance counters of a stream */
+struct pdf_stm_stats_s
+{
+  pdf_size_t n_be_reads;       /* Reads from the backend */
+  pdf_size_t be_read_bytes;
+  pdf_size_t n_be_writes;      /* Writes into the backend */
+  pdf_size_t be_written_bytes;
+  pdf_u64_t be_usecs;          /* Time spent in the backend */
+  pdf_size_t n_filters;        /* Filters in the chain, the NULL filter
+                                * of the stream included */
+};
+
 /* Mode to use when opening a stream */
 enum pdf_stm_mode_e
 {
@@ -93,6 +134,13 @@ pdf_stm_t *pdf_stm_file_new (pdf_fsys_file_t      *file,
                              enum pdf_stm_mode_e   mode,
                              pdf_error_t         **error);
 
+/* Create a new read-only stream over a memory-mapped file object */
+pdf_stm_t *pdf_stm_mmap_new (pdf_fsys_file_t              *file,
+                             pdf_off_t                     offset,
+                             pdf_size_t                    cache_size,
+                             enum pdf_fsys_file_access_e   access,
+                             pdf_error_t                 **error);
+
 /* Create a new memory stream */
 pdf_stm_t *pdf_stm_mem_new (pdf_uchar_t          *buffer,
                             pdf_size_t            size,
@@ -103,10 +151,42 @@ pdf_stm_t *pdf_stm_mem_new (pdf_uchar_t          *buffer,
 /* Destroy the stream */
 void pdf_stm_destroy (pdf_stm_t *stm);
 
+/* Bring the stream and its filter chain back to their initial state,
+ * reading or writing at POS in the backend */
+pdf_bool_t pdf_stm_reset (pdf_stm_t    *stm,
+                          pdf_off_t     pos,
+                          pdf_error_t **error);
+
+/* Reset a memory stream to work on SIZE octets at BUFFER */
+pdf_bool_t pdf_stm_mem_reset (pdf_stm_t    *stm,
+                              pdf_uchar_t  *buffer,
+                              pdf_size_t    size,
+                              pdf_error_t **error);
+
+/* Reset a file stream to work on LENGTH octets from OFFSET in its
+ * file, or on the rest of the file if LENGTH is 0 */
+pdf_bool_t pdf_stm_file_reset (pdf_stm_t    *stm,
+                               pdf_off_t     offset,
+                               pdf_size_t    length,
+                               pdf_error_t **error);
+
 /* ------------------- Getting and Setting Stream properties ---------------- */
 
 enum pdf_stm_mode_e pdf_stm_get_mode (pdf_stm_t *stm);
 
+/* Set how the cache of the stream is sized. EXPECTED_SIZE is the
+ * declared length of the stream data, or 0 if unknown. */
+void pdf_stm_set_cache_policy (pdf_stm_t                   *stm,
+                               enum pdf_stm_cache_policy_e  policy,
+                               pdf_size_t                   expected_size);
+
+/* Memory available to grow the buffers of adaptive streams, shared by
+ * all of them */
+void pdf_stm_set_cache_budget (pdf_size_t budget);
+
+void pdf_stm_get_cache_budget (pdf_size_t *budget,
+                               pdf_size_t *used);
+
 /* ------------------- Reading and Writing data in the Streams -------------- */
 
 pdf_bool_t pdf_stm_read (pdf_stm_t     *stm,
@@ -134,6 +214,19 @@ pdf_bool_t pdf_stm_peek_char (pdf_stm_t    *stm,
                               pdf_uchar_t  *read_char,
                               pdf_error_t **error);
 
+/* Zero-copy reading: get a view of the filtered data available in the
+ * stream cache. The returned pointer is owned by the stream and is only
+ * valid until the next operation on it. */
+pdf_bool_t pdf_stm_read_view (pdf_stm_t          *stm,
+                              const pdf_uchar_t **data,
+                              pdf_size_t         *data_size,
+                              pdf_error_t       **error);
+
+/* Mark as read the first BYTES octets of the last view */
+pdf_bool_t pdf_stm_consume (pdf_stm_t    *stm,
+                            pdf_size_t    bytes,
+                            pdf_error_t **error);
+
 /* ------------------- Stream positionining -------------------------------- */
 
 pdf_off_t pdf_stm_bseek (pdf_stm_t *stm,
@@ -144,8 +237,65 @@ pdf_off_t pdf_stm_btell (pdf_stm_t *stm);
 pdf_off_t pdf_stm_tell (pdf_stm_t *stm);
 
 
+/* ------------------- Stream statistics ----------------------------------- */
+
+/* Number of octets copied and handed over without copying between the
+ * buffers of the stream layer */
+void pdf_stm_get_copy_counters (pdf_stm_t  *stm,
+                                pdf_size_t *copied_bytes,
+                                pdf_size_t *forwarded_bytes);
+
+/* Copy the digest computed with ALGORITHM by the first digest filter of
+ * the stream computing it. Only available once the filter reached the
+ * end of the data. */
+pdf_bool_t pdf_stm_get_digest (pdf_stm_t                 *stm,
+                               enum pdf_crypt_md_algo_e   algorithm,
+                               pdf_char_t                *digest,
+                               pdf_size_t                 size,
+                               pdf_size_t                *digest_size,
+                               pdf_error_t              **error);
+
+/* Sizes chosen for the buffers of the stream */
+void pdf_stm_get_cache_stats (pdf_stm_t                    *stm,
+                              struct pdf_stm_cache_stats_s *stats);
+
+/* Start or stop collecting performance counters in the stream and its
+ * filters. Enabling them resets them. */
+void pdf_stm_enable_stats (pdf_stm_t  *stm,
+                           pdf_bool_t  enable);
+
+/* Get the performance counters of the stream, and of up to
+ * N_FILTER_STATS filters, starting from the last installed one */
+pdf_bool_t pdf_stm_get_stats (pdf_stm_t                     *stm,
+                              struct pdf_stm_stats_s        *stats,
+                              struct pdf_stm_filter_stats_s *filter_stats,
+                              pdf_size_t                     n_filter_stats,
+                              pdf_error_t                  **error);
+
 /* ------------------- Management of the Stream filter chain --------------- */
 
+/* A filter to install, with its parameters.  A filter chain created
+ * from it keeps the PARAMS pointer, so the table must outlive the
+ * chain and not be modified while the chain exists */
+struct pdf_stm_filter_spec_s
+{
+  enum pdf_stm_filter_type_e type;
+  const pdf_hash_t *params;
+};
+
+/* Validated list of filters, which can be installed in many streams */
+typedef struct pdf_stm_filter_chain_s pdf_stm_filter_chain_t;
+
+pdf_stm_filter_chain_t *pdf_stm_filter_chain_new (const struct pdf_stm_filter_spec_s  *filters,
+                                                  pdf_size_t                           n_filters,
+                                                  pdf_error_t                        **error);
+
+void pdf_stm_filter_chain_destroy (pdf_stm_filter_chain_t *chain);
+
+pdf_bool_t pdf_stm_install_filter_chain (pdf_stm_t                     *stm,
+                                         const pdf_stm_filter_chain_t  *chain,
+                                         pdf_error_t                  **error);
+
 pdf_bool_t pdf_stm_install_filter     (pdf_stm_t                   *stm,
                                        enum pdf_stm_filter_type_e   filter_type,
                                        const pdf_hash_t            *filter_params,
@@ -153,6 +303,33 @@ pdf_bool_t pdf_stm_install_filter     (pdf_stm_t                   *stm,
 
 pdf_bool_t pdf_stm_supported_filter_p (enum pdf_stm_filter_type_e   filter_type);
 
+/* ------------------- Parallel decoding ---------------------------------- */
+
+/* A stream to decode with pdf_stm_decode_batch */
+struct pdf_stm_decode_job_s
+{
+  /* Encoded data: SIZE octets at OFFSET in FILE, or in BUFFER if FILE
+   * is NULL */
+  pdf_fsys_file_t *file;
+  pdf_off_t offset;
+  const pdf_uchar_t *buffer;
+  pdf_size_t size;
+
+  /* Filters to install, or NULL */
+  const pdf_stm_filter_chain_t *chain;
+
+  /* Results: the decoded data, to be freed with pdf_dealloc, or the
+   * error which prevented decoding it */
+  pdf_uchar_t *data;
+  pdf_size_t data_size;
+  pdf_error_t *error;
+};
+
+/* Decode a batch of streams concurrently in the library job pool */
+pdf_bool_t pdf_stm_decode_batch (struct pdf_stm_decode_job_s  *jobs,
+                                 pdf_size_t                    n_jobs,
+                                 pdf_error_t                 **error);
+
 /* END PUBLIC */
 
 /* Types of streams. Not needed in the public API. */
@@ -177,6 +354,22 @@ struct pdf_stm_s
                                   * current sequential
                                   * operation. i.e. since the last bseek or
                                   * the creation of the stream */
+  pdf_size_t        copied_bytes; /* Number of octects copied from/to the
+                                   * user buffers */
+
+  /* Cache sizing */
+  enum pdf_stm_cache_policy_e cache_policy;
+  pdf_size_t        cache_initial_size;
+  pdf_size_t        cache_max_size;
+  pdf_size_t        cache_reserved;    /* Octets taken from the budget */
+  pdf_size_t        cache_full_streak; /* Consecutive runs of the filter
+                                        * chain which used up the cache */
+  pdf_size_t        n_runs;
+  pdf_size_t        n_resizes;
+
+  /* Performance counters */
+  pdf_bool_t        stats_enabled;
+  struct pdf_stm_be_stats_s be_stats;
 };
 
 #endif /* pdf_stm.h */
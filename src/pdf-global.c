@@ -34,6 +34,7 @@
 #include <pdf-time.h>
 #include <pdf-fsys.h>
 #include <pdf-tokeniser.h>
+#include <pdf-jobs.h>
 
 /* Global variables */
 
@@ -86,7 +87,8 @@ pdf_init (pdf_error_t **error)
           !pdf_text_init (&inner_error) ||
           !pdf_time_module_init (&inner_error) ||
           !pdf_fsys_init (&inner_error) ||
-          !pdf_tokeniser_init (&inner_error))
+          !pdf_tokeniser_init (&inner_error) ||
+          !pdf_jobs_init (&inner_error))
         {
           pdf_propagate_error (error, inner_error);
           pdf_prefix_error (error,
@@ -109,9 +111,11 @@ pdf_init (pdf_error_t **error)
 void
 pdf_finish (void)
 {
+  pdf_jobs_deinit ();
   pdf_tokeniser_deinit ();
   pdf_fsys_deinit ();
   pdf_text_deinit ();
+  pdf_crypt_finish ();
 }
 
 /* End of pdf-global.c */
@@ -0,0 +1,662 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-bench.c
+ *       Date:         Sat Oct 17 18:52:40 2026
+ *
+ *       GNU PDF Library - Throughput benchmarks for the stream filters
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Every encoder of the table below is run over every input, and its
+ * output is then decoded back, for each of the requested cache sizes.
+ * Decoded data is checked against the original input, so that the
+ * benchmark also catches broken hot paths.
+ *
+ * Results are printed to the standard output in CSV format, one line
+ * per run.  Throughputs are computed over the size of the original
+ * (unencoded) input, so that the figures of an encoder and its decoder
+ * can be compared. */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <getopt.h>
+#include <sys/time.h>
+
+#include <pdf.h>
+
+/*
+ * Default settings
+ */
+
+#define BENCH_DEFAULT_INPUT_SIZE   (1024 * 1024)
+#define BENCH_DEFAULT_MIN_TIME     200 /* Milliseconds per run */
+#define BENCH_MAX_CACHE_SIZES      16
+#define BENCH_MAX_INPUTS           16
+
+static const pdf_size_t bench_default_cache_sizes[] = { 512, 4096, 65536 };
+
+/* Geometry of the generated image samples */
+#define BENCH_IMAGE_COLUMNS        512
+#define BENCH_IMAGE_COLORS         3
+#define BENCH_IMAGE_ROW_SIZE       (BENCH_IMAGE_COLUMNS * BENCH_IMAGE_COLORS)
+
+/*
+ * Inputs
+ */
+
+struct bench_input_s
+{
+  const pdf_char_t *name;
+  pdf_uchar_t *data;
+  pdf_size_t size;
+  pdf_bool_t image_p;     /* Samples with the geometry defined above */
+};
+
+/* Deterministic pseudo-random numbers, so that runs are comparable */
+static pdf_u32_t bench_seed = 12345;
+
+static pdf_u32_t
+bench_random (void)
+{
+  bench_seed = bench_seed * 1103515245 + 12345;
+  return (bench_seed >> 16) & 0x7fff;
+}
+
+/* Content stream made of text showing and path construction
+ * operators */
+static void
+generate_text (pdf_uchar_t *data,
+               pdf_size_t   size)
+{
+  static const pdf_char_t *words[] = {
+    "the", "portable", "document", "format", "library", "stream",
+    "filter", "of", "a", "page", "object", "content", "and", "to",
+    "font", "GNU", "is", "with", "text", "in"
+  };
+  pdf_char_t line[256];
+  pdf_size_t pos = 0;
+  pdf_size_t len;
+  int i, n;
+
+  while (pos < size)
+    {
+      switch (bench_random () % 4)
+        {
+        case 0:
+          {
+            len = sprintf (line, "%d %d %d %d re f\n",
+                           bench_random () % 612, bench_random () % 792,
+                           bench_random () % 100, bench_random () % 100);
+            break;
+          }
+        case 1:
+          {
+            len = sprintf (line, "%d %d m %d %d l S\n",
+                           bench_random () % 612, bench_random () % 792,
+                           bench_random () % 612, bench_random () % 792);
+            break;
+          }
+        default:
+          {
+            len = sprintf (line, "BT\n/F%d 12 Tf\n72 %d Td\n(",
+                           bench_random () % 4, bench_random () % 792);
+            n = 4 + bench_random () % 8;
+            for (i = 0; i < n; i++)
+              len += sprintf (line + len, "%s%s",
+                              (i > 0 ? " " : ""),
+                              words[bench_random () % (sizeof (words) /
+                                                       sizeof (words[0]))]);
+            len += sprintf (line + len, ") Tj\nET\n");
+            break;
+          }
+        }
+
+      if (len > size - pos)
+        len = size - pos;
+      memcpy (data + pos, line, len);
+      pos += len;
+    }
+}
+
+/* RGB samples of smooth gradients with some noise */
+static void
+generate_image (pdf_uchar_t *data,
+                pdf_size_t   size)
+{
+  pdf_size_t pos;
+  pdf_size_t x, y;
+
+  for (pos = 0; pos < size; pos++)
+    {
+      x = (pos % BENCH_IMAGE_ROW_SIZE) / BENCH_IMAGE_COLORS;
+      y = pos / BENCH_IMAGE_ROW_SIZE;
+      switch (pos % BENCH_IMAGE_COLORS)
+        {
+        case 0:
+          data[pos] = (x / 2 + bench_random () % 4) & 0xff;
+          break;
+        case 1:
+          data[pos] = (y + bench_random () % 4) & 0xff;
+          break;
+        default:
+          data[pos] = ((x + y) / 4) & 0xff;
+          break;
+        }
+    }
+}
+
+/* High entropy data, shaped like already compressed contents */
+static void
+generate_compressed (pdf_uchar_t *data,
+                     pdf_size_t   size)
+{
+  pdf_size_t pos;
+
+  for (pos = 0; pos < size; pos++)
+    data[pos] = (bench_random () >> 3) & 0xff;
+}
+
+static pdf_uchar_t *
+bench_alloc (pdf_size_t size)
+{
+  pdf_uchar_t *data;
+
+  data = pdf_alloc (size > 0 ? size : 1);
+  if (!data)
+    {
+      fprintf (stderr, "pdf-stm-bench: couldn't allocate %lu bytes\n",
+               (unsigned long) size);
+      exit (EXIT_FAILURE);
+    }
+  return data;
+}
+
+static void
+load_file (struct bench_input_s *input,
+           const pdf_char_t     *path)
+{
+  FILE *file;
+  long size;
+
+  file = fopen (path, "rb");
+  if (!file
+      || fseek (file, 0, SEEK_END) != 0
+      || (size = ftell (file)) < 0
+      || fseek (file, 0, SEEK_SET) != 0)
+    {
+      fprintf (stderr, "pdf-stm-bench: couldn't open '%s'\n", path);
+      exit (EXIT_FAILURE);
+    }
+
+  input->name = strrchr (path, '/') ? strrchr (path, '/') + 1 : path;
+  input->size = size;
+  input->data = bench_alloc (input->size);
+  input->image_p = PDF_FALSE;
+  if (fread (input->data, 1, input->size, file) != input->size)
+    {
+      fprintf (stderr, "pdf-stm-bench: couldn't read '%s'\n", path);
+      exit (EXIT_FAILURE);
+    }
+  fclose (file);
+}
+
+/*
+ * Filters
+ */
+
+typedef pdf_bool_t (*bench_params_fn_t) (pdf_hash_t   *params,
+                                         pdf_error_t **error);
+
+struct bench_codec_s
+{
+  const pdf_char_t *name;
+  enum pdf_stm_filter_type_e enc_type;
+  enum pdf_stm_filter_type_e dec_type;  /* UNKNOWN for hashes */
+  bench_params_fn_t params_fn;          /* NULL if no parameters */
+  pdf_bool_t image_only_p;
+};
+
+static pdf_bool_t
+pred_params (pdf_hash_t   *params,
+             pdf_error_t **error)
+{
+  /* PNG Up prediction, as used with most Flate compressed images */
+  return (pdf_hash_add_size (params, "Predictor", 12, error)
+          && pdf_hash_add_size (params, "Colors", BENCH_IMAGE_COLORS, error)
+          && pdf_hash_add_size (params, "BitsPerComponent", 8, error)
+          && pdf_hash_add_size (params, "Columns", BENCH_IMAGE_COLUMNS, error));
+}
+
+static pdf_bool_t
+key_params (pdf_hash_t   *params,
+            pdf_error_t **error)
+{
+  static const pdf_char_t key[] = "0123456789abcdef";
+
+  return (pdf_hash_add_static_string (params, "Key", key, error)
+          && pdf_hash_add_size (params, "KeySize", sizeof (key) - 1, error));
+}
+
+#ifdef PDF_HAVE_LIBZ
+static pdf_bool_t
+flate_threads_params (pdf_hash_t   *params,
+                      pdf_error_t **error)
+{
+  /* One block per thread of the job pool */
+  return pdf_hash_add_size (params, "Threads", 0, error);
+}
+#endif /* PDF_HAVE_LIBZ */
+
+static const struct bench_codec_s bench_codecs[] = {
+  { "null", PDF_STM_FILTER_NULL, PDF_STM_FILTER_NULL, NULL, PDF_FALSE },
+  { "ahex", PDF_STM_FILTER_AHEX_ENC, PDF_STM_FILTER_AHEX_DEC, NULL, PDF_FALSE },
+  { "a85", PDF_STM_FILTER_A85_ENC, PDF_STM_FILTER_A85_DEC, NULL, PDF_FALSE },
+  { "lzw", PDF_STM_FILTER_LZW_ENC, PDF_STM_FILTER_LZW_DEC, NULL, PDF_FALSE },
+#ifdef PDF_HAVE_LIBZ
+  { "flate", PDF_STM_FILTER_FLATE_ENC, PDF_STM_FILTER_FLATE_DEC, NULL, PDF_FALSE },
+  { "flatemt", PDF_STM_FILTER_FLATE_ENC, PDF_STM_FILTER_FLATE_DEC, flate_threads_params, PDF_FALSE },
+#endif /* PDF_HAVE_LIBZ */
+  { "rl", PDF_STM_FILTER_RL_ENC, PDF_STM_FILTER_RL_DEC, NULL, PDF_FALSE },
+  { "pred", PDF_STM_FILTER_PRED_ENC, PDF_STM_FILTER_PRED_DEC, pred_params, PDF_TRUE },
+  { "aesv2", PDF_STM_FILTER_AESV2_ENC, PDF_STM_FILTER_AESV2_DEC, key_params, PDF_FALSE },
+  { "v2", PDF_STM_FILTER_V2_ENC, PDF_STM_FILTER_V2_DEC, key_params, PDF_FALSE },
+  { "md5", PDF_STM_FILTER_MD5_ENC, PDF_STM_FILTER_UNKNOWN, NULL, PDF_FALSE }
+};
+
+#define BENCH_N_CODECS (sizeof (bench_codecs) / sizeof (bench_codecs[0]))
+
+/*
+ * Running the filters
+ */
+
+static pdf_u64_t
+bench_clock (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return (pdf_u64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void
+bench_fail (const pdf_char_t *what,
+            pdf_error_t      *error)
+{
+  pdf_error (pdf_error_get_status (error),
+             stderr,
+             "%s: '%s'",
+             what,
+             pdf_error_get_message (error));
+  exit (EXIT_FAILURE);
+}
+
+/* Read the whole contents of IN through a filter of the given type.
+ * OUT is grown as needed. */
+static void
+run_filter (const struct bench_codec_s  *codec,
+            enum pdf_stm_filter_type_e   type,
+            const pdf_uchar_t           *in,
+            pdf_size_t                   in_size,
+            pdf_size_t                   cache_size,
+            pdf_uchar_t                **out,
+            pdf_size_t                  *out_alloc,
+            pdf_size_t                  *out_size)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params = NULL;
+  pdf_stm_t *stm;
+  pdf_size_t read_bytes;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) in,
+                         in_size,
+                         cache_size,
+                         PDF_STM_READ,
+                         &error);
+  if (!stm)
+    bench_fail ("couldn't create memory stream", error);
+
+  if (codec->params_fn)
+    {
+      params = pdf_hash_new (&error);
+      if (!params || !codec->params_fn (params, &error))
+        bench_fail ("couldn't create filter parameters", error);
+    }
+
+  if (!pdf_stm_install_filter (stm, type, params, &error))
+    bench_fail ("couldn't install filter", error);
+
+  *out_size = 0;
+  for (;;)
+    {
+      if (*out_size == *out_alloc)
+        {
+          *out_alloc *= 2;
+          *out = pdf_realloc (*out, *out_alloc);
+          if (!*out)
+            {
+              fprintf (stderr, "pdf-stm-bench: couldn't allocate %lu bytes\n",
+                       (unsigned long) *out_alloc);
+              exit (EXIT_FAILURE);
+            }
+        }
+
+      read_bytes = 0;
+      if (!pdf_stm_read (stm,
+                         *out + *out_size,
+                         *out_alloc - *out_size,
+                         &read_bytes,
+                         &error))
+        {
+          if (error)
+            bench_fail ("couldn't read from filter", error);
+          *out_size += read_bytes;
+          break;
+        }
+      *out_size += read_bytes;
+    }
+
+  pdf_stm_destroy (stm);
+  if (params)
+    pdf_hash_destroy (params);
+}
+
+/* Run a filter repeatedly for at least MIN_TIME milliseconds, and
+ * report the mean time per run */
+static void
+bench_filter (const struct bench_codec_s  *codec,
+              pdf_bool_t                   encode_p,
+              const struct bench_input_s  *input,
+              const pdf_uchar_t           *in,
+              pdf_size_t                   in_size,
+              pdf_size_t                   cache_size,
+              pdf_size_t                   min_time,
+              pdf_uchar_t                **out,
+              pdf_size_t                  *out_alloc,
+              pdf_size_t                  *out_size)
+{
+  pdf_u64_t start, elapsed, per_run;
+  pdf_size_t iterations = 0;
+
+  start = bench_clock ();
+  do
+    {
+      run_filter (codec,
+                  (encode_p ? codec->enc_type : codec->dec_type),
+                  in, in_size, cache_size,
+                  out, out_alloc, out_size);
+      iterations++;
+      elapsed = bench_clock () - start;
+    }
+  while (elapsed < (pdf_u64_t) min_time * 1000);
+
+  per_run = elapsed / iterations;
+  printf ("%s%s,%s,%lu,%lu,%lu,%lu,%lu,%.2f\n",
+          codec->name,
+          (encode_p ? "enc" : "dec"),
+          input->name,
+          (unsigned long) cache_size,
+          (unsigned long) in_size,
+          (unsigned long) *out_size,
+          (unsigned long) iterations,
+          (unsigned long) per_run,
+          (per_run > 0 ? (double) input->size / per_run : 0.0));
+  fflush (stdout);
+}
+
+static void
+bench_codec (const struct bench_codec_s *codec,
+             const struct bench_input_s *input,
+             pdf_size_t                  cache_size,
+             pdf_size_t                  min_time)
+{
+  pdf_uchar_t *encoded, *decoded;
+  pdf_size_t encoded_alloc, encoded_size;
+  pdf_size_t decoded_alloc, decoded_size;
+
+  encoded_alloc = input->size + 1024;
+  encoded = bench_alloc (encoded_alloc);
+  bench_filter (codec, PDF_TRUE, input, input->data, input->size,
+                cache_size, min_time,
+                &encoded, &encoded_alloc, &encoded_size);
+
+  if (codec->dec_type != PDF_STM_FILTER_UNKNOWN)
+    {
+      decoded_alloc = input->size + 1024;
+      decoded = bench_alloc (decoded_alloc);
+      bench_filter (codec, PDF_FALSE, input, encoded, encoded_size,
+                    cache_size, min_time,
+                    &decoded, &decoded_alloc, &decoded_size);
+
+      if (decoded_size != input->size
+          || memcmp (decoded, input->data, input->size) != 0)
+        {
+          fprintf (stderr,
+                   "pdf-stm-bench: %s: decoded data doesn't match input '%s'\n",
+                   codec->name, input->name);
+          exit (EXIT_FAILURE);
+        }
+      pdf_dealloc (decoded);
+    }
+
+  pdf_dealloc (encoded);
+}
+
+/*
+ * Command line options management
+ */
+
+enum
+{
+  HELP_ARG,
+  SIZE_ARG,
+  CACHE_SIZES_ARG,
+  MIN_TIME_ARG,
+  FILTER_ARG,
+  INPUT_ARG
+};
+
+static const struct option GNU_longOptions[] =
+  {
+    {"help", no_argument, NULL, HELP_ARG},
+    {"size", required_argument, NULL, SIZE_ARG},
+    {"cache-sizes", required_argument, NULL, CACHE_SIZES_ARG},
+    {"min-time", required_argument, NULL, MIN_TIME_ARG},
+    {"filter", required_argument, NULL, FILTER_ARG},
+    {"input", required_argument, NULL, INPUT_ARG},
+    {NULL, 0, NULL, 0}
+  };
+
+static const pdf_char_t *usage_msg =
+  "Usage: pdf-stm-bench [OPTIONS]\n"
+  "Measure the throughput of the stream filters, printing the results\n"
+  "in CSV format.\n"
+  "\n"
+  "  --help                 print a help message and exit\n"
+  "  --size=BYTES           size of the generated inputs (default 1 MiB)\n"
+  "  --cache-sizes=LIST     comma separated list of stream cache sizes\n"
+  "                         (default 512,4096,65536)\n"
+  "  --min-time=MSECS       minimum time spent in every run (default 200)\n"
+  "  --filter=NAME          only run the given filter; can be repeated\n"
+  "  --input=FILE           also run the filters over the contents of FILE;\n"
+  "                         can be repeated\n"
+  "\n"
+  "Filters: null, ahex, a85, lzw, flate, flatemt, rl, pred, aesv2, v2, md5\n"
+  "\n"
+  "Report bugs to <" PACKAGE_BUGREPORT ">.\n";
+
+static pdf_size_t
+parse_size (const pdf_char_t *arg)
+{
+  char *end;
+  unsigned long value;
+
+  value = strtoul (arg, &end, 10);
+  if (end == arg || *end != '\0')
+    {
+      fprintf (stderr, "pdf-stm-bench: invalid number '%s'\n", arg);
+      exit (EXIT_FAILURE);
+    }
+  return value;
+}
+
+static pdf_bool_t
+codec_selected_p (const struct bench_codec_s  *codec,
+                  const pdf_char_t           **filters,
+                  int                          n_filters)
+{
+  int i;
+
+  if (n_filters == 0)
+    return PDF_TRUE;
+
+  for (i = 0; i < n_filters; i++)
+    if (strcmp (filters[i], codec->name) == 0)
+      return PDF_TRUE;
+  return PDF_FALSE;
+}
+
+int
+main (int argc, char *argv[])
+{
+  pdf_error_t *error = NULL;
+  struct bench_input_s inputs[BENCH_MAX_INPUTS];
+  pdf_size_t cache_sizes[BENCH_MAX_CACHE_SIZES];
+  const pdf_char_t *filters[BENCH_N_CODECS];
+  const pdf_char_t *files[BENCH_MAX_INPUTS];
+  pdf_size_t n_cache_sizes = 0;
+  int n_inputs = 0, n_files = 0, n_filters = 0;
+  pdf_size_t size = BENCH_DEFAULT_INPUT_SIZE;
+  pdf_size_t min_time = BENCH_DEFAULT_MIN_TIME;
+  pdf_size_t i, j;
+  char *list, *token;
+  int c, k;
+
+  while ((c = getopt_long (argc, argv, "", GNU_longOptions, NULL)) != -1)
+    {
+      switch (c)
+        {
+        case HELP_ARG:
+          {
+            fprintf (stdout, "%s", usage_msg);
+            exit (EXIT_SUCCESS);
+          }
+        case SIZE_ARG:
+          {
+            size = parse_size (optarg);
+            break;
+          }
+        case CACHE_SIZES_ARG:
+          {
+            list = strdup (optarg);
+            n_cache_sizes = 0;
+            for (token = strtok (list, ",");
+                 token && n_cache_sizes < BENCH_MAX_CACHE_SIZES;
+                 token = strtok (NULL, ","))
+              cache_sizes[n_cache_sizes++] = parse_size (token);
+            free (list);
+            break;
+          }
+        case MIN_TIME_ARG:
+          {
+            min_time = parse_size (optarg);
+            break;
+          }
+        case FILTER_ARG:
+          {
+            if (n_filters < BENCH_N_CODECS)
+              filters[n_filters++] = optarg;
+            break;
+          }
+        case INPUT_ARG:
+          {
+            if (n_files < BENCH_MAX_INPUTS - 3)
+              files[n_files++] = optarg;
+            break;
+          }
+        default:
+          {
+            fprintf (stderr, "%s", usage_msg);
+            exit (EXIT_FAILURE);
+          }
+        }
+    }
+
+  if (n_cache_sizes == 0)
+    {
+      for (i = 0; i < sizeof (bench_default_cache_sizes) / sizeof (pdf_size_t); i++)
+        cache_sizes[n_cache_sizes++] = bench_default_cache_sizes[i];
+    }
+
+  if (!pdf_init (&error))
+    bench_fail ("couldn't initialize the PDF library", error);
+
+  /* Generate the synthetic inputs */
+  inputs[n_inputs].name = "text";
+  inputs[n_inputs].size = size;
+  inputs[n_inputs].data = bench_alloc (size);
+  inputs[n_inputs].image_p = PDF_FALSE;
+  generate_text (inputs[n_inputs].data, size);
+  n_inputs++;
+
+  inputs[n_inputs].name = "image";
+  inputs[n_inputs].size = size - (size % BENCH_IMAGE_ROW_SIZE);
+  inputs[n_inputs].data = bench_alloc (inputs[n_inputs].size);
+  inputs[n_inputs].image_p = PDF_TRUE;
+  generate_image (inputs[n_inputs].data, inputs[n_inputs].size);
+  n_inputs++;
+
+  inputs[n_inputs].name = "compressed";
+  inputs[n_inputs].size = size;
+  inputs[n_inputs].data = bench_alloc (size);
+  inputs[n_inputs].image_p = PDF_FALSE;
+  generate_compressed (inputs[n_inputs].data, size);
+  n_inputs++;
+
+  for (k = 0; k < n_files; k++)
+    load_file (&inputs[n_inputs++], files[k]);
+
+  printf ("filter,input,cache_size,in_bytes,out_bytes,"
+          "iterations,usecs,mbytes_per_sec\n");
+
+  for (i = 0; i < BENCH_N_CODECS; i++)
+    {
+      if (!codec_selected_p (&bench_codecs[i], filters, n_filters))
+        continue;
+
+      for (k = 0; k < n_inputs; k++)
+        {
+          if (bench_codecs[i].image_only_p && !inputs[k].image_p)
+            continue;
+
+          for (j = 0; j < n_cache_sizes; j++)
+            bench_codec (&bench_codecs[i], &inputs[k],
+                         cache_sizes[j], min_time);
+        }
+    }
+
+  for (k = 0; k < n_inputs; k++)
+    pdf_dealloc (inputs[k].data);
+
+  return EXIT_SUCCESS;
+}
+
+/* End of pdf-stm-bench.c */
@@ -302,6 +302,82 @@ START_TEST (pdf_crypt_cipher_decrypt_004)
 }
 END_TEST
 
+/*
+ * Test: pdf_crypt_cipher_decrypt_005
+ * Description:
+ *   Decrypt a ciphered buffer (AESV3), from the CBC-AES256 example of
+ *   NIST SP 800-38A.
+ * Success condition:
+ *   The ouput data should be correct.
+ */
+START_TEST (pdf_crypt_cipher_decrypt_005)
+{
+  pdf_crypt_cipher_t *cipher;
+  pdf_error_t *error = NULL;
+  pdf_char_t out[32];
+
+  pdf_char_t key[32] =
+    {
+      0x60, 0x3d, 0xeb, 0x10,
+      0x15, 0xca, 0x71, 0xbe,
+      0x2b, 0x73, 0xae, 0xf0,
+      0x85, 0x7d, 0x77, 0x81,
+      0x1f, 0x35, 0x2c, 0x07,
+      0x3b, 0x61, 0x08, 0xd7,
+      0x2d, 0x98, 0x10, 0xa3,
+      0x09, 0x14, 0xdf, 0xf4
+    };
+
+  pdf_char_t plain[] =
+    {
+      0x00, 0x01, 0x02, 0x03,   /* iv vector */
+      0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x0a, 0x0b,
+      0x0c, 0x0d, 0x0e, 0x0f,
+
+      0x6b, 0xc1, 0xbe, 0xe2,   /* plain text */
+      0x2e, 0x40, 0x9f, 0x96,
+      0xe9, 0x3d, 0x7e, 0x11,
+      0x73, 0x93, 0x17, 0x2a
+    };
+
+  pdf_char_t ciphered[] =
+    {
+      0x00, 0x01, 0x02, 0x03,   /* iv vector */
+      0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x0a, 0x0b,
+      0x0c, 0x0d, 0x0e, 0x0f,
+
+      0xf5, 0x8c, 0x4c, 0x04,   /* ciphered */
+      0xd6, 0xe5, 0xf1, 0xba,
+      0x77, 0x9e, 0xab, 0xfb,
+      0x5f, 0x7b, 0xfb, 0xd6
+    };
+
+  cipher = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_AESV3, &error);
+  fail_unless (cipher != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_cipher_set_key (cipher,
+                                         key,
+                                         sizeof (key),
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_cipher_decrypt (cipher,
+                                         out,
+                                         sizeof (out),
+                                         ciphered,
+                                         sizeof (ciphered),
+                                         NULL,
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_if (memcmp (out, plain, sizeof (out)) != 0);
+
+  pdf_crypt_cipher_destroy (cipher);
+}
+END_TEST
+
 /*
  * Test case creation function
  */
@@ -314,6 +390,7 @@ test_pdf_crypt_cipher_decrypt (void)
   tcase_add_test (tc, pdf_crypt_cipher_decrypt_002);
   tcase_add_test (tc, pdf_crypt_cipher_decrypt_003);
   tcase_add_test (tc, pdf_crypt_cipher_decrypt_004);
+  tcase_add_test (tc, pdf_crypt_cipher_decrypt_005);
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
@@ -260,6 +260,93 @@ START_TEST (pdf_crypt_cipher_encrypt_003)
 }
 END_TEST
 
+/*
+ * Test: pdf_crypt_cipher_encrypt_004
+ * Description:
+ *   Encrypt a buffer incrementally, then again after resetting the
+ *   cipher and with another cipher with the same key (V2).
+ * Success condition:
+ *   Encrypted data should be correct each time.
+ */
+START_TEST (pdf_crypt_cipher_encrypt_004)
+{
+  pdf_crypt_cipher_t *cipher;
+  pdf_crypt_cipher_t *other;
+  pdf_char_t out[14];
+  pdf_char_t in[14] = "Attack at dawn"; /* not trailing '\0' */
+  pdf_char_t key[6] = "Secret"; /* not trailing '\0' */
+  pdf_error_t *error = NULL;
+
+  pdf_char_t ciphered[] =
+    {
+      0x45, 0xA0, 0x1F, 0x64, 0x5F, 0xC3, 0x5B,
+      0x38, 0x35, 0x52, 0x54, 0x4B, 0x9B, 0xF5
+    };
+
+  cipher = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_V2, &error);
+  fail_unless (cipher != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_cipher_set_key (cipher,
+                                         key,
+                                         sizeof (key),
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_cipher_encrypt (cipher,
+                                         out, 5,
+                                         in, 5,
+                                         NULL,
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_crypt_cipher_encrypt (cipher,
+                                         out + 5, sizeof (out) - 5,
+                                         in + 5, sizeof (in) - 5,
+                                         NULL,
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (memcmp (out, ciphered, sizeof (out)) == 0);
+
+  /* Back to the start of the keystream */
+  pdf_crypt_cipher_reset (cipher);
+  memset (out, 0, sizeof (out));
+  fail_unless (pdf_crypt_cipher_encrypt (cipher,
+                                         out, sizeof (out),
+                                         in, sizeof (in),
+                                         NULL,
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (memcmp (out, ciphered, sizeof (out)) == 0);
+
+  /* Same key set in another cipher, after a different one */
+  other = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_V2, &error);
+  fail_unless (other != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_cipher_set_key (other,
+                                         "GNUPDF", 6,
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_crypt_cipher_set_key (other,
+                                         key,
+                                         sizeof (key),
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  memset (out, 0, sizeof (out));
+  fail_unless (pdf_crypt_cipher_encrypt (other,
+                                         out, sizeof (out),
+                                         in, sizeof (in),
+                                         NULL,
+                                         &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (memcmp (out, ciphered, sizeof (out)) == 0);
+
+  pdf_crypt_cipher_destroy (other);
+  pdf_crypt_cipher_destroy (cipher);
+}
+END_TEST
+
 /*
  * Test case creation function
  */
@@ -271,6 +358,7 @@ test_pdf_crypt_cipher_encrypt (void)
   tcase_add_test (tc, pdf_crypt_cipher_encrypt_001);
   tcase_add_test (tc, pdf_crypt_cipher_encrypt_002);
   tcase_add_test (tc, pdf_crypt_cipher_encrypt_003);
+  tcase_add_test (tc, pdf_crypt_cipher_encrypt_004);
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
@@ -72,6 +72,26 @@ START_TEST (pdf_crypt_cipher_new_002)
 }
 END_TEST
 
+/*
+ * Test: pdf_crypt_cipher_new_003
+ * Description:
+ *   Create an AESV3 cipher.
+ * Success condition:
+ *   Returns PDF_OK
+ */
+START_TEST (pdf_crypt_cipher_new_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_cipher_t *cipher;
+
+  cipher = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_AESV3, &error);
+  fail_unless (cipher != NULL);
+  fail_if (error != NULL);
+
+  pdf_crypt_cipher_destroy (cipher);
+}
+END_TEST
+
 /*
  * Test case creation function
  */
@@ -82,6 +102,7 @@ test_pdf_crypt_cipher_new (void)
 
   tcase_add_test (tc, pdf_crypt_cipher_new_001);
   tcase_add_test (tc, pdf_crypt_cipher_new_002);
+  tcase_add_test (tc, pdf_crypt_cipher_new_003);
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
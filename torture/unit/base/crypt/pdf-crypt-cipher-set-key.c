@@ -110,6 +110,33 @@ START_TEST (pdf_crypt_cipher_set_key_003)
 }
 END_TEST
 
+/*
+ * Test: pdf_crypt_cipher_set_key_004
+ * Description:
+ *   Set a key of 4 bytes (V2)
+ * Success condition:
+ *   Fails with PDF_EBADV2KEY (shorter than 40 bits)
+ */
+START_TEST (pdf_crypt_cipher_set_key_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_cipher_t *cipher;
+
+  cipher = pdf_crypt_cipher_new (PDF_CRYPT_CIPHER_ALGO_V2, &error);
+  fail_unless (cipher != NULL);
+  fail_if (error != NULL);
+
+  fail_if (pdf_crypt_cipher_set_key (cipher,
+                                     "GNUP", 4,
+                                     &error) == PDF_TRUE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EBADV2KEY);
+
+  pdf_error_destroy (error);
+  pdf_crypt_cipher_destroy (cipher);
+}
+END_TEST
+
 /*
  * Test case creation function
  */
@@ -121,6 +148,7 @@ test_pdf_crypt_cipher_set_key (void)
   tcase_add_test (tc, pdf_crypt_cipher_set_key_001);
   tcase_add_test (tc, pdf_crypt_cipher_set_key_002);
   tcase_add_test (tc, pdf_crypt_cipher_set_key_003);
+  tcase_add_test (tc, pdf_crypt_cipher_set_key_004);
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
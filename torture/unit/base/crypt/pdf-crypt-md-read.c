@@ -169,6 +169,79 @@ START_TEST (pdf_crypt_md_read_004)
 }
 END_TEST
 
+/*
+ * Test: pdf_crypt_md_read_005
+ * Description:
+ *   Compute the SHA-1 digest of a string
+ * Success condition:
+ *   The output data should be correct.
+ */
+START_TEST (pdf_crypt_md_read_005)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t in[3] = "abc";
+  pdf_char_t out[PDF_CRYPT_MD_SHA1_SIZE];
+  pdf_crypt_md_t *md;
+  pdf_char_t real_out[] = {
+    0xA9, 0x99, 0x3E, 0x36,
+    0x47, 0x06, 0x81, 0x6A,
+    0xBA, 0x3E, 0x25, 0x71,
+    0x78, 0x50, 0xC2, 0x6C,
+    0x9C, 0xD0, 0xD8, 0x9D
+  };
+
+  md = pdf_crypt_md_new (PDF_CRYPT_MD_SHA1, &error);
+  fail_unless (md != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_md_write (md, in, sizeof (in), &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_crypt_md_read (md, out, sizeof(out), &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_if (memcmp (real_out, out, sizeof(out)));
+
+  pdf_crypt_md_destroy (md);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_md_read_006
+ * Description:
+ *   Compute the SHA-256 digest of a string
+ * Success condition:
+ *   The output data should be correct.
+ */
+START_TEST (pdf_crypt_md_read_006)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t in[3] = "abc";
+  pdf_char_t out[PDF_CRYPT_MD_SHA256_SIZE];
+  pdf_crypt_md_t *md;
+  pdf_char_t real_out[] = {
+    0xBA, 0x78, 0x16, 0xBF,
+    0x8F, 0x01, 0xCF, 0xEA,
+    0x41, 0x41, 0x40, 0xDE,
+    0x5D, 0xAE, 0x22, 0x23,
+    0xB0, 0x03, 0x61, 0xA3,
+    0x96, 0x17, 0x7A, 0x9C,
+    0xB4, 0x10, 0xFF, 0x61,
+    0xF2, 0x00, 0x15, 0xAD
+  };
+
+  md = pdf_crypt_md_new (PDF_CRYPT_MD_SHA256, &error);
+  fail_unless (md != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_md_write (md, in, sizeof (in), &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_crypt_md_read (md, out, sizeof(out), &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_if (memcmp (real_out, out, sizeof(out)));
+
+  pdf_crypt_md_destroy (md);
+}
+END_TEST
+
 /*
  * Test case creation function
  */
@@ -181,6 +254,8 @@ test_pdf_crypt_md_read (void)
   tcase_add_test (tc, pdf_crypt_md_read_002);
   tcase_add_test (tc, pdf_crypt_md_read_003);
   tcase_add_test (tc, pdf_crypt_md_read_004);
+  tcase_add_test (tc, pdf_crypt_md_read_005);
+  tcase_add_test (tc, pdf_crypt_md_read_006);
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
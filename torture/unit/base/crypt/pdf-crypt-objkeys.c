@@ -0,0 +1,288 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-crypt-objkeys.c
+ *       Date:         Sat Oct 17 22:48:19 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_crypt_objkeys
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+/* A 40-bit V2 file key */
+static const pdf_char_t v2_file_key[5] =
+  {
+    0x01, 0x23, 0x45, 0x67, 0x89
+  };
+
+/* "Encrypted string" encrypted with the keys of objects 1, 2 and 3,
+ * generation 0, derived from V2_FILE_KEY */
+static const pdf_char_t v2_ciphered[3][16] =
+  {
+    {
+      0x51, 0x60, 0xc1, 0x4a, 0x65, 0xce, 0x5f, 0xf7,
+      0x07, 0x90, 0xac, 0xe5, 0xb4, 0x07, 0x40, 0x5b
+    },
+    {
+      0xad, 0x81, 0x3d, 0x72, 0xaf, 0x0d, 0xdb, 0xab,
+      0x1d, 0xce, 0x54, 0xb5, 0x42, 0xa6, 0x64, 0xcb
+    },
+    {
+      0x51, 0x00, 0xfb, 0x0d, 0x80, 0x57, 0x3a, 0xa8,
+      0xa1, 0xc1, 0x3f, 0xb6, 0x75, 0x3c, 0x7f, 0xdb
+    }
+  };
+
+/* Decrypt V2_CIPHERED[NUMBER - 1] with the cipher of the object */
+static void
+check_v2_cipher (pdf_crypt_objkeys_t *objkeys,
+                 pdf_u32_t            number)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_cipher_t *cipher;
+  pdf_char_t out[16];
+
+  cipher = pdf_crypt_objkeys_get_cipher (objkeys, number, 0, &error);
+  fail_unless (cipher != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_cipher_decrypt (cipher,
+                                         out,
+                                         sizeof (out),
+                                         v2_ciphered[number - 1],
+                                         sizeof (out),
+                                         NULL,
+                                         &error));
+  fail_if (error != NULL);
+  fail_if (memcmp (out, "Encrypted string", sizeof (out)) != 0);
+}
+
+/*
+ * Test: pdf_crypt_objkeys_001
+ * Description:
+ *   Derive the key of an object from a 40-bit V2 file key.
+ * Success condition:
+ *   The key should be correct, 10 octets long.
+ */
+START_TEST (pdf_crypt_objkeys_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_objkeys_t *objkeys;
+  pdf_char_t key[PDF_CRYPT_OBJKEY_MAX_SIZE];
+  pdf_size_t key_size;
+  pdf_char_t expected[] =
+    {
+      0x03, 0x0a, 0x16, 0xd6, 0x6f, 0xf2, 0x14, 0xb6,
+      0x94, 0x06
+    };
+
+  objkeys = pdf_crypt_objkeys_new (PDF_CRYPT_CIPHER_ALGO_V2,
+                                   v2_file_key, sizeof (v2_file_key),
+                                   16, &error);
+  fail_unless (objkeys != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_objkeys_get_key (objkeys, 12, 0,
+                                          key, &key_size, &error));
+  fail_if (error != NULL);
+  fail_unless (key_size == sizeof (expected));
+  fail_if (memcmp (key, expected, sizeof (expected)) != 0);
+
+  pdf_crypt_objkeys_destroy (objkeys);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_objkeys_002
+ * Description:
+ *   Derive the key of an object from an AESV2 file key.
+ * Success condition:
+ *   The key should be correct, salted and 16 octets long.
+ */
+START_TEST (pdf_crypt_objkeys_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_objkeys_t *objkeys;
+  pdf_char_t file_key[16];
+  pdf_char_t key[PDF_CRYPT_OBJKEY_MAX_SIZE];
+  pdf_size_t key_size;
+  pdf_char_t expected[] =
+    {
+      0x40, 0x35, 0x6b, 0x0f, 0x86, 0xf0, 0xb0, 0x6a,
+      0xb0, 0x86, 0x9c, 0x60, 0x2d, 0x51, 0x80, 0x5f
+    };
+  int i;
+
+  for (i = 0; i < sizeof (file_key); i++)
+    file_key[i] = i;
+
+  objkeys = pdf_crypt_objkeys_new (PDF_CRYPT_CIPHER_ALGO_AESV2,
+                                   file_key, sizeof (file_key),
+                                   16, &error);
+  fail_unless (objkeys != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_objkeys_get_key (objkeys, 0x1234, 1,
+                                          key, &key_size, &error));
+  fail_if (error != NULL);
+  fail_unless (key_size == sizeof (expected));
+  fail_if (memcmp (key, expected, sizeof (expected)) != 0);
+
+  pdf_crypt_objkeys_destroy (objkeys);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_objkeys_003
+ * Description:
+ *   Get the key of an object from an AESV3 file key.
+ * Success condition:
+ *   The key should be the file key.
+ */
+START_TEST (pdf_crypt_objkeys_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_objkeys_t *objkeys;
+  pdf_char_t file_key[32];
+  pdf_char_t key[PDF_CRYPT_OBJKEY_MAX_SIZE];
+  pdf_size_t key_size;
+  int i;
+
+  for (i = 0; i < sizeof (file_key); i++)
+    file_key[i] = 0xA0 + i;
+
+  objkeys = pdf_crypt_objkeys_new (PDF_CRYPT_CIPHER_ALGO_AESV3,
+                                   file_key, sizeof (file_key),
+                                   16, &error);
+  fail_unless (objkeys != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_crypt_objkeys_get_key (objkeys, 7, 0,
+                                          key, &key_size, &error));
+  fail_if (error != NULL);
+  fail_unless (key_size == sizeof (file_key));
+  fail_if (memcmp (key, file_key, sizeof (file_key)) != 0);
+
+  pdf_crypt_objkeys_destroy (objkeys);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_objkeys_004
+ * Description:
+ *   Decrypt two strings of the same object with its V2 cipher.
+ * Success condition:
+ *   The cipher should start again from the key for the second string.
+ */
+START_TEST (pdf_crypt_objkeys_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_objkeys_t *objkeys;
+
+  objkeys = pdf_crypt_objkeys_new (PDF_CRYPT_CIPHER_ALGO_V2,
+                                   v2_file_key, sizeof (v2_file_key),
+                                   16, &error);
+  fail_unless (objkeys != NULL);
+  fail_if (error != NULL);
+
+  check_v2_cipher (objkeys, 1);
+  check_v2_cipher (objkeys, 1);
+
+  pdf_crypt_objkeys_destroy (objkeys);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_objkeys_005
+ * Description:
+ *   Decrypt strings of more objects than fit in the cache.
+ * Success condition:
+ *   The ciphers of the objects evicted from the cache should get their
+ *   keys again.
+ */
+START_TEST (pdf_crypt_objkeys_005)
+{
+  pdf_error_t *error = NULL;
+  pdf_crypt_objkeys_t *objkeys;
+
+  objkeys = pdf_crypt_objkeys_new (PDF_CRYPT_CIPHER_ALGO_V2,
+                                   v2_file_key, sizeof (v2_file_key),
+                                   2, &error);
+  fail_unless (objkeys != NULL);
+  fail_if (error != NULL);
+
+  check_v2_cipher (objkeys, 1);
+  check_v2_cipher (objkeys, 2);
+  check_v2_cipher (objkeys, 1);
+  check_v2_cipher (objkeys, 3);
+  check_v2_cipher (objkeys, 2);
+  check_v2_cipher (objkeys, 1);
+  check_v2_cipher (objkeys, 3);
+
+  pdf_crypt_objkeys_destroy (objkeys);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_objkeys_006
+ * Description:
+ *   Create object keys from a file key too long for V2.
+ * Success condition:
+ *   Fails with PDF_EBADDATA.
+ */
+START_TEST (pdf_crypt_objkeys_006)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t file_key[32] = { 0 };
+
+  fail_if (pdf_crypt_objkeys_new (PDF_CRYPT_CIPHER_ALGO_V2,
+                                  file_key, sizeof (file_key),
+                                  16, &error) != NULL);
+  fail_unless (error != NULL);
+  fail_if (pdf_error_get_status (error) != PDF_EBADDATA);
+  pdf_error_destroy (error);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_crypt_objkeys (void)
+{
+  TCase *tc = tcase_create ("pdf_crypt_objkeys");
+
+  tcase_add_test (tc, pdf_crypt_objkeys_001);
+  tcase_add_test (tc, pdf_crypt_objkeys_002);
+  tcase_add_test (tc, pdf_crypt_objkeys_003);
+  tcase_add_test (tc, pdf_crypt_objkeys_004);
+  tcase_add_test (tc, pdf_crypt_objkeys_005);
+  tcase_add_test (tc, pdf_crypt_objkeys_006);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-crypt-objkeys.c */
@@ -0,0 +1,223 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-crypt-r6.c
+ *       Date:         Sat Oct 17 21:05:37 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_crypt_r6_hash and
+ *                         pdf_crypt_r6_file_key
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+static const pdf_char_t salt[PDF_CRYPT_R6_SALT_SIZE] =
+  {
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08
+  };
+
+/* Encryption dictionary entries of a document with "owner" as owner
+ * password and "user" as user password, and its file key */
+static const pdf_char_t o[PDF_CRYPT_R6_OU_SIZE] =
+  {
+    0x0a, 0x55, 0xb3, 0x5a, 0x7b, 0xce, 0xf5, 0x85,
+    0x10, 0xf0, 0x31, 0xc2, 0x46, 0xa9, 0xcc, 0xb8,
+    0x80, 0xd2, 0xd9, 0x47, 0x7a, 0x63, 0x8e, 0x67,
+    0x4f, 0x30, 0x4c, 0x54, 0xad, 0x24, 0x16, 0xb0,
+    0x5f, 0xa9, 0xcf, 0x09, 0x72, 0xc0, 0x6a, 0x86,
+    0x55, 0xa4, 0x90, 0x7f, 0x1d, 0x0b, 0x7b, 0x7e
+  };
+
+static const pdf_char_t u[PDF_CRYPT_R6_OU_SIZE] =
+  {
+    0x0e, 0x01, 0x6f, 0xf1, 0x58, 0xdb, 0xfa, 0x99,
+    0xe5, 0xb1, 0x41, 0x8a, 0x03, 0xe1, 0xc7, 0xfe,
+    0x13, 0x0c, 0xfa, 0x5c, 0x03, 0x76, 0xb2, 0x63,
+    0xc2, 0x3f, 0xda, 0xd5, 0x16, 0xa2, 0x5c, 0x2d,
+    0x6c, 0x31, 0x53, 0xd6, 0x78, 0xe1, 0xa1, 0x4a,
+    0xa7, 0xf4, 0x79, 0xa3, 0x0b, 0x0c, 0xb1, 0x3b
+  };
+
+static const pdf_char_t oe[PDF_CRYPT_R6_OEUE_SIZE] =
+  {
+    0x9c, 0x6e, 0x46, 0xd9, 0x59, 0x36, 0x5e, 0x14,
+    0x09, 0x2d, 0xd7, 0x22, 0xff, 0x2d, 0xe7, 0x22,
+    0xdd, 0x95, 0x22, 0xf5, 0x5e, 0xdb, 0x5e, 0x74,
+    0xdc, 0x60, 0xd4, 0x0a, 0x37, 0xba, 0x96, 0xca
+  };
+
+static const pdf_char_t ue[PDF_CRYPT_R6_OEUE_SIZE] =
+  {
+    0xcf, 0x16, 0x4b, 0xb0, 0x7f, 0x62, 0xb9, 0x89,
+    0x8f, 0xff, 0xb0, 0x25, 0xe9, 0xbc, 0x9f, 0x3e,
+    0x5c, 0xf7, 0x5a, 0x81, 0x4b, 0xd9, 0xd3, 0x9c,
+    0xb3, 0xef, 0xb3, 0xc5, 0xf1, 0xc1, 0x02, 0xdd
+  };
+
+static const pdf_char_t file_key[PDF_CRYPT_R6_KEY_SIZE] =
+  {
+    0x8c, 0xdb, 0x25, 0xee, 0x12, 0x93, 0x39, 0xdc,
+    0x62, 0x0f, 0x2b, 0x02, 0x8d, 0x21, 0xc9, 0x2b,
+    0xc7, 0xb4, 0x87, 0x31, 0x9d, 0xcd, 0xe8, 0xea,
+    0xf9, 0x70, 0x3f, 0x37, 0x15, 0x99, 0x55, 0x48
+  };
+
+/*
+ * Test: pdf_crypt_r6_001
+ * Description:
+ *   Hash a user password.
+ * Success condition:
+ *   The hash should be correct.
+ */
+START_TEST (pdf_crypt_r6_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t hash[PDF_CRYPT_R6_HASH_SIZE];
+  pdf_char_t expected[PDF_CRYPT_R6_HASH_SIZE] =
+    {
+      0x17, 0x42, 0x4b, 0x40, 0xea, 0xd3, 0x66, 0xf7,
+      0xdd, 0xef, 0x0f, 0xf0, 0x73, 0x60, 0x8a, 0xa6,
+      0x8b, 0xa7, 0x01, 0x71, 0x4b, 0x5c, 0xef, 0x34,
+      0x09, 0xb9, 0x4c, 0x4f, 0xfa, 0x76, 0x37, 0x26
+    };
+
+  fail_unless (pdf_crypt_r6_hash ("user", 4, salt, NULL, hash, &error));
+  fail_if (error != NULL);
+  fail_if (memcmp (hash, expected, sizeof (hash)) != 0);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_r6_002
+ * Description:
+ *   Hash an owner password, with 48 bytes of user data.
+ * Success condition:
+ *   The hash should be correct.
+ */
+START_TEST (pdf_crypt_r6_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t udata[PDF_CRYPT_R6_OU_SIZE];
+  pdf_char_t hash[PDF_CRYPT_R6_HASH_SIZE];
+  pdf_char_t expected[PDF_CRYPT_R6_HASH_SIZE] =
+    {
+      0x67, 0x08, 0x55, 0x51, 0xe2, 0xb2, 0xfd, 0xe5,
+      0xa1, 0xcb, 0x25, 0x70, 0xad, 0xdb, 0xad, 0x32,
+      0x45, 0x9f, 0xe3, 0x7c, 0x0f, 0x55, 0x3d, 0x1a,
+      0x34, 0x35, 0x7f, 0x24, 0xda, 0x2e, 0xc6, 0x8f
+    };
+  int i;
+
+  for (i = 0; i < sizeof (udata); i++)
+    udata[i] = 100 + i;
+
+  fail_unless (pdf_crypt_r6_hash ("owner", 5, salt, udata, hash, &error));
+  fail_if (error != NULL);
+  fail_if (memcmp (hash, expected, sizeof (hash)) != 0);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_r6_003
+ * Description:
+ *   Compute the file key from the user password.
+ * Success condition:
+ *   The key should be correct, and not flagged as got from the owner
+ *   password.
+ */
+START_TEST (pdf_crypt_r6_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t key[PDF_CRYPT_R6_KEY_SIZE];
+  pdf_bool_t owner = PDF_TRUE;
+
+  fail_unless (pdf_crypt_r6_file_key ("user", 4, o, u, oe, ue,
+                                      key, &owner, &error));
+  fail_if (error != NULL);
+  fail_if (owner);
+  fail_if (memcmp (key, file_key, sizeof (key)) != 0);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_r6_004
+ * Description:
+ *   Compute the file key from the owner password.
+ * Success condition:
+ *   The key should be correct, and flagged as got from the owner
+ *   password.
+ */
+START_TEST (pdf_crypt_r6_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t key[PDF_CRYPT_R6_KEY_SIZE];
+  pdf_bool_t owner = PDF_FALSE;
+
+  fail_unless (pdf_crypt_r6_file_key ("owner", 5, o, u, oe, ue,
+                                      key, &owner, &error));
+  fail_if (error != NULL);
+  fail_unless (owner);
+  fail_if (memcmp (key, file_key, sizeof (key)) != 0);
+}
+END_TEST
+
+/*
+ * Test: pdf_crypt_r6_005
+ * Description:
+ *   Compute the file key from a wrong password.
+ * Success condition:
+ *   Fails with PDF_EBADPASSWD.
+ */
+START_TEST (pdf_crypt_r6_005)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t key[PDF_CRYPT_R6_KEY_SIZE];
+
+  fail_if (pdf_crypt_r6_file_key ("", 0, o, u, oe, ue,
+                                  key, NULL, &error));
+  fail_unless (error != NULL);
+  fail_if (pdf_error_get_status (error) != PDF_EBADPASSWD);
+  pdf_error_destroy (error);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_crypt_r6 (void)
+{
+  TCase *tc = tcase_create ("pdf_crypt_r6");
+
+  tcase_add_test (tc, pdf_crypt_r6_001);
+  tcase_add_test (tc, pdf_crypt_r6_002);
+  tcase_add_test (tc, pdf_crypt_r6_003);
+  tcase_add_test (tc, pdf_crypt_r6_004);
+  tcase_add_test (tc, pdf_crypt_r6_005);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-crypt-r6.c */
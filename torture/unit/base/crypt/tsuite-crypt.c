@@ -39,6 +39,8 @@ extern TCase *test_pdf_crypt_cipher_decrypt (void);
 extern TCase *test_pdf_crypt_md_new (void);
 extern TCase *test_pdf_crypt_md_write (void);
 extern TCase *test_pdf_crypt_md_read (void);
+extern TCase *test_pdf_crypt_r6 (void);
+extern TCase *test_pdf_crypt_objkeys (void);
 
 Suite *
 tsuite_crypt ()
@@ -56,6 +58,9 @@ tsuite_crypt ()
   suite_add_tcase (s, test_pdf_crypt_md_write ());
   suite_add_tcase (s, test_pdf_crypt_md_read ());
 
+  suite_add_tcase (s, test_pdf_crypt_r6 ());
+  suite_add_tcase (s, test_pdf_crypt_objkeys ());
+
   return s;
 }
 
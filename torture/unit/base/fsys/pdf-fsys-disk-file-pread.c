@@ -0,0 +1,155 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-fsys-disk-file-pread.c
+ *       Date:         Sat Oct 17 12:30:51 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_fsys_file_pread with the
+ *                         Disk filesystem
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <tortutils.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+static const pdf_char_t *contents = "0123456789abcdef";
+
+/* Create a test file with some contents and open it for reading */
+static pdf_fsys_file_t *
+open_test_file (pdf_text_t **path)
+{
+  const pdf_char_t *filename = "tmp.test";
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_size_t written_bytes;
+
+  *path = pdf_text_new_from_unicode (filename, strlen (filename),
+                                     PDF_TEXT_UTF8,
+                                     &error);
+  fail_unless (*path != NULL);
+  fail_if (error != NULL);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             *path,
+                             PDF_FSYS_OPEN_MODE_WRITE,
+                             &error);
+  fail_unless (file != NULL);
+  fail_unless (pdf_fsys_file_write (file, contents, strlen (contents),
+                                    &written_bytes,
+                                    &error) == PDF_TRUE);
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             *path,
+                             PDF_FSYS_OPEN_MODE_READ,
+                             &error);
+  fail_unless (file != NULL);
+  fail_if (error != NULL);
+
+  return file;
+}
+
+/*
+ * Test: pdf_fsys_disk_file_pread_001
+ * Description:
+ *   Read from a given offset of a file.
+ * Success condition:
+ *   The data read should be the one at the given offset, and the
+ *   file position should not be modified.
+ */
+START_TEST (pdf_fsys_disk_file_pread_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_char_t buf[4];
+  pdf_size_t read_bytes;
+
+  file = open_test_file (&path);
+  fail_unless (pdf_fsys_file_can_pread_p (file));
+
+  fail_unless (pdf_fsys_file_set_pos (file, 2, &error) == PDF_TRUE);
+
+  fail_unless (pdf_fsys_file_pread (file, buf, sizeof (buf), 10,
+                                    &read_bytes,
+                                    &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == sizeof (buf));
+  fail_unless (memcmp (buf, contents + 10, sizeof (buf)) == 0);
+
+  fail_unless (pdf_fsys_file_get_pos (file, &error) == 2);
+
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test: pdf_fsys_disk_file_pread_002
+ * Description:
+ *   Read past the end of a file.
+ * Success condition:
+ *   The call should return PDF_FALSE without error, reporting the
+ *   number of octets available.
+ */
+START_TEST (pdf_fsys_disk_file_pread_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_char_t buf[8];
+  pdf_size_t read_bytes;
+
+  file = open_test_file (&path);
+  fail_unless (pdf_fsys_file_can_pread_p (file));
+
+  fail_unless (pdf_fsys_file_pread (file, buf, sizeof (buf), 12,
+                                    &read_bytes,
+                                    &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 4);
+  fail_unless (memcmp (buf, contents + 12, 4) == 0);
+
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_fsys_disk_file_pread (void)
+{
+  TCase *tc = tcase_create ("pdf_fsys_disk_file_pread");
+
+  tcase_add_test (tc, pdf_fsys_disk_file_pread_001);
+  tcase_add_test (tc, pdf_fsys_disk_file_pread_002);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-fsys-disk-file-pread.c */
@@ -31,6 +31,7 @@
 extern TCase *test_pdf_fsys_disk_get_free_space (void);
 extern TCase *test_pdf_fsys_disk_file_open (void);
 extern TCase *test_pdf_fsys_disk_file_open_tmp (void);
+extern TCase *test_pdf_fsys_disk_file_pread (void);
 extern TCase *test_pdf_fsys_disk_build_path (void);
 extern TCase *test_pdf_fsys_disk_get_parent (void);
 extern TCase *test_pdf_fsys_disk_get_basename (void);
@@ -46,6 +47,7 @@ tsuite_fsys ()
   suite_add_tcase (s, test_pdf_fsys_disk_get_free_space ());
   suite_add_tcase (s, test_pdf_fsys_disk_file_open ());
   suite_add_tcase (s, test_pdf_fsys_disk_file_open_tmp ());
+  suite_add_tcase (s, test_pdf_fsys_disk_file_pread ());
   suite_add_tcase (s, test_pdf_fsys_disk_build_path ());
   suite_add_tcase (s, test_pdf_fsys_disk_get_parent ());
   suite_add_tcase (s, test_pdf_fsys_disk_get_basename ());
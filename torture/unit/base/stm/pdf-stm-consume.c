@@ -0,0 +1,136 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-consume.c
+ *       Date:         Sat Oct 17 10:41:05 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_consume
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+/*
+ * Test: pdf_stm_consume_001
+ * Description:
+ *   Consume part of a view and read the next character from the stream.
+ * Success condition:
+ *   The read character should be the first non-consumed one, and the
+ *   stream offset should be updated.
+ */
+START_TEST (pdf_stm_consume_001)
+{
+  const pdf_char_t *input = "0123456789";
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  const pdf_uchar_t *data;
+  pdf_size_t data_size;
+  pdf_uchar_t ret_char = '\0';
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)input,
+                         strlen (input),
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read_view (stm, &data, &data_size, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (data_size == strlen (input));
+
+  fail_unless (pdf_stm_consume (stm, 3, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_tell (stm) == 3);
+
+  fail_unless (pdf_stm_read_char (stm, &ret_char, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (ret_char == '3');
+
+  /* The new view starts after the read character */
+  fail_unless (pdf_stm_read_view (stm, &data, &data_size, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (data_size == strlen (input) - 4);
+  fail_unless (data[0] == '4');
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_consume_002
+ * Description:
+ *   Try to consume more data than available in the last view.
+ * Success condition:
+ *   PDF_FALSE should be returned, with a PDF_EINVRANGE error, and the
+ *   stream offset should not change.
+ */
+START_TEST (pdf_stm_consume_002)
+{
+  const pdf_char_t *input = "0123456789";
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  const pdf_uchar_t *data;
+  pdf_size_t data_size;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)input,
+                         strlen (input),
+                         4,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read_view (stm, &data, &data_size, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (data_size == 4);
+
+  fail_unless (pdf_stm_consume (stm, 5, &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EINVRANGE);
+  fail_unless (pdf_stm_tell (stm) == 0);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_consume (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_consume");
+
+  tcase_add_test (tc, pdf_stm_consume_001);
+  tcase_add_test (tc, pdf_stm_consume_002);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-consume.c */
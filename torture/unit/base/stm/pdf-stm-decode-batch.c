@@ -0,0 +1,208 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-decode-batch.c
+ *       Date:         Sat Oct 17 13:40:27 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_decode_batch
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+#define N_JOBS 64
+
+/*
+ * Test: pdf_stm_decode_batch_001
+ * Description:
+ *   Decode a batch of ASCII Hex encoded memory buffers.
+ * Success condition:
+ *   Every job should succeed and hold its decoded data.
+ */
+START_TEST (pdf_stm_decode_batch_001)
+{
+  pdf_error_t *error = NULL;
+  struct pdf_stm_filter_spec_s filters[] = {
+    { PDF_STM_FILTER_AHEX_DEC, NULL }
+  };
+  struct pdf_stm_decode_job_s jobs[N_JOBS];
+  pdf_stm_filter_chain_t *chain;
+  pdf_char_t encoded[N_JOBS][16];
+  pdf_char_t expected[8];
+  int i;
+
+  chain = pdf_stm_filter_chain_new (filters, 1, &error);
+  fail_unless (chain != NULL);
+
+  memset (jobs, 0, sizeof (jobs));
+  for (i = 0; i < N_JOBS; i++)
+    {
+      sprintf (encoded[i], "6A6F62%02X>", i);
+      jobs[i].buffer = (const pdf_uchar_t *)encoded[i];
+      jobs[i].size = strlen (encoded[i]);
+      jobs[i].chain = chain;
+    }
+
+  fail_unless (pdf_stm_decode_batch (jobs, N_JOBS, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  for (i = 0; i < N_JOBS; i++)
+    {
+      sprintf (expected, "job%c", i);
+      fail_if (jobs[i].error != NULL);
+      fail_unless (jobs[i].data_size == 4);
+      fail_unless (memcmp (jobs[i].data, expected, 4) == 0);
+      pdf_dealloc (jobs[i].data);
+    }
+
+  pdf_stm_filter_chain_destroy (chain);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_decode_batch_002
+ * Description:
+ *   Decode a batch of ranges of the same file, without filters.
+ * Success condition:
+ *   Every job should succeed and hold the contents of its range.
+ */
+START_TEST (pdf_stm_decode_batch_002)
+{
+  const pdf_char_t *filename = "tmp.test";
+  const pdf_char_t *contents = "0123456789abcdefghijklmnopqrstuv";
+  pdf_error_t *error = NULL;
+  struct pdf_stm_decode_job_s jobs[8];
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_size_t written_bytes;
+  int i;
+
+  path = pdf_text_new_from_unicode (filename, strlen (filename),
+                                    PDF_TEXT_UTF8,
+                                    &error);
+  fail_unless (path != NULL);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             path,
+                             PDF_FSYS_OPEN_MODE_WRITE,
+                             &error);
+  fail_unless (file != NULL);
+  fail_unless (pdf_fsys_file_write (file, contents, strlen (contents),
+                                    &written_bytes,
+                                    &error) == PDF_TRUE);
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             path,
+                             PDF_FSYS_OPEN_MODE_READ,
+                             &error);
+  fail_unless (file != NULL);
+
+  memset (jobs, 0, sizeof (jobs));
+  for (i = 0; i < 8; i++)
+    {
+      jobs[i].file = file;
+      jobs[i].offset = 4 * i;
+      jobs[i].size = 4;
+    }
+
+  fail_unless (pdf_stm_decode_batch (jobs, 8, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  for (i = 0; i < 8; i++)
+    {
+      fail_if (jobs[i].error != NULL);
+      fail_unless (jobs[i].data_size == 4);
+      fail_unless (memcmp (jobs[i].data, contents + 4 * i, 4) == 0);
+      pdf_dealloc (jobs[i].data);
+    }
+
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_decode_batch_003
+ * Description:
+ *   Decode a batch where one of the jobs has invalid data.
+ * Success condition:
+ *   The call should fail, reporting the error in the failed job, and
+ *   the other job should be decoded.
+ */
+START_TEST (pdf_stm_decode_batch_003)
+{
+  pdf_error_t *error = NULL;
+  struct pdf_stm_filter_spec_s filters[] = {
+    { PDF_STM_FILTER_AHEX_DEC, NULL }
+  };
+  struct pdf_stm_decode_job_s jobs[2];
+  pdf_stm_filter_chain_t *chain;
+
+  chain = pdf_stm_filter_chain_new (filters, 1, &error);
+  fail_unless (chain != NULL);
+
+  memset (jobs, 0, sizeof (jobs));
+  jobs[0].buffer = (const pdf_uchar_t *)"414243>";
+  jobs[0].size = 7;
+  jobs[0].chain = chain;
+  jobs[1].buffer = (const pdf_uchar_t *)"4Z>";
+  jobs[1].size = 3;
+  jobs[1].chain = chain;
+
+  fail_unless (pdf_stm_decode_batch (jobs, 2, &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  pdf_error_destroy (error);
+
+  fail_if (jobs[0].error != NULL);
+  fail_unless (jobs[0].data_size == 3);
+  fail_unless (memcmp (jobs[0].data, "ABC", 3) == 0);
+  pdf_dealloc (jobs[0].data);
+
+  fail_unless (jobs[1].error != NULL);
+  fail_unless (jobs[1].data == NULL);
+  pdf_error_destroy (jobs[1].error);
+
+  pdf_stm_filter_chain_destroy (chain);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_decode_batch (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_decode_batch");
+
+  tcase_add_test (tc, pdf_stm_decode_batch_001);
+  tcase_add_test (tc, pdf_stm_decode_batch_002);
+  tcase_add_test (tc, pdf_stm_decode_batch_003);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-decode-batch.c */
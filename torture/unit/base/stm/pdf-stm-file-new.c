@@ -25,6 +25,7 @@
 
 #include <config.h>
 
+#include <string.h>
 #include <check.h>
 #include <pdf.h>
 #include <pdf-test-common.h>
@@ -76,6 +77,81 @@ START_TEST (pdf_stm_file_new_001)
 }
 END_TEST
 
+/*
+ * Test: pdf_stm_file_new_002
+ * Description:
+ *   Create two reading streams at different offsets of the same file
+ *   object, and read from them alternately.
+ * Success condition:
+ *   Each stream should read the contents of the file from its own
+ *   offset, not affected by the reads done by the other one.
+ */
+START_TEST (pdf_stm_file_new_002)
+{
+  const pdf_char_t *filename = "tmp.test";
+  const pdf_char_t *contents = "0123456789abcdefghijklmnopqrstuv";
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm1;
+  pdf_stm_t *stm2;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_size_t written_bytes;
+  pdf_uchar_t c1;
+  pdf_uchar_t c2;
+  int i;
+
+  /* Create the file path */
+  path = pdf_text_new_from_unicode (filename, strlen (filename),
+                                    PDF_TEXT_UTF8,
+                                    &error);
+  fail_unless (path != NULL);
+  fail_if (error != NULL);
+
+  /* Create the file */
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             path,
+                             PDF_FSYS_OPEN_MODE_WRITE,
+                             &error);
+  fail_unless (file != NULL);
+  fail_unless (pdf_fsys_file_write (file, contents, strlen (contents),
+                                    &written_bytes,
+                                    &error) == PDF_TRUE);
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+
+  /* Open it for reading */
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             path,
+                             PDF_FSYS_OPEN_MODE_READ,
+                             &error);
+  fail_unless (file != NULL);
+  fail_if (error != NULL);
+
+  /* Create the streams, with tiny caches so that the backends are
+   * read several times */
+  stm1 = pdf_stm_file_new (file, 0, 4, PDF_STM_READ, &error);
+  fail_unless (stm1 != NULL);
+  fail_if (error != NULL);
+  stm2 = pdf_stm_file_new (file, 16, 4, PDF_STM_READ, &error);
+  fail_unless (stm2 != NULL);
+  fail_if (error != NULL);
+
+  for (i = 0; i < 16; i++)
+    {
+      fail_unless (pdf_stm_read_char (stm1, &c1, &error) == PDF_TRUE);
+      fail_unless (pdf_stm_read_char (stm2, &c2, &error) == PDF_TRUE);
+      fail_if (error != NULL);
+      fail_unless (c1 == contents[i]);
+      fail_unless (c2 == contents[16 + i]);
+    }
+
+  /* Free all resources */
+  pdf_stm_destroy (stm1);
+  pdf_stm_destroy (stm2);
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
 /*
  * Test case creation function
  */
@@ -85,6 +161,7 @@ test_pdf_stm_file_new (void)
   TCase *tc = tcase_create ("pdf_stm_file_new");
 
   tcase_add_test (tc, pdf_stm_file_new_001);
+  tcase_add_test (tc, pdf_stm_file_new_002);
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
@@ -0,0 +1,180 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-file-reset.c
+ *       Date:         Sat Oct 17 21:12:08 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_file_reset
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+/* Create a test file with the given contents and open it for reading */
+static pdf_fsys_file_t *
+open_test_file (pdf_text_t       **path,
+                const pdf_char_t  *data)
+{
+  const pdf_char_t *filename = "tmp.test";
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_size_t written_bytes;
+
+  *path = pdf_text_new_from_unicode (filename, strlen (filename),
+                                     PDF_TEXT_UTF8,
+                                     &error);
+  fail_unless (*path != NULL);
+  fail_if (error != NULL);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             *path,
+                             PDF_FSYS_OPEN_MODE_WRITE,
+                             &error);
+  fail_unless (file != NULL);
+  fail_unless (pdf_fsys_file_write (file, data, strlen (data),
+                                    &written_bytes,
+                                    &error) == PDF_TRUE);
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             *path,
+                             PDF_FSYS_OPEN_MODE_READ,
+                             &error);
+  fail_unless (file != NULL);
+  fail_if (error != NULL);
+
+  return file;
+}
+
+/*
+ * Test: pdf_stm_file_reset_001
+ * Description:
+ *   Read several ranges of a file with the same stream.
+ * Success condition:
+ *   Each read should stop at the end of its range, and a range of
+ *   length 0 should go up to the end of the file.
+ */
+START_TEST (pdf_stm_file_reset_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_stm_t *stm;
+  pdf_uchar_t buf[32];
+  pdf_size_t read_bytes;
+
+  file = open_test_file (&path, "xxxxAAAAyyyyBBBBzz");
+
+  stm = pdf_stm_file_new (file, 0, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+
+  fail_unless (pdf_stm_file_reset (stm, 4, 4, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_btell (stm) == 4);
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 4);
+  fail_unless (memcmp (buf, "AAAA", 4) == 0);
+
+  fail_unless (pdf_stm_file_reset (stm, 12, 4, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 4);
+  fail_unless (memcmp (buf, "BBBB", 4) == 0);
+
+  fail_unless (pdf_stm_file_reset (stm, 16, 0, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 2);
+  fail_unless (memcmp (buf, "zz", 2) == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_file_reset_002
+ * Description:
+ *   Decode two ASCII Hex encoded ranges of a file with the same stream,
+ *   leaving the first one half read.
+ * Success condition:
+ *   The end of each range should end the encoded data, and the second
+ *   range should be decoded from its start.
+ */
+START_TEST (pdf_stm_file_reset_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_stm_t *stm;
+  pdf_uchar_t buf[8];
+  pdf_size_t read_bytes;
+
+  file = open_test_file (&path, "414243--44454647");
+
+  stm = pdf_stm_file_new (file, 0, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_AHEX_DEC, NULL,
+                                       &error) == PDF_TRUE);
+
+  fail_unless (pdf_stm_file_reset (stm, 0, 6, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_read (stm, buf, 1, &read_bytes, &error) == PDF_TRUE);
+  fail_unless (read_bytes == 1);
+  fail_unless (buf[0] == 'A');
+
+  fail_unless (pdf_stm_file_reset (stm, 8, 8, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 4);
+  fail_unless (memcmp (buf, "DEFG", 4) == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_file_reset (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_file_reset");
+
+  tcase_add_test (tc, pdf_stm_file_reset_001);
+  tcase_add_test (tc, pdf_stm_file_reset_002);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-file-reset.c */
@@ -0,0 +1,316 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-get-cache-stats.c
+ *       Date:         Sat Oct 17 17:48:12 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_get_cache_stats
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+#define TEST_DATA_SIZE 300000
+
+static pdf_uchar_t *
+new_test_data (void)
+{
+  pdf_uchar_t *data;
+  int i;
+
+  data = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (data != NULL);
+  for (i = 0; i < TEST_DATA_SIZE; i++)
+    data[i] = (pdf_uchar_t) (i % 251);
+  return data;
+}
+
+/* Read the whole contents of STM and check them against INPUT */
+static void
+read_and_check (pdf_stm_t         *stm,
+                const pdf_uchar_t *input)
+{
+  pdf_error_t *error = NULL;
+  pdf_uchar_t *output;
+  pdf_size_t read_bytes;
+
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  fail_unless (pdf_stm_read (stm,
+                             output,
+                             TEST_DATA_SIZE,
+                             &read_bytes,
+                             &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == TEST_DATA_SIZE);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  pdf_dealloc (output);
+}
+
+/*
+ * Test: pdf_stm_get_cache_stats_001
+ * Description:
+ *   Read a memory stream with the default cache policy.
+ * Success condition:
+ *   The cache should keep its initial size.
+ */
+START_TEST (pdf_stm_get_cache_stats_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  struct pdf_stm_cache_stats_s stats;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  read_and_check (stm, input);
+
+  pdf_stm_get_cache_stats (stm, &stats);
+  fail_unless (stats.policy == PDF_STM_CACHE_FIXED);
+  fail_unless (stats.initial_size == PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.size == PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.n_resizes == 0);
+  fail_unless (stats.n_runs >= TEST_DATA_SIZE / PDF_STM_DEFAULT_CACHE_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_cache_stats_002
+ * Description:
+ *   Read a memory stream with an adaptive cache.
+ * Success condition:
+ *   The data should be read correctly, the cache should have grown
+ *   within its limit, and the memory taken from the budget should be
+ *   given back when destroying the stream.
+ */
+START_TEST (pdf_stm_get_cache_stats_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  struct pdf_stm_cache_stats_s stats;
+  pdf_size_t used;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  pdf_stm_set_cache_policy (stm, PDF_STM_CACHE_ADAPTIVE, 0);
+  read_and_check (stm, input);
+
+  pdf_stm_get_cache_stats (stm, &stats);
+  fail_unless (stats.policy == PDF_STM_CACHE_ADAPTIVE);
+  fail_unless (stats.max_size == PDF_STM_MAX_CACHE_SIZE);
+  fail_unless (stats.size > PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.size <= stats.max_size);
+  fail_unless (stats.n_resizes > 0);
+
+  pdf_stm_get_cache_budget (NULL, &used);
+  fail_unless (used == stats.buffers_size - 2 * PDF_STM_DEFAULT_CACHE_SIZE);
+
+  pdf_stm_destroy (stm);
+
+  pdf_stm_get_cache_budget (NULL, &used);
+  fail_unless (used == 0);
+
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_cache_stats_003
+ * Description:
+ *   Read a memory stream with an adaptive cache, declaring a length
+ *   smaller than the default cache size.
+ * Success condition:
+ *   The cache should not grow.
+ */
+START_TEST (pdf_stm_get_cache_stats_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  struct pdf_stm_cache_stats_s stats;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  pdf_stm_set_cache_policy (stm, PDF_STM_CACHE_ADAPTIVE, 100);
+  read_and_check (stm, input);
+
+  pdf_stm_get_cache_stats (stm, &stats);
+  fail_unless (stats.max_size == PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.size == PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.n_resizes == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_cache_stats_004
+ * Description:
+ *   Read a memory stream with an adaptive cache and no cache budget.
+ * Success condition:
+ *   The cache should not grow.
+ */
+START_TEST (pdf_stm_get_cache_stats_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  struct pdf_stm_cache_stats_s stats;
+  pdf_size_t budget;
+
+  pdf_stm_get_cache_budget (&budget, NULL);
+  pdf_stm_set_cache_budget (0);
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  pdf_stm_set_cache_policy (stm, PDF_STM_CACHE_ADAPTIVE, 0);
+  read_and_check (stm, input);
+
+  pdf_stm_get_cache_stats (stm, &stats);
+  fail_unless (stats.size == PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.n_resizes == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+
+  pdf_stm_set_cache_budget (budget);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_cache_stats_005
+ * Description:
+ *   Write some contents in bulk into a memory stream with an adaptive
+ *   cache and an additional NULL filter.
+ * Success condition:
+ *   The data should be written correctly and the buffers should have
+ *   grown.
+ */
+START_TEST (pdf_stm_get_cache_stats_005)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *output;
+  pdf_size_t written_bytes;
+  struct pdf_stm_cache_stats_s stats;
+
+  input = new_test_data ();
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  stm = pdf_stm_mem_new (output,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_WRITE,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_NULL,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  pdf_stm_set_cache_policy (stm, PDF_STM_CACHE_ADAPTIVE, TEST_DATA_SIZE);
+
+  fail_unless (pdf_stm_write (stm,
+                              input,
+                              TEST_DATA_SIZE,
+                              &written_bytes,
+                              &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (written_bytes == TEST_DATA_SIZE);
+  fail_unless (pdf_stm_flush (stm, PDF_TRUE, NULL, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  pdf_stm_get_cache_stats (stm, &stats);
+  fail_unless (stats.max_size == TEST_DATA_SIZE);
+  fail_unless (stats.size > PDF_STM_DEFAULT_CACHE_SIZE);
+  fail_unless (stats.n_resizes > 0);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_get_cache_stats (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_get_cache_stats");
+
+  tcase_add_test (tc, pdf_stm_get_cache_stats_001);
+  tcase_add_test (tc, pdf_stm_get_cache_stats_002);
+  tcase_add_test (tc, pdf_stm_get_cache_stats_003);
+  tcase_add_test (tc, pdf_stm_get_cache_stats_004);
+  tcase_add_test (tc, pdf_stm_get_cache_stats_005);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-get-cache-stats.c */
@@ -0,0 +1,305 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-get-copy-counters.c
+ *       Date:         Sat Oct 17 12:20:37 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_get_copy_counters
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+#define TEST_DATA_SIZE 10000
+
+static pdf_uchar_t *
+new_test_data (void)
+{
+  pdf_uchar_t *data;
+  int i;
+
+  data = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (data != NULL);
+  for (i = 0; i < TEST_DATA_SIZE; i++)
+    data[i] = (pdf_uchar_t) (i % 251);
+  return data;
+}
+
+/*
+ * Test: pdf_stm_get_copy_counters_001
+ * Description:
+ *   Read all the contents of a memory stream with no filters using
+ *   zero-copy views.
+ * Success condition:
+ *   No bytes should be copied, and every byte should be handed over by
+ *   the pass-through filter.
+ */
+START_TEST (pdf_stm_get_copy_counters_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  const pdf_uchar_t *data;
+  pdf_size_t data_size;
+  pdf_size_t total = 0;
+  pdf_size_t copied;
+  pdf_size_t forwarded;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  while (pdf_stm_read_view (stm, &data, &data_size, &error))
+    {
+      fail_unless (memcmp (data, &input[total], data_size) == 0);
+      total += data_size;
+      fail_unless (pdf_stm_consume (stm, data_size, &error) == PDF_TRUE);
+    }
+  fail_if (error != NULL);
+  fail_unless (total == TEST_DATA_SIZE);
+
+  pdf_stm_get_copy_counters (stm, &copied, &forwarded);
+  fail_unless (copied == 0);
+  fail_unless (forwarded == TEST_DATA_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_copy_counters_002
+ * Description:
+ *   Read all the contents of a memory stream with an additional NULL
+ *   filter installed, using pdf_stm_read.
+ * Success condition:
+ *   Each byte should be copied once into the user buffer, and handed over
+ *   by both NULL filters.
+ */
+START_TEST (pdf_stm_get_copy_counters_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *output;
+  pdf_size_t read_bytes;
+  pdf_size_t copied;
+  pdf_size_t forwarded;
+
+  input = new_test_data ();
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_NULL,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read (stm,
+                             output,
+                             TEST_DATA_SIZE,
+                             &read_bytes,
+                             &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == TEST_DATA_SIZE);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  pdf_stm_get_copy_counters (stm, &copied, &forwarded);
+  fail_unless (copied == TEST_DATA_SIZE);
+  fail_unless (forwarded == 2 * TEST_DATA_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_copy_counters_003
+ * Description:
+ *   Write some contents into a memory stream with no filters.
+ * Success condition:
+ *   Each byte should be copied once from the user buffer, and handed over
+ *   by the pass-through filter.
+ */
+START_TEST (pdf_stm_get_copy_counters_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *output;
+  pdf_size_t written_bytes;
+  pdf_size_t copied;
+  pdf_size_t forwarded;
+
+  input = new_test_data ();
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  stm = pdf_stm_mem_new (output,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_WRITE,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_write (stm,
+                              input,
+                              TEST_DATA_SIZE,
+                              &written_bytes,
+                              &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (written_bytes == TEST_DATA_SIZE);
+  fail_unless (pdf_stm_flush (stm, PDF_TRUE, NULL, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  pdf_stm_get_copy_counters (stm, &copied, &forwarded);
+  fail_unless (copied == TEST_DATA_SIZE);
+  fail_unless (forwarded == TEST_DATA_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_copy_counters_004
+ * Description:
+ *   Read Flate-encoded contents from a memory stream through a Flate
+ *   decoder and an additional NULL filter, whose buffers are not as
+ *   large as the ones of the decoder.
+ * Success condition:
+ *   The data should be decoded correctly, and the NULL filters next to
+ *   the decoder should still hand their buffers over.
+ */
+START_TEST (pdf_stm_get_copy_counters_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *encoded;
+  pdf_uchar_t *output;
+  pdf_size_t encoded_size;
+  pdf_size_t read_bytes;
+  pdf_size_t copied;
+  pdf_size_t forwarded;
+
+  input = new_test_data ();
+  encoded = pdf_alloc (2 * TEST_DATA_SIZE);
+  fail_unless (encoded != NULL);
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  /* Encode the test data */
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_ENC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  pdf_stm_read (stm, encoded, 2 * TEST_DATA_SIZE, &encoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (encoded_size > 0);
+  pdf_stm_destroy (stm);
+
+  /* Decode it back */
+  stm = pdf_stm_mem_new (encoded,
+                         encoded_size,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_DEC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_NULL,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read (stm,
+                             output,
+                             TEST_DATA_SIZE,
+                             &read_bytes,
+                             &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == TEST_DATA_SIZE);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  /* The encoded data goes through the first NULL filter, and the decoded
+   * data through the second one */
+  pdf_stm_get_copy_counters (stm, &copied, &forwarded);
+  fail_unless (forwarded == encoded_size + TEST_DATA_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (encoded);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_get_copy_counters (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_get_copy_counters");
+
+  tcase_add_test (tc, pdf_stm_get_copy_counters_001);
+  tcase_add_test (tc, pdf_stm_get_copy_counters_002);
+  tcase_add_test (tc, pdf_stm_get_copy_counters_003);
+  tcase_add_test (tc, pdf_stm_get_copy_counters_004);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-get-copy-counters.c */
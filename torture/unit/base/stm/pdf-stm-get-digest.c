@@ -0,0 +1,352 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-get-digest.c
+ *       Date:         Sun Oct 18 11:02:41 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_get_digest
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+#define TEST_DATA_SIZE 10000
+
+/* Digests of the test data */
+static const pdf_char_t md5_digest[PDF_CRYPT_MD_MD5_SIZE] =
+  {
+    0xbb, 0xf1, 0xc7, 0x75, 0x38, 0xf9, 0x7c, 0xee,
+    0xb1, 0xe0, 0x31, 0x26, 0xed, 0xaa, 0x35, 0x94
+  };
+
+static const pdf_char_t sha1_digest[PDF_CRYPT_MD_SHA1_SIZE] =
+  {
+    0x29, 0x52, 0x2e, 0x73, 0xf5, 0xc6, 0x7d, 0x3f,
+    0xff, 0x39, 0xd9, 0x36, 0xae, 0x0b, 0xb5, 0x42,
+    0xdb, 0x8b, 0x05, 0xb5
+  };
+
+static const pdf_char_t sha256_digest[PDF_CRYPT_MD_SHA256_SIZE] =
+  {
+    0x0c, 0xd0, 0xbf, 0x93, 0x06, 0x77, 0x96, 0x09,
+    0x51, 0xdd, 0xa8, 0x58, 0x8e, 0xdc, 0xb6, 0xb2,
+    0x93, 0xc0, 0xc3, 0xb2, 0x6e, 0xf3, 0xba, 0x72,
+    0xcd, 0xdf, 0xf4, 0xdd, 0xfc, 0x68, 0x22, 0xc7
+  };
+
+static pdf_uchar_t *
+new_test_data (void)
+{
+  pdf_uchar_t *data;
+  int i;
+
+  data = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (data != NULL);
+  for (i = 0; i < TEST_DATA_SIZE; i++)
+    data[i] = (pdf_uchar_t) (i % 251);
+  return data;
+}
+
+/* Install a digest filter computing the given algorithms */
+static void
+install_digest_filter (pdf_stm_t  *stm,
+                       pdf_bool_t  md5,
+                       pdf_bool_t  sha1,
+                       pdf_bool_t  sha256)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_bool (params, "MD5", md5, &error));
+  fail_unless (pdf_hash_add_bool (params, "SHA1", sha1, &error));
+  fail_unless (pdf_hash_add_bool (params, "SHA256", sha256, &error));
+
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_DIGEST,
+                                       params,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  pdf_hash_destroy (params);
+}
+
+/* Check the digest computed with ALGORITHM in the stream */
+static void
+check_digest (pdf_stm_t                 *stm,
+              enum pdf_crypt_md_algo_e   algorithm,
+              const pdf_char_t          *expected,
+              pdf_size_t                 expected_size)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t digest[PDF_CRYPT_MD_MAX_SIZE];
+  pdf_size_t digest_size;
+
+  fail_unless (pdf_stm_get_digest (stm,
+                                   algorithm,
+                                   digest,
+                                   sizeof (digest),
+                                   &digest_size,
+                                   &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (digest_size == expected_size);
+  fail_unless (memcmp (digest, expected, expected_size) == 0);
+}
+
+/* Check that getting the digest computed with ALGORITHM in the stream
+ * fails with STATUS */
+static void
+check_digest_error (pdf_stm_t                 *stm,
+                    enum pdf_crypt_md_algo_e   algorithm,
+                    pdf_status_t               status)
+{
+  pdf_error_t *error = NULL;
+  pdf_char_t digest[PDF_CRYPT_MD_MAX_SIZE];
+
+  fail_unless (pdf_stm_get_digest (stm,
+                                   algorithm,
+                                   digest,
+                                   sizeof (digest),
+                                   NULL,
+                                   &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == status);
+  pdf_error_destroy (error);
+}
+
+/*
+ * Test: pdf_stm_get_digest_001
+ * Description:
+ *   Read all the contents of a memory stream through a digest filter
+ *   computing MD5, SHA-1 and SHA-256.
+ * Success condition:
+ *   The data should be read unchanged and the digests should be correct.
+ *   The filter should hand over its input buffers instead of copying
+ *   them.
+ */
+START_TEST (pdf_stm_get_digest_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *output;
+  pdf_size_t read_bytes;
+  pdf_size_t copied;
+  pdf_size_t forwarded;
+
+  input = new_test_data ();
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  install_digest_filter (stm, PDF_TRUE, PDF_TRUE, PDF_TRUE);
+
+  fail_unless (pdf_stm_read (stm,
+                             output,
+                             TEST_DATA_SIZE,
+                             &read_bytes,
+                             &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == TEST_DATA_SIZE);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  /* Read until EOF, so that the filter gets to the end of the data */
+  fail_unless (pdf_stm_read (stm,
+                             output,
+                             TEST_DATA_SIZE,
+                             &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+
+  check_digest (stm, PDF_CRYPT_MD_MD5, md5_digest, sizeof (md5_digest));
+  check_digest (stm, PDF_CRYPT_MD_SHA1, sha1_digest, sizeof (sha1_digest));
+  check_digest (stm, PDF_CRYPT_MD_SHA256,
+                sha256_digest, sizeof (sha256_digest));
+
+  pdf_stm_get_copy_counters (stm, &copied, &forwarded);
+  fail_unless (copied == TEST_DATA_SIZE);
+  fail_unless (forwarded == 2 * TEST_DATA_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_digest_002
+ * Description:
+ *   Write some contents into a memory stream through a digest filter
+ *   computing SHA-256, byte per byte.
+ * Success condition:
+ *   The data should be written unchanged and the digest should be
+ *   correct once the stream is finished.
+ */
+START_TEST (pdf_stm_get_digest_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *output;
+  pdf_size_t written_bytes;
+  int i;
+
+  input = new_test_data ();
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  stm = pdf_stm_mem_new (output,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_WRITE,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  install_digest_filter (stm, PDF_FALSE, PDF_FALSE, PDF_TRUE);
+
+  for (i = 0; i < TEST_DATA_SIZE; i++)
+    {
+      fail_unless (pdf_stm_write (stm,
+                                  &input[i],
+                                  1,
+                                  &written_bytes,
+                                  &error) == PDF_TRUE);
+      fail_if (error != NULL);
+      fail_unless (written_bytes == 1);
+    }
+
+  /* Not available until the end of the data */
+  check_digest_error (stm, PDF_CRYPT_MD_SHA256, PDF_EAGAIN);
+
+  fail_unless (pdf_stm_flush (stm, PDF_TRUE, NULL, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (memcmp (output, input, TEST_DATA_SIZE) == 0);
+
+  check_digest (stm, PDF_CRYPT_MD_SHA256,
+                sha256_digest, sizeof (sha256_digest));
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_digest_003
+ * Description:
+ *   Get digests not computed in the stream.
+ * Success condition:
+ *   Fails with PDF_ENOMATCH.
+ */
+START_TEST (pdf_stm_get_digest_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  /* No digest filter */
+  check_digest_error (stm, PDF_CRYPT_MD_MD5, PDF_ENOMATCH);
+
+  /* Digest filter without SHA-1 */
+  install_digest_filter (stm, PDF_TRUE, PDF_FALSE, PDF_FALSE);
+  check_digest_error (stm, PDF_CRYPT_MD_SHA1, PDF_ENOMATCH);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_digest_004
+ * Description:
+ *   Install a digest filter not computing any digest.
+ * Success condition:
+ *   Fails with PDF_EBADDATA.
+ */
+START_TEST (pdf_stm_get_digest_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_DIGEST,
+                                       NULL,
+                                       &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EBADDATA);
+  pdf_error_destroy (error);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_get_digest (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_get_digest");
+
+  tcase_add_test (tc, pdf_stm_get_digest_001);
+  tcase_add_test (tc, pdf_stm_get_digest_002);
+  tcase_add_test (tc, pdf_stm_get_digest_003);
+  tcase_add_test (tc, pdf_stm_get_digest_004);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-get-digest.c */
@@ -0,0 +1,277 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-get-stats.c
+ *       Date:         Sat Oct 17 18:31:09 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_get_stats
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+#define TEST_DATA_SIZE 10000
+
+static pdf_uchar_t *
+new_test_data (void)
+{
+  pdf_uchar_t *data;
+  int i;
+
+  data = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (data != NULL);
+  for (i = 0; i < TEST_DATA_SIZE; i++)
+    data[i] = (pdf_uchar_t) (i % 251);
+  return data;
+}
+
+/*
+ * Test: pdf_stm_get_stats_001
+ * Description:
+ *   Get the statistics of a stream which doesn't collect them.
+ * Success condition:
+ *   PDF_EINVOP should be reported.
+ */
+START_TEST (pdf_stm_get_stats_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  struct pdf_stm_stats_s stats;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_get_stats (stm, &stats, NULL, 0, &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EINVOP);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_stats_002
+ * Description:
+ *   Read all the contents of a memory stream through an ASCII Hex
+ *   encoder installed after enabling the statistics.
+ * Success condition:
+ *   The backend should have provided all the data, and the counters of
+ *   both filters should match the data flowing through them.
+ */
+START_TEST (pdf_stm_get_stats_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  const pdf_uchar_t *data;
+  pdf_size_t data_size;
+  pdf_size_t total = 0;
+  struct pdf_stm_stats_s stats;
+  struct pdf_stm_filter_stats_s filter_stats[2];
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  pdf_stm_enable_stats (stm, PDF_TRUE);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_AHEX_ENC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  while (pdf_stm_read_view (stm, &data, &data_size, &error))
+    {
+      total += data_size;
+      fail_unless (pdf_stm_consume (stm, data_size, &error) == PDF_TRUE);
+    }
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_get_stats (stm,
+                                  &stats,
+                                  filter_stats,
+                                  2,
+                                  &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (stats.be_read_bytes == TEST_DATA_SIZE);
+  fail_unless (stats.n_be_reads > 0);
+  fail_unless (stats.n_be_writes == 0);
+  fail_unless (stats.n_filters == 2);
+
+  /* The last installed filter comes first */
+  fail_unless (filter_stats[0].type == PDF_STM_FILTER_AHEX_ENC);
+  fail_unless (filter_stats[0].n_applies > 0);
+  fail_unless (filter_stats[0].bytes_in == TEST_DATA_SIZE);
+  fail_unless (filter_stats[0].bytes_out == total);
+  fail_unless (filter_stats[0].n_no_input > 0);
+
+  fail_unless (filter_stats[1].type == PDF_STM_FILTER_NULL);
+  fail_unless (filter_stats[1].bytes_in == TEST_DATA_SIZE);
+  fail_unless (filter_stats[1].bytes_out == TEST_DATA_SIZE);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_stats_003
+ * Description:
+ *   Write some contents into a memory stream collecting statistics.
+ * Success condition:
+ *   All the contents should have been written into the backend.
+ */
+START_TEST (pdf_stm_get_stats_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t *output;
+  pdf_size_t written_bytes;
+  struct pdf_stm_stats_s stats;
+
+  input = new_test_data ();
+  output = pdf_alloc (TEST_DATA_SIZE);
+  fail_unless (output != NULL);
+
+  stm = pdf_stm_mem_new (output,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_WRITE,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  pdf_stm_enable_stats (stm, PDF_TRUE);
+
+  fail_unless (pdf_stm_write (stm,
+                              input,
+                              TEST_DATA_SIZE,
+                              &written_bytes,
+                              &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_flush (stm, PDF_TRUE, NULL, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_get_stats (stm, &stats, NULL, 0, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (stats.n_be_reads == 0);
+  fail_unless (stats.n_be_writes > 0);
+  fail_unless (stats.be_written_bytes == TEST_DATA_SIZE);
+  fail_unless (stats.n_filters == 1);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (output);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_get_stats_004
+ * Description:
+ *   Enable the statistics of a stream again after reading from it.
+ * Success condition:
+ *   The counters should be reset.
+ */
+START_TEST (pdf_stm_get_stats_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *input;
+  pdf_uchar_t ret_char;
+  struct pdf_stm_stats_s stats;
+  struct pdf_stm_filter_stats_s filter_stats;
+
+  input = new_test_data ();
+  stm = pdf_stm_mem_new (input,
+                         TEST_DATA_SIZE,
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  pdf_stm_enable_stats (stm, PDF_TRUE);
+  fail_unless (pdf_stm_read_char (stm, &ret_char, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_get_stats (stm,
+                                  &stats,
+                                  &filter_stats,
+                                  1,
+                                  &error) == PDF_TRUE);
+  fail_unless (stats.n_be_reads > 0);
+  fail_unless (filter_stats.bytes_out > 0);
+
+  pdf_stm_enable_stats (stm, PDF_TRUE);
+  fail_unless (pdf_stm_get_stats (stm,
+                                  &stats,
+                                  &filter_stats,
+                                  1,
+                                  &error) == PDF_TRUE);
+  fail_unless (stats.n_be_reads == 0);
+  fail_unless (stats.be_read_bytes == 0);
+  fail_unless (filter_stats.n_applies == 0);
+  fail_unless (filter_stats.bytes_out == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (input);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_get_stats (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_get_stats");
+
+  tcase_add_test (tc, pdf_stm_get_stats_001);
+  tcase_add_test (tc, pdf_stm_get_stats_002);
+  tcase_add_test (tc, pdf_stm_get_stats_003);
+  tcase_add_test (tc, pdf_stm_get_stats_004);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-get-stats.c */
@@ -0,0 +1,194 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-install-filter-chain.c
+ *       Date:         Sat Oct 17 16:02:11 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_install_filter_chain
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+/* "aaaa", RunLength encoded and then ASCII Hex encoded */
+#define ENCODED "FD6180>"
+
+static const struct pdf_stm_filter_spec_s filters[] = {
+  { PDF_STM_FILTER_AHEX_DEC, NULL },
+  { PDF_STM_FILTER_RL_DEC, NULL }
+};
+
+static void
+read_and_check (pdf_stm_filter_chain_t *chain)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t buf[16];
+  pdf_size_t read_bytes;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)ENCODED,
+                         strlen (ENCODED),
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_install_filter_chain (stm, chain, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read (stm, buf, 4, &read_bytes, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 4);
+  fail_unless (memcmp (buf, "aaaa", 4) == 0);
+
+  /* No more data */
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 0);
+
+  pdf_stm_destroy (stm);
+}
+
+/*
+ * Test: pdf_stm_install_filter_chain_001
+ * Description:
+ *   Install a chain of two decoders in a memory stream.
+ * Success condition:
+ *   The filters should be applied in the order of the chain.
+ */
+START_TEST (pdf_stm_install_filter_chain_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_filter_chain_t *chain;
+
+  chain = pdf_stm_filter_chain_new (filters, 2, &error);
+  fail_unless (chain != NULL);
+  fail_if (error != NULL);
+
+  read_and_check (chain);
+
+  pdf_stm_filter_chain_destroy (chain);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_install_filter_chain_002
+ * Description:
+ *   Install the same chain in several streams.
+ * Success condition:
+ *   Every stream should decode its data.
+ */
+START_TEST (pdf_stm_install_filter_chain_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_filter_chain_t *chain;
+  int i;
+
+  chain = pdf_stm_filter_chain_new (filters, 2, &error);
+  fail_unless (chain != NULL);
+  fail_if (error != NULL);
+
+  for (i = 0; i < 3; i++)
+    read_and_check (chain);
+
+  pdf_stm_filter_chain_destroy (chain);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_install_filter_chain_003
+ * Description:
+ *   Create a chain with a filter which is not supported.
+ * Success condition:
+ *   The chain should not be created, reporting an error.
+ */
+START_TEST (pdf_stm_install_filter_chain_003)
+{
+  pdf_error_t *error = NULL;
+  struct pdf_stm_filter_spec_s unsupported[] = {
+    { PDF_STM_FILTER_AHEX_DEC, NULL },
+    { PDF_STM_FILTER_JPX_DEC, NULL }
+  };
+
+  fail_unless (pdf_stm_filter_chain_new (unsupported, 2, &error) == NULL);
+  fail_unless (error != NULL);
+  pdf_error_destroy (error);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_install_filter_chain_004
+ * Description:
+ *   Install an empty chain.
+ * Success condition:
+ *   The stream should return the data unchanged.
+ */
+START_TEST (pdf_stm_install_filter_chain_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_filter_chain_t *chain;
+  pdf_stm_t *stm;
+  pdf_uchar_t buf[16];
+  pdf_size_t read_bytes;
+
+  chain = pdf_stm_filter_chain_new (NULL, 0, &error);
+  fail_unless (chain != NULL);
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)ENCODED,
+                         strlen (ENCODED),
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter_chain (stm, chain, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_read (stm, buf, strlen (ENCODED), &read_bytes,
+                             &error) == PDF_TRUE);
+  fail_unless (read_bytes == strlen (ENCODED));
+  fail_unless (memcmp (buf, ENCODED, read_bytes) == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_stm_filter_chain_destroy (chain);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_install_filter_chain (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_install_filter_chain");
+
+  tcase_add_test (tc, pdf_stm_install_filter_chain_001);
+  tcase_add_test (tc, pdf_stm_install_filter_chain_002);
+  tcase_add_test (tc, pdf_stm_install_filter_chain_003);
+  tcase_add_test (tc, pdf_stm_install_filter_chain_004);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-install-filter-chain.c */
@@ -0,0 +1,168 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-mem-reset.c
+ *       Date:         Sat Oct 17 21:12:08 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_mem_reset
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+/* Compress DATA with the FLATE encoder into ENCODED, returning the
+ * size of the compressed data */
+static pdf_size_t
+flate_encode (const pdf_char_t *data,
+              pdf_uchar_t      *encoded,
+              pdf_size_t        size)
+{
+  pdf_error_t *error = NULL;
+  pdf_size_t encoded_size;
+  pdf_stm_t *stm;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)data, strlen (data), 0,
+                         PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_ENC, NULL,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, encoded, size, &encoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (encoded_size > 0 && encoded_size < size);
+  pdf_stm_destroy (stm);
+
+  return encoded_size;
+}
+
+/*
+ * Test: pdf_stm_mem_reset_001
+ * Description:
+ *   Decode two FLATE encoded buffers with the same stream, leaving the
+ *   first one half read.
+ * Success condition:
+ *   The second buffer should be decoded from its start.
+ */
+START_TEST (pdf_stm_mem_reset_001)
+{
+  const pdf_char_t *first = "GNU PDF library, GNU PDF library";
+  const pdf_char_t *second = "Portable Document Format";
+  pdf_error_t *error = NULL;
+  pdf_uchar_t encoded1[128];
+  pdf_uchar_t encoded2[128];
+  pdf_uchar_t buf[64];
+  pdf_size_t size1;
+  pdf_size_t size2;
+  pdf_size_t read_bytes;
+  pdf_stm_t *stm;
+
+  size1 = flate_encode (first, encoded1, sizeof (encoded1));
+  size2 = flate_encode (second, encoded2, sizeof (encoded2));
+
+  stm = pdf_stm_mem_new (encoded1, size1, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_DEC, NULL,
+                                       &error) == PDF_TRUE);
+
+  fail_unless (pdf_stm_read (stm, buf, 3, &read_bytes, &error) == PDF_TRUE);
+  fail_unless (read_bytes == 3);
+  fail_unless (memcmp (buf, first, 3) == 0);
+
+  fail_unless (pdf_stm_mem_reset (stm, encoded2, size2, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_tell (stm) == 0);
+
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == strlen (second));
+  fail_unless (memcmp (buf, second, read_bytes) == 0);
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_mem_reset_002
+ * Description:
+ *   Write ASCII Hex encoded data into a buffer, then reset the stream
+ *   to another buffer and write other data.
+ * Success condition:
+ *   Each buffer should only hold the data written before its reset.
+ */
+START_TEST (pdf_stm_mem_reset_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_uchar_t buf1[16];
+  pdf_uchar_t buf2[16];
+  pdf_size_t written_bytes;
+  pdf_size_t flushed_bytes;
+  pdf_stm_t *stm;
+
+  memset (buf1, 0, sizeof (buf1));
+  memset (buf2, 0, sizeof (buf2));
+
+  stm = pdf_stm_mem_new (buf1, sizeof (buf1), 0, PDF_STM_WRITE, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_AHEX_ENC, NULL,
+                                       &error) == PDF_TRUE);
+
+  fail_unless (pdf_stm_write (stm, (const pdf_uchar_t *)"AB", 2,
+                              &written_bytes, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_flush (stm, PDF_TRUE, &flushed_bytes,
+                              &error) == PDF_TRUE);
+
+  fail_unless (pdf_stm_mem_reset (stm, buf2, sizeof (buf2),
+                                  &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_write (stm, (const pdf_uchar_t *)"CD", 2,
+                              &written_bytes, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_flush (stm, PDF_TRUE, &flushed_bytes,
+                              &error) == PDF_TRUE);
+
+  fail_unless (memcmp (buf1, "4142>", 5) == 0);
+  fail_unless (buf1[5] == 0);
+  fail_unless (memcmp (buf2, "4344>", 5) == 0);
+  fail_unless (buf2[5] == 0);
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_mem_reset (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_mem_reset");
+
+  tcase_add_test (tc, pdf_stm_mem_reset_001);
+  tcase_add_test (tc, pdf_stm_mem_reset_002);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-mem-reset.c */
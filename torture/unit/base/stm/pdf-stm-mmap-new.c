@@ -0,0 +1,220 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-mmap-new.c
+ *       Date:         Sat Oct 17 11:02:19 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_mmap_new
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+static const pdf_char_t *contents = "0123456789abcdef";
+
+/* Create a test file with the given contents and open it for reading */
+static pdf_fsys_file_t *
+open_test_file (pdf_text_t       **path,
+                const pdf_char_t  *data,
+                pdf_size_t         size)
+{
+  const pdf_char_t *filename = "tmp.test";
+  pdf_error_t *error = NULL;
+  pdf_fsys_file_t *file;
+  pdf_size_t written_bytes;
+
+  *path = pdf_text_new_from_unicode (filename, strlen (filename),
+                                     PDF_TEXT_UTF8,
+                                     &error);
+  fail_unless (*path != NULL);
+  fail_if (error != NULL);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             *path,
+                             PDF_FSYS_OPEN_MODE_WRITE,
+                             &error);
+  fail_unless (file != NULL);
+  fail_if (error != NULL);
+  if (size > 0)
+    {
+      fail_unless (pdf_fsys_file_write (file, data, size,
+                                        &written_bytes,
+                                        &error) == PDF_TRUE);
+      fail_unless (written_bytes == size);
+    }
+  fail_unless (pdf_fsys_file_close (file, &error) == PDF_TRUE);
+
+  file = pdf_fsys_file_open (PDF_FSYS_DISK,
+                             *path,
+                             PDF_FSYS_OPEN_MODE_READ,
+                             &error);
+  fail_unless (file != NULL);
+  fail_if (error != NULL);
+
+  return file;
+}
+
+/*
+ * Test: pdf_stm_mmap_new_001
+ * Description:
+ *   Create a new mapped stream with sequential access and read the
+ *   whole file.
+ * Success condition:
+ *   The stream should be created and the data read should be equal to
+ *   the contents of the file.
+ */
+START_TEST (pdf_stm_mmap_new_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_uchar_t buf[32];
+  pdf_size_t read_bytes;
+
+  file = open_test_file (&path, contents, strlen (contents));
+
+  /* Create the stream */
+  stm = pdf_stm_mmap_new (file,
+                          0,
+                          0, /* Use the default cache size */
+                          PDF_FSYS_ACCESS_SEQUENTIAL,
+                          &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_get_mode (stm) == PDF_STM_READ);
+
+  /* Read more than available: EOF without error */
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf),
+                             &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == strlen (contents));
+  fail_unless (memcmp (buf, contents, read_bytes) == 0);
+
+  /* Free all resources */
+  pdf_stm_destroy (stm);
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_mmap_new_002
+ * Description:
+ *   Create a new mapped stream with random access and read all
+ *   characters in reverse order, seeking before each one.
+ * Success condition:
+ *   Each character read should be the one at the seeked offset.
+ */
+START_TEST (pdf_stm_mmap_new_002)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_uchar_t ret_char;
+  int i;
+
+  file = open_test_file (&path, contents, strlen (contents));
+
+  /* Create the stream */
+  stm = pdf_stm_mmap_new (file,
+                          0,
+                          0, /* Use the default cache size */
+                          PDF_FSYS_ACCESS_RANDOM,
+                          &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  for (i = strlen (contents) - 1; i >= 0; i--)
+    {
+      fail_unless (pdf_stm_bseek (stm, i) == i);
+      fail_unless (pdf_stm_read_char (stm, &ret_char, &error) == PDF_TRUE);
+      fail_if (error != NULL);
+      fail_unless (ret_char == contents[i]);
+      fail_unless (pdf_stm_btell (stm) == (pdf_off_t)(i + 1));
+    }
+
+  /* Free all resources */
+  pdf_stm_destroy (stm);
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_mmap_new_003
+ * Description:
+ *   Create a new mapped stream over an empty file.
+ * Success condition:
+ *   The stream should be created and reading from it should report
+ *   EOF without error.
+ */
+START_TEST (pdf_stm_mmap_new_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_fsys_file_t *file;
+  pdf_text_t *path;
+  pdf_uchar_t ret_char;
+
+  file = open_test_file (&path, NULL, 0);
+
+  /* Create the stream */
+  stm = pdf_stm_mmap_new (file,
+                          0,
+                          0, /* Use the default cache size */
+                          PDF_FSYS_ACCESS_NORMAL,
+                          &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read_char (stm, &ret_char, &error) == PDF_FALSE);
+  fail_if (error != NULL);
+
+  /* Free all resources */
+  pdf_stm_destroy (stm);
+  pdf_fsys_file_close (file, NULL);
+  pdf_text_destroy (path);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_mmap_new (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_mmap_new");
+
+  tcase_add_test (tc, pdf_stm_mmap_new_001);
+  tcase_add_test (tc, pdf_stm_mmap_new_002);
+  tcase_add_test (tc, pdf_stm_mmap_new_003);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-mmap-new.c */
@@ -0,0 +1,179 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-read-view.c
+ *       Date:         Sat Oct 17 10:12:43 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_read_view
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+/*
+ * Test: pdf_stm_read_view_001
+ * Description:
+ *   Read all the contents of a memory stream through views, using a
+ *   cache smaller than the input.
+ * Success condition:
+ *   The concatenated views should be equal to the input, and EOF should be
+ *   reported without error.
+ */
+START_TEST (pdf_stm_read_view_001)
+{
+  const pdf_char_t *input = "0123456789";
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  const pdf_uchar_t *data;
+  pdf_size_t data_size;
+  pdf_char_t output[11] = { 0 };
+  pdf_size_t total = 0;
+
+  /* Create the stream, with a 4 bytes cache */
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)input,
+                         strlen (input),
+                         4,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  while (pdf_stm_read_view (stm, &data, &data_size, &error))
+    {
+      fail_unless (data != NULL);
+      fail_unless (data_size > 0);
+      fail_unless (data_size <= 4);
+      fail_unless (total + data_size <= strlen (input));
+
+      memcpy (&output[total], data, data_size);
+      total += data_size;
+
+      fail_unless (pdf_stm_consume (stm, data_size, &error) == PDF_TRUE);
+      fail_if (error != NULL);
+    }
+
+  /* EOF, no error */
+  fail_if (error != NULL);
+  fail_unless (data == NULL);
+  fail_unless (data_size == 0);
+
+  fail_unless (total == strlen (input));
+  fail_unless (memcmp (output, input, total) == 0);
+  fail_unless (pdf_stm_tell (stm) == strlen (input));
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_read_view_002
+ * Description:
+ *   Get two views from a memory stream without consuming data.
+ * Success condition:
+ *   Both views should be equal and the stream offset shouldn't change.
+ */
+START_TEST (pdf_stm_read_view_002)
+{
+  const pdf_char_t *input = "GNU's Not Unix";
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  const pdf_uchar_t *data1;
+  const pdf_uchar_t *data2;
+  pdf_size_t data_size1;
+  pdf_size_t data_size2;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)input,
+                         strlen (input),
+                         0, /* Use the default cache size */
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read_view (stm, &data1, &data_size1, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  fail_unless (pdf_stm_read_view (stm, &data2, &data_size2, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (data1 == data2);
+  fail_unless (data_size1 == strlen (input));
+  fail_unless (data_size2 == data_size1);
+  fail_unless (memcmp (data1, input, data_size1) == 0);
+  fail_unless (pdf_stm_tell (stm) == 0);
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_read_view_003
+ * Description:
+ *   Try to get a view from a writing stream.
+ * Success condition:
+ *   PDF_FALSE should be returned, with a PDF_EINVOP error.
+ */
+START_TEST (pdf_stm_read_view_003)
+{
+  pdf_uchar_t buffer[16];
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  const pdf_uchar_t *data;
+  pdf_size_t data_size;
+
+  stm = pdf_stm_mem_new (buffer,
+                         sizeof (buffer),
+                         0, /* Use the default cache size */
+                         PDF_STM_WRITE,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read_view (stm, &data, &data_size, &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EINVOP);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_read_view (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_read_view");
+
+  tcase_add_test (tc, pdf_stm_read_view_001);
+  tcase_add_test (tc, pdf_stm_read_view_002);
+  tcase_add_test (tc, pdf_stm_read_view_003);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-read-view.c */
@@ -0,0 +1,334 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-reset.c
+ *       Date:         Sat Oct 17 17:21:45 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_reset
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+
+#define DECODED "GNU PDF library, GNU PDF library, GNU PDF library"
+
+/*
+ * Test: pdf_stm_reset_001
+ * Description:
+ *   Read a FLATE encoded memory stream twice, resetting it in between.
+ * Success condition:
+ *   Both reads should return the decoded data.
+ */
+START_TEST (pdf_stm_reset_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_uchar_t encoded[256];
+  pdf_uchar_t buf[sizeof (DECODED)];
+  pdf_size_t written_bytes;
+  pdf_size_t read_bytes;
+  pdf_stm_t *stm;
+  int i;
+
+  /* Encode the data */
+  memset (encoded, 0, sizeof (encoded));
+  stm = pdf_stm_mem_new (encoded, sizeof (encoded), 0, PDF_STM_WRITE, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_ENC, NULL,
+                                       &error) == PDF_TRUE);
+  fail_unless (pdf_stm_write (stm, (const pdf_uchar_t *)DECODED,
+                              strlen (DECODED),
+                              &written_bytes,
+                              &error) == PDF_TRUE);
+  pdf_stm_destroy (stm);
+
+  stm = pdf_stm_mem_new (encoded, sizeof (encoded), 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_DEC, NULL,
+                                       &error) == PDF_TRUE);
+
+  for (i = 0; i < 2; i++)
+    {
+      fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                                 &error) == PDF_FALSE);
+      fail_if (error != NULL);
+      fail_unless (read_bytes == strlen (DECODED));
+      fail_unless (memcmp (buf, DECODED, read_bytes) == 0);
+
+      fail_unless (pdf_stm_reset (stm, 0, &error) == PDF_TRUE);
+      fail_if (error != NULL);
+      fail_unless (pdf_stm_tell (stm) == 0);
+    }
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_reset_002
+ * Description:
+ *   Reset a stream with a chain of filters to decode the data at
+ *   another position of the backend.
+ * Success condition:
+ *   The data at the new position should be decoded.
+ */
+START_TEST (pdf_stm_reset_002)
+{
+  pdf_error_t *error = NULL;
+  /* "aaaa" and "bbbbbb", RunLength encoded and then ASCII Hex encoded */
+  pdf_char_t *encoded = "FD6180>FB6280>";
+  pdf_uchar_t buf[8];
+  pdf_size_t read_bytes;
+  pdf_stm_t *stm;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)encoded, strlen (encoded), 0,
+                         PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_AHEX_DEC, NULL,
+                                       &error) == PDF_TRUE);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_RL_DEC, NULL,
+                                       &error) == PDF_TRUE);
+
+  /* Leave the first data half read */
+  fail_unless (pdf_stm_read (stm, buf, 2, &read_bytes, &error) == PDF_TRUE);
+  fail_unless (memcmp (buf, "aa", 2) == 0);
+
+  fail_unless (pdf_stm_reset (stm, 7, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                             &error) == PDF_FALSE);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == 6);
+  fail_unless (memcmp (buf, "bbbbbb", 6) == 0);
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_reset_003
+ * Description:
+ *   Reset a stream with a filter which cannot be reset.
+ * Success condition:
+ *   The call should fail with PDF_EINVOP.
+ */
+#if defined PDF_HAVE_LIBJPEG
+START_TEST (pdf_stm_reset_003)
+{
+  pdf_error_t *error = NULL;
+  pdf_uchar_t buffer[16];
+  pdf_stm_t *stm;
+
+  memset (buffer, 0, sizeof (buffer));
+  stm = pdf_stm_mem_new (buffer, sizeof (buffer), 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_DCT_DEC, NULL,
+                                       &error) == PDF_TRUE);
+
+  fail_unless (pdf_stm_reset (stm, 0, &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EINVOP);
+  pdf_error_destroy (error);
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+#endif /* PDF_HAVE_LIBJPEG */
+
+/* Install the AESv2 encoder or decoder, with a fixed key */
+static void
+install_aesv2_filter (pdf_stm_t                  *stm,
+                      enum pdf_stm_filter_type_e  type)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add (params, "Key", "0123456789abcdef", NULL,
+                             &error) == PDF_TRUE);
+  fail_unless (pdf_hash_add_size (params, "KeySize", 16,
+                                  &error) == PDF_TRUE);
+  fail_unless (pdf_stm_install_filter (stm, type, params,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  pdf_hash_destroy (params);
+}
+
+/* Install the PNG Up predictor encoder or decoder, for rows of 8
+ * octets */
+static void
+install_pred_filter (pdf_stm_t                  *stm,
+                     enum pdf_stm_filter_type_e  type)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params, "Predictor", 12,
+                                  &error) == PDF_TRUE);
+  fail_unless (pdf_hash_add_size (params, "Colors", 1, &error) == PDF_TRUE);
+  fail_unless (pdf_hash_add_size (params, "BitsPerComponent", 8,
+                                  &error) == PDF_TRUE);
+  fail_unless (pdf_hash_add_size (params, "Columns", 8, &error) == PDF_TRUE);
+  fail_unless (pdf_stm_install_filter (stm, type, params,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  pdf_hash_destroy (params);
+}
+
+/*
+ * Test: pdf_stm_reset_004
+ * Description:
+ *   Read data encrypted with AESv2, compressed with FLATE and encoded
+ *   with the PNG Up predictor twice, resetting the stream after reading
+ *   only part of it.
+ * Success condition:
+ *   Both reads should return the decoded data.
+ */
+START_TEST (pdf_stm_reset_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_uchar_t decoded[64];
+  pdf_uchar_t encoded[256];
+  pdf_uchar_t buf[sizeof (decoded)];
+  pdf_size_t encoded_size;
+  pdf_size_t read_bytes;
+  pdf_stm_t *stm;
+  int i;
+
+  /* Ramps: 8 rows of 8 octets */
+  for (i = 0; i < sizeof (decoded); i++)
+    decoded[i] = i;
+
+  /* Encode the data, filters applied from the last installed one */
+  stm = pdf_stm_mem_new (decoded, sizeof (decoded), 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  install_pred_filter (stm, PDF_STM_FILTER_PRED_ENC);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_ENC, NULL,
+                                       &error) == PDF_TRUE);
+  install_aesv2_filter (stm, PDF_STM_FILTER_AESV2_ENC);
+  pdf_stm_read (stm, encoded, sizeof (encoded), &encoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (encoded_size > 0 && encoded_size < sizeof (encoded));
+  pdf_stm_destroy (stm);
+
+  stm = pdf_stm_mem_new (encoded, encoded_size, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  install_aesv2_filter (stm, PDF_STM_FILTER_AESV2_DEC);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_DEC, NULL,
+                                       &error) == PDF_TRUE);
+  install_pred_filter (stm, PDF_STM_FILTER_PRED_DEC);
+
+  /* Leave the data half read */
+  fail_unless (pdf_stm_read (stm, buf, 20, &read_bytes,
+                             &error) == PDF_TRUE);
+  fail_unless (read_bytes == 20);
+  fail_unless (memcmp (buf, decoded, read_bytes) == 0);
+
+  for (i = 0; i < 2; i++)
+    {
+      fail_unless (pdf_stm_reset (stm, 0, &error) == PDF_TRUE);
+      fail_if (error != NULL);
+
+      fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                                 &error) == PDF_TRUE);
+      fail_if (error != NULL);
+      fail_unless (read_bytes == sizeof (decoded));
+      fail_unless (memcmp (buf, decoded, read_bytes) == 0);
+    }
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_reset_005
+ * Description:
+ *   Compute the MD5 hash of some data, then reset the stream to the
+ *   middle of the data and compute the hash again.
+ * Success condition:
+ *   The second hash should only cover the data after the reset
+ *   position.
+ */
+START_TEST (pdf_stm_reset_005)
+{
+  pdf_error_t *error = NULL;
+  /* MD5 of "abc" */
+  pdf_uchar_t expected[16] =
+    {
+      0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0,
+      0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72
+    };
+  pdf_char_t *data = "xyzabc";
+  pdf_uchar_t buf[16];
+  pdf_size_t read_bytes;
+  pdf_stm_t *stm;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)data, strlen (data), 1,
+                         PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_MD5_ENC, NULL,
+                                       &error) == PDF_TRUE);
+
+  /* Hash the whole data first */
+  pdf_stm_read (stm, buf, sizeof (buf), &read_bytes, &error);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == sizeof (expected));
+  fail_if (memcmp (buf, expected, sizeof (expected)) == 0);
+
+  fail_unless (pdf_stm_reset (stm, 3, &error) == PDF_TRUE);
+  fail_if (error != NULL);
+
+  pdf_stm_read (stm, buf, sizeof (buf), &read_bytes, &error);
+  fail_if (error != NULL);
+  fail_unless (read_bytes == sizeof (expected));
+  fail_unless (memcmp (buf, expected, sizeof (expected)) == 0);
+
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test case creation function
+ */
+TCase *
+test_pdf_stm_reset (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_reset");
+
+  tcase_add_test (tc, pdf_stm_reset_001);
+  tcase_add_test (tc, pdf_stm_reset_002);
+#if defined PDF_HAVE_LIBJPEG
+  tcase_add_test (tc, pdf_stm_reset_003);
+#endif /* PDF_HAVE_LIBJPEG */
+  tcase_add_test (tc, pdf_stm_reset_004);
+  tcase_add_test (tc, pdf_stm_reset_005);
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-reset.c */
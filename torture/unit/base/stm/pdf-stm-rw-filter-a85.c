@@ -243,6 +243,16 @@ static const struct test_strings_s test_strings[] = {
     0, NULL,
     PDF_FALSE
   },
+  {
+    /* Long enough for the bulk encoding and decoding, with a line break */
+    108,
+    "<+ohcEHPu*CER),Dg-(AAoDo:C3=B4F!,CEATAo8BOr<&@=!2AA8c)\\z!!!!A@;]TuFD,6'+E)F7EZf\n"
+    "I;AKYetH?gWC@<=%CFE_G/+d;s~>",
+    87,
+    "The quick brown fox jumps over the lazy dog"
+    "\0\0\0\0\0\0\0\0 and then over the lazy cat, twice!!",
+    PDF_TRUE
+  },
   { 0, NULL, 0, NULL }
 };
 
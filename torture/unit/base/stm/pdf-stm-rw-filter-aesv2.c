@@ -57,6 +57,19 @@ static const struct test_strings_s test_strings[] = {
     16,
     "\x00\x11\x22\x33\x44\x55\x66\x77\x88\x99\xAA\xBB\xCC\xDD\xEE\xFF"
   },
+  /* Several blocks, the last one partly padded */
+  {
+    64,
+    "\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55"  /* iv vector*/
+    "\xBE\x73\x8D\xEC\x65\x9D\xCE\x5A\xE4\x75\xA1\x43\xD8\xAE\x95\xBA"  /* content */
+    "\xFC\xB7\xFB\x9D\xA7\x51\x37\x8D\x65\x6C\x45\x19\xB6\xBD\x72\xFB"
+    "\x6B\x73\x17\x71\x29\x75\x89\x88\x7A\x64\xFF\xC6\x4B\x62\x53\xD7", /* padding */
+    56,
+    "\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55" /* iv */
+    " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFG",                      /* content */
+    16,
+    "\x00\x11\x22\x33\x44\x55\x66\x77\x88\x99\xAA\xBB\xCC\xDD\xEE\xFF"
+  },
   { 0, NULL, 0, NULL, 0, NULL }
 };
 
@@ -85,6 +98,11 @@ static const struct test_params_s tests_params[] = {
   {	 18,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
   {	 19,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
   {	 20,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {	 21,  TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  1 },
+  {	 22,  TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  5 },
+  {	 23,  TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  1 },
+  {	 24,  TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  5 },
 };
 
 static void
@@ -175,6 +193,20 @@ START_TEST (pdf_stm_write_filter_aesv2_enc_003) { common_test_aesv2 (__FUNCTION_
 START_TEST (pdf_stm_write_filter_aesv2_enc_004) { common_test_aesv2 (__FUNCTION__, 19); } END_TEST
 START_TEST (pdf_stm_write_filter_aesv2_enc_005) { common_test_aesv2 (__FUNCTION__, 20); } END_TEST
 
+/*
+ * Test: pdf_stm_read_filter_aesv2_dec_cache_001-002,
+ *       pdf_stm_read_filter_aesv2_enc_cache_001-002
+ * Description:
+ *   Test AESV2 decoder and encoder filters on several blocks, with
+ *   stream caches smaller than a block.
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_aesv2_dec_cache_001) { common_test_aesv2 (__FUNCTION__, 21); } END_TEST
+START_TEST (pdf_stm_read_filter_aesv2_dec_cache_002) { common_test_aesv2 (__FUNCTION__, 22); } END_TEST
+START_TEST (pdf_stm_read_filter_aesv2_enc_cache_001) { common_test_aesv2 (__FUNCTION__, 23); } END_TEST
+START_TEST (pdf_stm_read_filter_aesv2_enc_cache_002) { common_test_aesv2 (__FUNCTION__, 24); } END_TEST
+
 /*
  * Test case creation functions
  */
@@ -208,6 +240,11 @@ test_pdf_stm_rw_filter_aesv2 (void)
   tcase_add_test (tc, pdf_stm_write_filter_aesv2_enc_004);
   tcase_add_test (tc, pdf_stm_write_filter_aesv2_enc_005);
 
+  tcase_add_test (tc, pdf_stm_read_filter_aesv2_dec_cache_001);
+  tcase_add_test (tc, pdf_stm_read_filter_aesv2_dec_cache_002);
+  tcase_add_test (tc, pdf_stm_read_filter_aesv2_enc_cache_001);
+  tcase_add_test (tc, pdf_stm_read_filter_aesv2_enc_cache_002);
+
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
@@ -58,6 +58,29 @@ static const struct test_strings_s test_strings[] = {
     3, "ab`",
     PDF_FALSE
   },
+  /* Long enough for the bulk encoding and decoding */
+  {
+    104,
+    "54686520717569636B2062726F776E20666F78206A756D7073206F766572\n"
+    "20746865206C617A7920646F672C20747769636521>",
+    51, "The quick brown fox jumps over the lazy dog, twice!",
+    PDF_TRUE
+  },
+  {
+    106,
+    "54686520717569636b2062726f776e20666f7820\r\n6 A756D7073206F766572"
+    "20746865206C617A7920646F672C20747769636521>",
+    51, "The quick brown fox jumps over the lazy dog, twice!",
+    PDF_FALSE
+  },
+  /* Digits paired across white characters in the bulk decoding */
+  {
+    129,
+    "5 46865207175\t69636B2062726F776E20666F78206A756D7073206F766572\n"
+    "2                    0\r\n74686\0" "5206C617A7920646F672C20747769636521>",
+    51, "The quick brown fox jumps over the lazy dog, twice!",
+    PDF_FALSE
+  },
   { 0, NULL, 0, NULL }
 };
 
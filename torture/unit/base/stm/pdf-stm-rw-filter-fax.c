@@ -0,0 +1,244 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-rw-filter-fax.c
+ *       Date:         Sat Oct 17 19:40:12 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_read() and pdf_stm_write()
+ *                         with CCITT Fax filter.
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+#include "pdf-stm-test-common.h"
+
+struct test_strings_s {
+  /* Coding parameters */
+  pdf_i32_t k;
+  pdf_bool_t end_of_line;
+  pdf_bool_t encoded_byte_align;
+  pdf_size_t columns;
+  pdf_size_t rows;
+  pdf_bool_t end_of_block;
+  pdf_bool_t black_is_1;
+  /* Encoded string */
+  pdf_size_t encoded_size;
+  const pdf_char_t *encoded;
+  /* Decoded string */
+  pdf_size_t decoded_size;
+  const pdf_char_t *decoded;
+};
+
+/* The same 24x6 image, black pixels being 0 bits unless BlackIs1:
+ *
+ *   ........................
+ *   ..XXXX....XX.......XXX..
+ *   ..X..X...XXXX.....X...X.
+ *   ..XXXX..XX..XX....X...X.
+ *   ..X.....XXXXXX.....XXX..
+ *   ..X.....XX..XX.XXXXXXXXX
+ */
+static const struct test_strings_s test_strings[] = {
+  /* Group 4, ending with an end of facsimile block */
+  {
+    -1, PDF_FALSE, PDF_FALSE, 24, 0, PDF_TRUE, PDF_FALSE,
+    23,
+    "\x97\x66\xf3\xf6\x08\xba\x4d\x02\x09\x63\x40\x8b\xff\x82\x8d\xaf"
+    "\x3b\xc8\xe2\x00\x08\x00\x80",
+    18, "\xff\xff\xff\xc3\xcf\xe3\xdb\x87\xdd\xc3\x33\xdd\xdf\x03\xe3\xdf\x32\x00"
+  },
+  /* Group 3 one-dimensional, rows preceded by end of lines */
+  {
+    0, PDF_TRUE, PDF_FALSE, 24, 0, PDF_TRUE, PDF_FALSE,
+    30,
+    "\x00\x15\x00\x02\xee\xff\x9c\x00\x5d\x3a\x87\x8a\x10\xe0\x02\xed"
+    "\xf7\xed\x42\x1c\x00\x5d\x61\x64\xe0\x02\xeb\x37\xc7\x10",
+    18, "\xff\xff\xff\xc3\xcf\xe3\xdb\x87\xdd\xc3\x33\xdd\xdf\x03\xe3\xdf\x32\x00"
+  },
+  /* Group 3 two-dimensional */
+  {
+    2, PDF_TRUE, PDF_FALSE, 24, 0, PDF_TRUE, PDF_FALSE,
+    30,
+    "\x00\x1a\x80\x01\x17\x66\xf3\xf4\x00\x6e\x9d\x43\xc5\x08\x70\x01"
+    "\x46\x81\x17\xfe\x00\x37\x58\x59\x38\x00\xb9\xde\x47\x10",
+    18, "\xff\xff\xff\xc3\xcf\xe3\xdb\x87\xdd\xc3\x33\xdd\xdf\x03\xe3\xdf\x32\x00"
+  },
+  /* Group 3 one-dimensional, rows aligned on bytes without end of
+   * lines */
+  {
+    0, PDF_FALSE, PDF_TRUE, 24, 0, PDF_TRUE, PDF_FALSE,
+    23,
+    "\x50\x77\x7f\xce\x74\xea\x1e\x28\x43\x80\x76\xfb\xf6\xa1\x0e\x75"
+    "\x85\x93\x80\x75\x9b\xe3\x88",
+    18, "\xff\xff\xff\xc3\xcf\xe3\xdb\x87\xdd\xc3\x33\xdd\xdf\x03\xe3\xdf\x32\x00"
+  },
+  /* Group 3 one-dimensional, rows aligned on bytes and preceded by
+   * end of lines padded to end on bytes, although not required */
+  {
+    0, PDF_FALSE, PDF_TRUE, 24, 0, PDF_TRUE, PDF_FALSE,
+    43,
+    "\x00\x01\x50\x00\x01\x77\x7f\xce\x00\x01\x74\xea\x1e\x28\x43\x80"
+    "\x01\x76\xfb\xf6\xa1\x0e\x00\x01\x75\x85\x93\x80\x01\x75\x9b\xe3"
+    "\x88\x00\x08\x00\x80\x08\x00\x80\x08\x00\x80",
+    18, "\xff\xff\xff\xc3\xcf\xe3\xdb\x87\xdd\xc3\x33\xdd\xdf\x03\xe3\xdf\x32\x00"
+  },
+  /* Group 4 with a number of rows given, black pixels being 1 bits */
+  {
+    -1, PDF_FALSE, PDF_FALSE, 24, 6, PDF_FALSE, PDF_TRUE,
+    23,
+    "\x97\x66\xf3\xf6\x08\xba\x4d\x02\x09\x63\x40\x8b\xff\x82\x8d\xaf"
+    "\x3b\xc8\xe2\x00\x08\x00\x80",
+    18, "\x00\x00\x00\x3c\x30\x1c\x24\x78\x22\x3c\xcc\x22\x20\xfc\x1c\x20\xcd\xff"
+  },
+  { 0, PDF_FALSE, PDF_FALSE, 0, 0, PDF_FALSE, PDF_FALSE, 0, NULL, 0, NULL }
+};
+
+static const struct test_params_s tests_params[] = {
+  /* No   Test type          Test operation   Loop read size       Cache size */
+  {  1,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_ONE,    0 },
+  {  2,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    0 },
+  {  3,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_HALF,   0 },
+  {  4,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  0 },
+  {  5,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {  6,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_ONE,    0 },
+  {  7,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_TWO,    0 },
+  {  8,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
+  {  9,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
+  { 10,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+};
+
+static pdf_hash_t *
+new_fax_params (const struct test_strings_s *test)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_i32 (params, "K", test->k, &error));
+  fail_unless (pdf_hash_add_bool (params,
+                                  "EndOfLine",
+                                  test->end_of_line,
+                                  &error));
+  fail_unless (pdf_hash_add_bool (params,
+                                  "EncodedByteAlign",
+                                  test->encoded_byte_align,
+                                  &error));
+  fail_unless (pdf_hash_add_size (params, "Columns", test->columns, &error));
+  fail_unless (pdf_hash_add_size (params, "Rows", test->rows, &error));
+  fail_unless (pdf_hash_add_bool (params,
+                                  "EndOfBlock",
+                                  test->end_of_block,
+                                  &error));
+  fail_unless (pdf_hash_add_bool (params,
+                                  "BlackIs1",
+                                  test->black_is_1,
+                                  &error));
+  return params;
+}
+
+static void
+common_test_fax (const pdf_char_t *function_name,
+                 int               test_index)
+{
+  int i;
+  const struct test_params_s *params = &tests_params[test_index - 1];
+
+  /* Sanity check */
+  fail_if (test_index != params->idx);
+
+  for (i = 0; test_strings[i].encoded; i++)
+    {
+      pdf_hash_t *filter_params;
+
+      filter_params = new_fax_params (&test_strings[i]);
+      pdf_stm_test_common (function_name,
+                           params->type,
+                           params->operation,
+                           PDF_STM_FILTER_CCITTFAX_DEC,
+                           filter_params,
+                           params->stm_cache_size,
+                           params->loop_size,
+                           test_strings[i].decoded,
+                           test_strings[i].decoded_size,
+                           test_strings[i].encoded,
+                           test_strings[i].encoded_size);
+      pdf_hash_destroy (filter_params);
+    }
+}
+
+/*
+ * Test: pdf_stm_read_filter_fax_dec_001-005
+ * Description:
+ *   Test CCITT Fax decoder filter with different read loop sizes
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_fax_dec_001) { common_test_fax (__FUNCTION__,  1); } END_TEST
+START_TEST (pdf_stm_read_filter_fax_dec_002) { common_test_fax (__FUNCTION__,  2); } END_TEST
+START_TEST (pdf_stm_read_filter_fax_dec_003) { common_test_fax (__FUNCTION__,  3); } END_TEST
+START_TEST (pdf_stm_read_filter_fax_dec_004) { common_test_fax (__FUNCTION__,  4); } END_TEST
+START_TEST (pdf_stm_read_filter_fax_dec_005) { common_test_fax (__FUNCTION__,  5); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_fax_dec_001-005
+ * Description:
+ *   Test CCITT Fax decoder filter with different write loop sizes
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_fax_dec_001) { common_test_fax (__FUNCTION__,  6); } END_TEST
+START_TEST (pdf_stm_write_filter_fax_dec_002) { common_test_fax (__FUNCTION__,  7); } END_TEST
+START_TEST (pdf_stm_write_filter_fax_dec_003) { common_test_fax (__FUNCTION__,  8); } END_TEST
+START_TEST (pdf_stm_write_filter_fax_dec_004) { common_test_fax (__FUNCTION__,  9); } END_TEST
+START_TEST (pdf_stm_write_filter_fax_dec_005) { common_test_fax (__FUNCTION__, 10); } END_TEST
+
+/*
+ * Test case creation functions
+ */
+
+TCase *
+test_pdf_stm_rw_filter_fax (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_rw_filter_fax");
+
+  tcase_add_test (tc, pdf_stm_read_filter_fax_dec_001);
+  tcase_add_test (tc, pdf_stm_read_filter_fax_dec_002);
+  tcase_add_test (tc, pdf_stm_read_filter_fax_dec_003);
+  tcase_add_test (tc, pdf_stm_read_filter_fax_dec_004);
+  tcase_add_test (tc, pdf_stm_read_filter_fax_dec_005);
+
+  tcase_add_test (tc, pdf_stm_write_filter_fax_dec_001);
+  tcase_add_test (tc, pdf_stm_write_filter_fax_dec_002);
+  tcase_add_test (tc, pdf_stm_write_filter_fax_dec_003);
+  tcase_add_test (tc, pdf_stm_write_filter_fax_dec_004);
+  tcase_add_test (tc, pdf_stm_write_filter_fax_dec_005);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-rw-filter-fax.c */
@@ -182,6 +182,361 @@ START_TEST (pdf_stm_write_filter_flate_enc_003) { common_test_flate (__FUNCTION_
 START_TEST (pdf_stm_write_filter_flate_enc_004) { common_test_flate (__FUNCTION__, 19); } END_TEST
 START_TEST (pdf_stm_write_filter_flate_enc_005) { common_test_flate (__FUNCTION__, 20); } END_TEST
 
+/* Encode the decoded test string with the given encoder parameters,
+ * decode it back and check the result */
+static void
+common_test_flate_params (pdf_size_t level,
+                          pdf_size_t strategy,
+                          pdf_size_t window_bits,
+                          pdf_size_t mem_level)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+  pdf_char_t encoded[2048];
+  pdf_char_t decoded[2048];
+  pdf_size_t encoded_size;
+  pdf_size_t decoded_size;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params, "Level", level, &error));
+  fail_unless (pdf_hash_add_size (params, "Strategy", strategy, &error));
+  fail_unless (pdf_hash_add_size (params, "WindowBits", window_bits, &error));
+  fail_unless (pdf_hash_add_size (params, "MemLevel", mem_level, &error));
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) test_strings[0].decoded,
+                         test_strings[0].decoded_size,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_ENC,
+                                       params,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  pdf_stm_read (stm,
+                (pdf_uchar_t *) encoded,
+                sizeof (encoded),
+                &encoded_size,
+                &error);
+  fail_if (error != NULL);
+  fail_unless (encoded_size > 0);
+  pdf_stm_destroy (stm);
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) encoded,
+                         encoded_size,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_DEC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm,
+                (pdf_uchar_t *) decoded,
+                sizeof (decoded),
+                &decoded_size,
+                &error);
+  fail_if (error != NULL);
+  fail_unless (decoded_size == test_strings[0].decoded_size);
+  fail_unless (memcmp (decoded,
+                       test_strings[0].decoded,
+                       decoded_size) == 0);
+  pdf_stm_destroy (stm);
+
+  pdf_hash_destroy (params);
+}
+
+/*
+ * Test: pdf_stm_read_filter_flate_enc_params_001-003
+ * Description:
+ *   Test FLATE encoder filter with different compression levels,
+ *   strategies, window sizes and memory levels.
+ * Success condition:
+ *   The encoded data should be decoded back to the original data.
+ */
+START_TEST (pdf_stm_read_filter_flate_enc_params_001)
+{
+  /* Fastest compression */
+  common_test_flate_params (1, 0, 15, 8);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_enc_params_002)
+{
+  /* Best compression, filtered */
+  common_test_flate_params (9, 1, 15, 9);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_enc_params_003)
+{
+  /* Run-length encoding with the smallest window and memory */
+  common_test_flate_params (6, 3, 9, 1);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_flate_enc_params_004
+ * Description:
+ *   Install a FLATE encoder filter with an invalid compression level.
+ * Success condition:
+ *   The filter should not be installed, and PDF_EBADDATA be reported.
+ */
+START_TEST (pdf_stm_read_filter_flate_enc_params_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params, "Level", 10, &error));
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) test_strings[0].decoded,
+                         test_strings[0].decoded_size,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_ENC,
+                                       params,
+                                       &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EBADDATA);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+  pdf_hash_destroy (params);
+}
+END_TEST
+
+/* Encode SIZE bytes of sample data compressing blocks of BLOCK_SIZE
+ * bytes in N_THREADS threads, and decode them back */
+static void
+common_test_flate_threads (pdf_size_t n_threads,
+                           pdf_size_t block_size,
+                           pdf_size_t size)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+  pdf_uchar_t *data;
+  pdf_uchar_t *encoded;
+  pdf_uchar_t *decoded;
+  pdf_size_t encoded_size;
+  pdf_size_t decoded_size;
+  pdf_size_t i;
+
+  /* Some repetitive contents, not too easy to compress */
+  data = pdf_alloc (size);
+  encoded = pdf_alloc (2 * size + 64);
+  decoded = pdf_alloc (size + 1);
+  fail_unless (data != NULL && encoded != NULL && decoded != NULL);
+  for (i = 0; i < size; i++)
+    data[i] = (pdf_uchar_t) ((i % 251) ^ (i / 1000) ^ ((i * 7) % 13));
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params, "Threads", n_threads, &error));
+  fail_unless (pdf_hash_add_size (params, "BlockSize", block_size, &error));
+
+  stm = pdf_stm_mem_new (data, size, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_ENC,
+                                       params,
+                                       &error) == PDF_TRUE);
+  fail_if (error != NULL);
+  pdf_stm_read (stm, encoded, 2 * size + 64, &encoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (encoded_size > 0);
+  pdf_stm_destroy (stm);
+
+  stm = pdf_stm_mem_new (encoded, encoded_size, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_DEC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, decoded, size + 1, &decoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (decoded_size == size);
+  fail_unless (memcmp (decoded, data, size) == 0);
+  pdf_stm_destroy (stm);
+
+  pdf_hash_destroy (params);
+  pdf_dealloc (decoded);
+  pdf_dealloc (encoded);
+  pdf_dealloc (data);
+}
+
+/*
+ * Test: pdf_stm_read_filter_flate_enc_threads_001-003
+ * Description:
+ *   Test FLATE encoder filter compressing blocks in parallel, with
+ *   inputs spanning several batches of blocks.
+ * Success condition:
+ *   The encoded data should be decoded back to the original data.
+ */
+START_TEST (pdf_stm_read_filter_flate_enc_threads_001)
+{
+  /* Several batches, the last block being partial */
+  common_test_flate_threads (4, 16384, 300000);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_enc_threads_002)
+{
+  /* Input ending exactly at the end of a batch */
+  common_test_flate_threads (2, 16384, 4 * 16384);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_enc_threads_003)
+{
+  /* As many blocks as the job pool can run, smaller than one block */
+  common_test_flate_threads (0, 131072, 1000);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_flate_enc_threads_004
+ * Description:
+ *   Install a FLATE encoder filter with a too small block size.
+ * Success condition:
+ *   The filter should not be installed, and PDF_EBADDATA be reported.
+ */
+START_TEST (pdf_stm_read_filter_flate_enc_threads_004)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params, "Threads", 2, &error));
+  fail_unless (pdf_hash_add_size (params, "BlockSize", 1024, &error));
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) test_strings[0].decoded,
+                         test_strings[0].decoded_size,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_ENC,
+                                       params,
+                                       &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EBADDATA);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+  pdf_hash_destroy (params);
+}
+END_TEST
+
+/* Decode the FLATE encoded sample data, giving LENGTH as size of the
+ * encoded data, and reading it through a cache of CACHE_SIZE bytes */
+static void
+common_test_flate_length (pdf_i32_t  length_delta,
+                          pdf_size_t cache_size)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+  pdf_uchar_t *data;
+  pdf_uchar_t *encoded;
+  pdf_uchar_t *decoded;
+  pdf_size_t size = 100000;
+  pdf_size_t encoded_size;
+  pdf_size_t decoded_size;
+  pdf_size_t i;
+
+  data = pdf_alloc (size);
+  encoded = pdf_alloc (2 * size);
+  decoded = pdf_alloc (size + 1);
+  fail_unless (data != NULL && encoded != NULL && decoded != NULL);
+  for (i = 0; i < size; i++)
+    data[i] = (pdf_uchar_t) ((i % 251) ^ (i / 1000));
+
+  stm = pdf_stm_mem_new (data, size, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_ENC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, encoded, 2 * size, &encoded_size, &error);
+  fail_if (error != NULL);
+  pdf_stm_destroy (stm);
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params,
+                                  "Length",
+                                  encoded_size + length_delta,
+                                  &error));
+
+  stm = pdf_stm_mem_new (encoded, encoded_size, cache_size,
+                         PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_FLATE_DEC,
+                                       params,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, decoded, size + 1, &decoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (decoded_size == size);
+  fail_unless (memcmp (decoded, data, size) == 0);
+  pdf_stm_destroy (stm);
+
+  pdf_hash_destroy (params);
+  pdf_dealloc (decoded);
+  pdf_dealloc (encoded);
+  pdf_dealloc (data);
+}
+
+/*
+ * Test: pdf_stm_read_filter_flate_dec_length_001-004
+ * Description:
+ *   Test FLATE decoder filter given the size of the encoded data,
+ *   right and wrong.
+ * Success condition:
+ *   The decoded data should be the original data.
+ */
+START_TEST (pdf_stm_read_filter_flate_dec_length_001)
+{
+  /* Exact length */
+  common_test_flate_length (0, 0);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_dec_length_002)
+{
+  /* Too short: the rest of the data is decoded as a stream */
+  common_test_flate_length (-1000, 0);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_dec_length_003)
+{
+  /* Too long, read through a small cache */
+  common_test_flate_length (100, 100);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_flate_dec_length_004)
+{
+  /* Far too long: the buffers grow with the actual data */
+  common_test_flate_length (8 * 1024 * 1024, 0);
+}
+END_TEST
+
 /*
  * Test case creation functions
  */
@@ -215,6 +570,21 @@ test_pdf_stm_rw_filter_flate (void)
   tcase_add_test (tc, pdf_stm_write_filter_flate_enc_004);
   tcase_add_test (tc, pdf_stm_write_filter_flate_enc_005);
 
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_params_001);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_params_002);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_params_003);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_params_004);
+
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_threads_001);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_threads_002);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_threads_003);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_enc_threads_004);
+
+  tcase_add_test (tc, pdf_stm_read_filter_flate_dec_length_001);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_dec_length_002);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_dec_length_003);
+  tcase_add_test (tc, pdf_stm_read_filter_flate_dec_length_004);
+
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
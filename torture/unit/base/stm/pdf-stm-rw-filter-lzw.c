@@ -0,0 +1,389 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-rw-filter-lzw.c
+ *       Date:         Sat Oct 17 18:12:40 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_read() and pdf_stm_write()
+ *                         with LZW filter.
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+#include "pdf-stm-test-common.h"
+
+struct test_strings_s {
+  /* LZW-Encoded string */
+  pdf_size_t encoded_size;
+  const pdf_char_t *encoded;
+  /* Decoded string */
+  pdf_size_t decoded_size;
+  const pdf_char_t *decoded;
+};
+
+static const struct test_strings_s test_strings[] = {
+  /* Example from the PDF Reference, with EarlyChange */
+  {
+    9, "\x80\x0b\x60\x50\x22\x0c\x0c\x85\x01",
+    10, "-----A---B"
+  },
+  { 0, NULL, 0, NULL }
+};
+
+static const struct test_params_s tests_params[] = {
+  /* No   Test type          Test operation   Loop read size       Cache size */
+  {	 1,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_ONE,    0 },
+  {	 2,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    0 },
+  {	 3,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_HALF,   0 },
+  {	 4,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  0 },
+  {	 5,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {	 6,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_ONE,    0 },
+  {	 7,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    0 },
+  {	 8,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_HALF,   0 },
+  {	 9,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  0 },
+  {	 10,  TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {	 11,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_ONE,    0 },
+  {	 12,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_TWO,    0 },
+  {  13,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
+  {	 14,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
+  {	 15,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {	 16,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_ONE,    0 },
+  {	 17,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_TWO,    0 },
+  {	 18,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
+  {	 19,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
+  {	 20,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+};
+
+static void
+common_test_lzw (const pdf_char_t *function_name,
+                int               test_index)
+{
+  int i;
+  const struct test_params_s *params = &tests_params[test_index - 1];
+
+  /* Sanity check */
+  fail_if (test_index != params->idx);
+
+  for (i = 0; test_strings[i].encoded; i++)
+    {
+      pdf_stm_test_common (function_name,
+                           params->type,
+                           params->operation,
+                           (params->type == TEST_TYPE_ENCODER ?
+                            PDF_STM_FILTER_LZW_ENC :
+                            PDF_STM_FILTER_LZW_DEC),
+                           NULL,
+                           params->stm_cache_size,
+                           params->loop_size,
+                           test_strings[i].decoded,
+                           test_strings[i].decoded_size,
+                           test_strings[i].encoded,
+                           test_strings[i].encoded_size);
+    }
+}
+
+/*
+ * Test: pdf_stm_read_filter_lzw_dec_001-005
+ * Description:
+ *   Test LZW decoder filter with different read loop sizes
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_lzw_dec_001) { common_test_lzw (__FUNCTION__,  1); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_dec_002) { common_test_lzw (__FUNCTION__,  2); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_dec_003) { common_test_lzw (__FUNCTION__,  3); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_dec_004) { common_test_lzw (__FUNCTION__,  4); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_dec_005) { common_test_lzw (__FUNCTION__,  5); } END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_lzw_enc_001-005
+ * Description:
+ *   Test LZW encoder filter with different read loop sizes
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_lzw_enc_001) { common_test_lzw (__FUNCTION__,  6); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_enc_002) { common_test_lzw (__FUNCTION__,  7); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_enc_003) { common_test_lzw (__FUNCTION__,  8); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_enc_004) { common_test_lzw (__FUNCTION__,  9); } END_TEST
+START_TEST (pdf_stm_read_filter_lzw_enc_005) { common_test_lzw (__FUNCTION__, 10); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_lzw_dec_001-005
+ * Description:
+ *   Test LZW decoder filter with different write loop sizes
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_lzw_dec_001) { common_test_lzw (__FUNCTION__, 11); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_dec_002) { common_test_lzw (__FUNCTION__, 12); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_dec_003) { common_test_lzw (__FUNCTION__, 13); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_dec_004) { common_test_lzw (__FUNCTION__, 14); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_dec_005) { common_test_lzw (__FUNCTION__, 15); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_lzw_enc_001-005
+ * Description:
+ *   Test LZW encoder filter with different write loop sizes
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_lzw_enc_001) { common_test_lzw (__FUNCTION__, 16); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_enc_002) { common_test_lzw (__FUNCTION__, 17); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_enc_003) { common_test_lzw (__FUNCTION__, 18); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_enc_004) { common_test_lzw (__FUNCTION__, 19); } END_TEST
+START_TEST (pdf_stm_write_filter_lzw_enc_005) { common_test_lzw (__FUNCTION__, 20); } END_TEST
+
+/* 40000 'a' characters, as encoded by libtiff. The dictionary grows up
+ * to 10-bit codes. */
+#define RUN_DECODED_SIZE 40000
+static const pdf_char_t run_encoded[] =
+  "\x80\x18\x60\x50\x38\x24\x16\x0d\x07\x84\x42\x61\x50\xb8\x64\x36"
+  "\x1d\x0f\x88\x44\x62\x51\x38\xa4\x56\x2d\x17\x8c\x46\x63\x51\xb8"
+  "\xe4\x76\x3d\x1f\x90\x48\x64\x52\x39\x24\x96\x4d\x27\x94\x4a\x65"
+  "\x52\xb9\x64\xb6\x5d\x2f\x98\x4c\x66\x53\x39\xa4\xd6\x6d\x37\x9c"
+  "\x4e\x67\x53\xb9\xe4\xf6\x7d\x3f\xa0\x50\x68\x54\x3a\x25\x16\x8d"
+  "\x47\xa4\x52\x69\x54\xba\x65\x36\x9d\x4f\xa8\x54\x6a\x55\x3a\xa5"
+  "\x56\xad\x57\xac\x56\x6b\x55\xba\xe5\x76\xbd\x5f\xb0\x58\x6c\x56"
+  "\x3b\x25\x96\xcd\x67\xb4\x5a\x6d\x56\xbb\x65\xb6\xdd\x6f\xb8\x5c"
+  "\x6e\x57\x3b\xa5\xd6\xed\x77\xbc\x5e\x6f\x57\xbb\xe5\xf6\xfd\x7f"
+  "\xc0\x60\x70\x58\x3c\x26\x17\x0d\x87\xc4\x62\x71\x58\xbc\x66\x37"
+  "\x1d\x8f\xc8\x64\x72\x59\x3c\xa6\x57\x2d\x97\xcc\x66\x73\x59\xbc"
+  "\xe6\x77\x3d\x9f\xd0\x68\x74\x5a\x3d\x26\x97\x4d\xa7\xd4\x6a\x75"
+  "\x5a\xbd\x66\xb7\x5d\xaf\xd8\x6c\x76\x5b\x3d\xa6\xd7\x6d\xb7\xdc"
+  "\x6e\x77\x5b\xbd\xe6\xf7\x7d\xbf\xe0\x70\x78\x5c\x3e\x27\x17\x8d"
+  "\xc7\xe4\x72\x79\x5c\xbe\x67\x37\x9d\xcf\xe8\x74\x7a\x5d\x3e\xa7"
+  "\x57\xad\xd7\xec\x76\x7b\x5d\xbe\xe7\x77\xbd\xdf\xf0\x78\x7c\x5e"
+  "\x3f\x27\x97\xcd\xe7\xf4\x7a\x7d\x5e\xbf\x67\xb7\xdd\xef\xf8\x7c"
+  "\x7e\x5f\x3f\xa7\xd7\xed\xf7\xfc\x7e\x7f\x5f\xbf\xe7\xf7\xfc\xff"
+  "\xc0\x10\x0c\x05\x01\xc0\x90\x2c\x0d\x03\xc1\x10\x4c\x15\x05\xc1"
+  "\x90\x6c\x1d\x07\xc2\x10\x8c\x25\x09\xc2\x90\xac\x2d\x0b\xc3\x10"
+  "\xcc\x34\xb0\xa0\x20";
+
+/*
+ * Test: pdf_stm_read_filter_lzw_dec_width_001
+ * Description:
+ *   Decode a long run of the same character encoded by another
+ *   implementation.
+ * Success condition:
+ *   The read data should be ok, as the code width must switch from 9 to
+ *   10 bits at the same point as in the encoder.
+ */
+START_TEST (pdf_stm_read_filter_lzw_dec_width_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t *decoded;
+  pdf_uchar_t *expected;
+  pdf_size_t decoded_size;
+
+  decoded = pdf_alloc (RUN_DECODED_SIZE + 1);
+  expected = pdf_alloc (RUN_DECODED_SIZE);
+  fail_unless (decoded != NULL && expected != NULL);
+  memset (expected, 'a', RUN_DECODED_SIZE);
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) run_encoded,
+                         sizeof (run_encoded) - 1,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_LZW_DEC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, decoded, RUN_DECODED_SIZE + 1, &decoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (decoded_size == RUN_DECODED_SIZE);
+  fail_unless (memcmp (decoded, expected, RUN_DECODED_SIZE) == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_dealloc (expected);
+  pdf_dealloc (decoded);
+}
+END_TEST
+
+/* Encode SIZE bytes of sample data and decode them back, with the given
+ * EarlyChange */
+static void
+common_test_lzw_roundtrip (pdf_bool_t early_change,
+                           pdf_size_t size)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+  pdf_uchar_t *data;
+  pdf_uchar_t *encoded;
+  pdf_uchar_t *decoded;
+  pdf_size_t encoded_size;
+  pdf_size_t decoded_size;
+  pdf_size_t i;
+
+  /* Some repetitive contents, long enough for several resets */
+  data = pdf_alloc (size);
+  encoded = pdf_alloc (2 * size + 64);
+  decoded = pdf_alloc (size + 1);
+  fail_unless (data != NULL && encoded != NULL && decoded != NULL);
+  for (i = 0; i < size; i++)
+    data[i] = (pdf_uchar_t) ((i % 251) ^ (i / 1000) ^ ((i * 7) % 13));
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_bool (params, "EarlyChange", early_change, &error));
+
+  stm = pdf_stm_mem_new (data, size, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_LZW_ENC,
+                                       params,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, encoded, 2 * size + 64, &encoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (encoded_size > 0);
+  pdf_stm_destroy (stm);
+
+  stm = pdf_stm_mem_new (encoded, encoded_size, 0, PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_LZW_DEC,
+                                       params,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, decoded, size + 1, &decoded_size, &error);
+  fail_if (error != NULL);
+  fail_unless (decoded_size == size);
+  fail_unless (memcmp (decoded, data, size) == 0);
+  pdf_stm_destroy (stm);
+
+  pdf_hash_destroy (params);
+  pdf_dealloc (decoded);
+  pdf_dealloc (encoded);
+  pdf_dealloc (data);
+}
+
+/*
+ * Test: pdf_stm_read_filter_lzw_roundtrip_001-002
+ * Description:
+ *   Encode some data long enough to fill the dictionary several times,
+ *   with and without EarlyChange, and decode it back.
+ * Success condition:
+ *   The decoded data should be equal to the original one.
+ */
+START_TEST (pdf_stm_read_filter_lzw_roundtrip_001)
+{
+  common_test_lzw_roundtrip (PDF_TRUE, 300000);
+}
+END_TEST
+
+START_TEST (pdf_stm_read_filter_lzw_roundtrip_002)
+{
+  common_test_lzw_roundtrip (PDF_FALSE, 300000);
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_lzw_dec_invalid_001
+ * Description:
+ *   Decode a code not yet in the dictionary.
+ * Success condition:
+ *   PDF_EBADDATA should be reported.
+ */
+START_TEST (pdf_stm_read_filter_lzw_dec_invalid_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_stm_t *stm;
+  pdf_uchar_t decoded[16];
+  pdf_size_t decoded_size;
+  /* Clear code, 'A', and code 300 */
+  pdf_char_t encoded[] = "\x80\x10\x65\x80";
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) encoded,
+                         sizeof (encoded) - 1,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_LZW_DEC,
+                                       NULL,
+                                       &error) == PDF_TRUE);
+  fail_unless (pdf_stm_read (stm,
+                             decoded,
+                             sizeof (decoded),
+                             &decoded_size,
+                             &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EBADDATA);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+}
+END_TEST
+
+/*
+ * Test case creation functions
+ */
+
+TCase *
+test_pdf_stm_rw_filter_lzw (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_rw_filter_lzw");
+
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_001);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_002);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_003);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_004);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_005);
+
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_enc_001);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_enc_002);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_enc_003);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_enc_004);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_enc_005);
+
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_dec_001);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_dec_002);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_dec_003);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_dec_004);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_dec_005);
+
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_enc_001);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_enc_002);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_enc_003);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_enc_004);
+  tcase_add_test (tc, pdf_stm_write_filter_lzw_enc_005);
+
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_width_001);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_roundtrip_001);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_roundtrip_002);
+  tcase_add_test (tc, pdf_stm_read_filter_lzw_dec_invalid_001);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-rw-filter-lzw.c */
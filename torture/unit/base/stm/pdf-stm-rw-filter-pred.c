@@ -0,0 +1,453 @@
+/* -*- mode: C -*-
+ *
+ *       File:         pdf-stm-rw-filter-pred.c
+ *       Date:         Sat Oct 17 17:40:05 2026
+ *
+ *       GNU PDF Library - Unit tests for pdf_stm_read() and pdf_stm_write()
+ *                         with Predictor filter.
+ *
+ */
+
+/* Copyright (C) 2026 Free Software Foundation, Inc. */
+
+/* This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#include <string.h>
+#include <check.h>
+#include <pdf.h>
+#include <pdf-test-common.h>
+#include "pdf-stm-test-common.h"
+
+struct test_strings_s {
+  /* Image parameters */
+  pdf_size_t predictor;
+  pdf_size_t colors;
+  pdf_size_t bits_per_component;
+  pdf_size_t columns;
+  /* Predicted string */
+  pdf_size_t encoded_size;
+  const pdf_char_t *encoded;
+  /* Decoded string */
+  pdf_size_t decoded_size;
+  const pdf_char_t *decoded;
+  /* Whether the encoder would pick other filter types, which it does
+   * for every row whatever the PNG predictor */
+  pdf_bool_t decoder_only;
+};
+
+static const struct test_strings_s test_strings[] = {
+  /* RGB, 8 pixels per row; rows with filter types None, Sub, Up,
+   * Average and Paeth */
+  {
+    15, 3, 8, 8,
+    125,
+    "\x00\x04\x35\x6a\x13\x45\x77\x23\x5a\x8b\x38\x69\x9c\x46\x76\xa8"
+    "\x56\x8a\xbf\x6b\x9b\xcc\x7d\xad\xe1\x01\x1f\x54\x87\x14\x11\x0e"
+    "\x0d\x10\x0e\x11\x13\x17\x11\x0c\x10\x14\x14\x12\x12\x0e\x0d\x10"
+    "\x10\x14\x02\x20\x18\x19\x1b\x18\x1e\x22\x1c\x22\x20\x18\x1c\x22"
+    "\x1f\x1e\x1d\x1b\x17\x1b\x1e\x1f\x19\x23\x1d\x03\x3a\x53\x6e\x17"
+    "\x1b\x1a\x13\x1a\x15\x16\x14\x17\x15\x17\x16\x17\x16\x97\x15\x1c"
+    "\x16\x18\x16\x18\x04\x21\x21\x1e\x0f\x0e\x0f\x12\x12\x11\x0e\x10"
+    "\x11\x0f\x14\x1d\x17\x0f\x0f\x0b\x0f\x15\x13\x18\x0e",
+    120,
+    "\x04\x35\x6a\x13\x45\x77\x23\x5a\x8b\x38\x69\x9c\x46\x76\xa8\x56"
+    "\x8a\xbf\x6b\x9b\xcc\x7d\xad\xe1\x1f\x54\x87\x33\x65\x95\x40\x75"
+    "\xa3\x51\x88\xba\x62\x94\xca\x76\xa8\xdc\x88\xb6\xe9\x98\xc6\xfd"
+    "\x3f\x6c\xa0\x4e\x7d\xb3\x62\x91\xc5\x71\xa0\xd6\x84\xb3\xe8\x93"
+    "\xc3\xf3\xa3\xd4\x08\xb1\xe9\x1a\x59\x89\xbe\x6a\x9e\xd2\x79\xb1"
+    "\xe0\x8b\xbc\xf2\x9c\xce\x03\xae\xde\x12\xbd\xf5\x23\xcf\x05\x36"
+    "\x7a\xaa\xdc\x89\xb8\xeb\x9b\xca\xfc\xa9\xda\x0d\xb8\xee\x20\xcf"
+    "\xfd\x2f\xda\x0c\x44\xed\x1d\x52",
+    PDF_TRUE
+  },
+  /* Gray, 20 pixels per row, same filter types */
+  {
+    15, 1, 8, 20,
+    105,
+    "\x00\x05\x13\x25\x38\x44\x5a\x67\x79\x8a\x99\xaf\xc0\xcf\xdd\xf2"
+    "\x03\x14\x26\x33\x46\x01\x20\x13\x10\x13\x0e\x0f\x11\x12\x10\x15"
+    "\x0c\x12\x10\x17\x0f\x0f\x15\x0d\x15\x0d\x02\x1a\x19\x1c\x17\x1f"
+    "\x22\x1e\x21\x1e\x1d\x20\x1f\x1d\x1b\x19\x1f\x1c\x1c\x18\x1f\x03"
+    "\x3c\x1a\x15\x1d\x14\x13\x1b\x15\x19\x16\x1a\x96\x17\x19\x18\x18"
+    "\x18\x17\x15\x18\x04\x21\x0c\x11\x13\x10\x15\x0c\x12\x13\x0d\x1c"
+    "\x10\x11\x11\x10\x0e\x17\x0d\x13\x0e",
+    100,
+    "\x05\x13\x25\x38\x44\x5a\x67\x79\x8a\x99\xaf\xc0\xcf\xdd\xf2\x03"
+    "\x14\x26\x33\x46\x20\x33\x43\x56\x64\x73\x84\x96\xa6\xbb\xc7\xd9"
+    "\xe9\x00\x0f\x1e\x33\x40\x55\x62\x3a\x4c\x5f\x6d\x83\x95\xa2\xb7"
+    "\xc4\xd8\xe7\xf8\x06\x1b\x28\x3d\x4f\x5c\x6d\x81\x59\x6c\x7a\x90"
+    "\x9d\xac\xc2\xd1\xe3\xf3\x07\x15\x24\x38\x48\x5a\x6c\x7b\x89\x9d"
+    "\x7a\x86\x97\xaa\xba\xcf\xdb\xed\x00\x0d\x23\x33\x44\x55\x65\x73"
+    "\x8a\x97\xaa\xb8",
+    PDF_TRUE
+  },
+  /* RGB, 6 pixels per row, with the filter type of each row chosen by
+   * the encoder */
+  {
+    15, 3, 8, 6,
+    114,
+    "\x01\x01\x46\x8c\x0a\x0a\x0a\x08\x0a\x09\x08\x09\x08\x0a\x08\x09"
+    "\x08\x0a\x0a\x02\x03\x04\x04\x04\x04\x04\x03\x04\x05\x06\x03\x05"
+    "\x03\x03\x04\x06\x03\x05\x02\x54\x24\x29\xad\x3c\x06\x15\x94\xb6"
+    "\xd6\x7f\xa7\x35\xed\xf1\x31\xc2\x6b\x01\x0c\x53\x98\x0b\x09\x0b"
+    "\x08\x0a\x08\x08\x08\x09\x0b\x09\x09\x09\x08\x09\x01\x78\xbe\x06"
+    "\x09\x0b\x08\x09\x08\x0a\x09\x0a\x09\x09\x08\x07\x0a\x08\x09\x04"
+    "\x20\x1f\x1d\x07\x08\x08\x0b\x09\x09\x09\x09\x0b\x08\x0b\x07\x09"
+    "\x07\x0a",
+    108,
+    "\x01\x46\x8c\x0b\x50\x96\x13\x5a\x9f\x1b\x63\xa7\x25\x6b\xb0\x2d"
+    "\x75\xba\x04\x4a\x90\x0f\x54\x9a\x16\x5e\xa4\x21\x66\xac\x28\x6e"
+    "\xb4\x33\x78\xbf\x58\x6e\xb9\xbc\x90\xa0\x2b\xf2\x5a\xf7\xe5\x53"
+    "\x5d\x5b\xa5\x64\x3a\x2a\x0c\x53\x98\x17\x5c\xa3\x1f\x66\xab\x27"
+    "\x6e\xb4\x32\x77\xbd\x3b\x7f\xc6\x78\xbe\x06\x81\xc9\x0e\x8a\xd1"
+    "\x18\x93\xdb\x21\x9c\xe3\x28\xa6\xeb\x31\x98\xdd\x23\x9f\xe5\x2b"
+    "\xaa\xee\x34\xb3\xf7\x3f\xbb\x02\x46\xc4\x09\x50",
+    PDF_FALSE
+  },
+  /* 4-bit gray, 9 pixels per row, Sub filter in all rows */
+  {
+    11, 1, 4, 9,
+    18,
+    "\x01\xfb\x67\xb0\x14\x5a\x01\xee\x76\x87\xac\xc9\x01\x2e\x06\x22"
+    "\x24\x06",
+    15,
+    "\xfb\x62\x12\x26\x80\xee\x64\xeb\x97\x60\x2e\x34\x56\x7a\x80",
+    PDF_TRUE
+  },
+  { 0, 0, 0, 0, 0, NULL, 0, NULL, PDF_FALSE }
+};
+
+static const struct test_params_s tests_params[] = {
+  /* No   Test type          Test operation   Loop read size       Cache size */
+  {  1,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_ONE,    0 },
+  {  2,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    0 },
+  {  3,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_HALF,   0 },
+  {  4,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  0 },
+  {  5,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {  6,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_ONE,    0 },
+  {  7,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    0 },
+  {  8,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_HALF,   0 },
+  {  9,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  0 },
+  { 10,   TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_DOUBLE, 0 },
+
+  { 11,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_ONE,    0 },
+  { 12,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_TWO,    0 },
+  { 13,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
+  { 14,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
+  { 15,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+
+  { 16,   TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_ONE,    0 },
+  { 17,   TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_TWO,    0 },
+  { 18,   TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
+  { 19,   TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
+  { 20,   TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+
+  { 21,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  7 },
+  { 22,   TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_EXACT,  20 },
+  { 23,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  7 },
+  { 24,   TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  20 },
+};
+
+static pdf_hash_t *
+new_pred_params (pdf_size_t predictor,
+                 pdf_size_t colors,
+                 pdf_size_t bits_per_component,
+                 pdf_size_t columns)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+
+  params = pdf_hash_new (&error);
+  fail_unless (params != NULL);
+  fail_unless (pdf_hash_add_size (params, "Predictor", predictor, &error));
+  fail_unless (pdf_hash_add_size (params, "Colors", colors, &error));
+  fail_unless (pdf_hash_add_size (params,
+                                  "BitsPerComponent",
+                                  bits_per_component,
+                                  &error));
+  fail_unless (pdf_hash_add_size (params, "Columns", columns, &error));
+  return params;
+}
+
+static void
+common_test_pred (const pdf_char_t *function_name,
+                  int               test_index)
+{
+  int i;
+  const struct test_params_s *params = &tests_params[test_index - 1];
+
+  /* Sanity check */
+  fail_if (test_index != params->idx);
+
+  for (i = 0; test_strings[i].encoded; i++)
+    {
+      pdf_hash_t *filter_params;
+
+      if (params->type == TEST_TYPE_ENCODER && test_strings[i].decoder_only)
+        continue;
+
+      filter_params = new_pred_params (test_strings[i].predictor,
+                                       test_strings[i].colors,
+                                       test_strings[i].bits_per_component,
+                                       test_strings[i].columns);
+      pdf_stm_test_common (function_name,
+                           params->type,
+                           params->operation,
+                           (params->type == TEST_TYPE_ENCODER ?
+                            PDF_STM_FILTER_PRED_ENC :
+                            PDF_STM_FILTER_PRED_DEC),
+                           filter_params,
+                           params->stm_cache_size,
+                           params->loop_size,
+                           test_strings[i].decoded,
+                           test_strings[i].decoded_size,
+                           test_strings[i].encoded,
+                           test_strings[i].encoded_size);
+      pdf_hash_destroy (filter_params);
+    }
+}
+
+/*
+ * Test: pdf_stm_read_filter_pred_dec_001-005
+ * Description:
+ *   Test Predictor decoder filter with different read loop sizes
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_pred_dec_001) { common_test_pred (__FUNCTION__,  1); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_dec_002) { common_test_pred (__FUNCTION__,  2); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_dec_003) { common_test_pred (__FUNCTION__,  3); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_dec_004) { common_test_pred (__FUNCTION__,  4); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_dec_005) { common_test_pred (__FUNCTION__,  5); } END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_pred_enc_001-005
+ * Description:
+ *   Test Predictor encoder filter with different read loop sizes
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_pred_enc_001) { common_test_pred (__FUNCTION__,  6); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_enc_002) { common_test_pred (__FUNCTION__,  7); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_enc_003) { common_test_pred (__FUNCTION__,  8); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_enc_004) { common_test_pred (__FUNCTION__,  9); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_enc_005) { common_test_pred (__FUNCTION__, 10); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_pred_dec_001-005
+ * Description:
+ *   Test Predictor decoder filter with different write loop sizes
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_pred_dec_001) { common_test_pred (__FUNCTION__, 11); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_dec_002) { common_test_pred (__FUNCTION__, 12); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_dec_003) { common_test_pred (__FUNCTION__, 13); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_dec_004) { common_test_pred (__FUNCTION__, 14); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_dec_005) { common_test_pred (__FUNCTION__, 15); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_pred_enc_001-005
+ * Description:
+ *   Test Predictor encoder filter with different write loop sizes
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_pred_enc_001) { common_test_pred (__FUNCTION__, 16); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_enc_002) { common_test_pred (__FUNCTION__, 17); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_enc_003) { common_test_pred (__FUNCTION__, 18); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_enc_004) { common_test_pred (__FUNCTION__, 19); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_enc_005) { common_test_pred (__FUNCTION__, 20); } END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_pred_dec_cache_001-002,
+ *       pdf_stm_write_filter_pred_dec_cache_001-002
+ * Description:
+ *   Test Predictor decoder filter with stream caches smaller than a
+ *   row, which get full in the middle of the rows.
+ * Success condition:
+ *   The read or written data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_pred_dec_cache_001) { common_test_pred (__FUNCTION__, 21); } END_TEST
+START_TEST (pdf_stm_read_filter_pred_dec_cache_002) { common_test_pred (__FUNCTION__, 22); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_dec_cache_001) { common_test_pred (__FUNCTION__, 23); } END_TEST
+START_TEST (pdf_stm_write_filter_pred_dec_cache_002) { common_test_pred (__FUNCTION__, 24); } END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_pred_dec_invalid_001
+ * Description:
+ *   Decode a PNG row with an unknown filter type.
+ * Success condition:
+ *   PDF_EBADDATA should be reported.
+ */
+START_TEST (pdf_stm_read_filter_pred_dec_invalid_001)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+  pdf_uchar_t decoded[16];
+  pdf_size_t decoded_size;
+  /* A None row followed by a row of type 5 */
+  pdf_char_t encoded[] = "\x00\x01\x02\x03\x05\x01\x02\x03";
+
+  params = new_pred_params (15, 3, 8, 1);
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) encoded,
+                         sizeof (encoded) - 1,
+                         0,
+                         PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm,
+                                       PDF_STM_FILTER_PRED_DEC,
+                                       params,
+                                       &error) == PDF_TRUE);
+  fail_unless (pdf_stm_read (stm,
+                             decoded,
+                             sizeof (decoded),
+                             &decoded_size,
+                             &error) == PDF_FALSE);
+  fail_unless (error != NULL);
+  fail_unless (pdf_error_get_status (error) == PDF_EBADDATA);
+
+  pdf_error_destroy (error);
+  pdf_stm_destroy (stm);
+  pdf_hash_destroy (params);
+}
+END_TEST
+
+/* Read DATA through the filter TYPE of predictor PREDICTOR, for the
+ * RGB rows of 6 pixels of the test strings, into a new buffer */
+static pdf_uchar_t *
+read_pred (enum pdf_stm_filter_type_e  type,
+           pdf_size_t                  predictor,
+           const pdf_char_t           *data,
+           pdf_size_t                  size,
+           pdf_size_t                 *read_size)
+{
+  pdf_error_t *error = NULL;
+  pdf_hash_t *params;
+  pdf_stm_t *stm;
+  pdf_uchar_t *buf;
+
+  buf = pdf_alloc (2 * size);
+  fail_unless (buf != NULL);
+
+  params = new_pred_params (predictor, 3, 8, 6);
+  stm = pdf_stm_mem_new ((pdf_uchar_t *) data, size, 0, PDF_STM_READ,
+                         &error);
+  fail_unless (stm != NULL);
+  fail_unless (pdf_stm_install_filter (stm, type, params,
+                                       &error) == PDF_TRUE);
+  pdf_stm_read (stm, buf, 2 * size, read_size, &error);
+  fail_if (error != NULL);
+
+  pdf_stm_destroy (stm);
+  pdf_hash_destroy (params);
+  return buf;
+}
+
+/*
+ * Test: pdf_stm_read_filter_pred_enc_png_001
+ * Description:
+ *   Encode the same image with each of the PNG predictors 10 to 15,
+ *   and decode it back.
+ * Success condition:
+ *   The filter type of each row should be picked the same way for
+ *   every predictor, and the decoded data should be the image.
+ */
+START_TEST (pdf_stm_read_filter_pred_enc_png_001)
+{
+  const struct test_strings_s *image = &test_strings[2];
+  pdf_uchar_t *encoded;
+  pdf_uchar_t *decoded;
+  pdf_size_t encoded_size;
+  pdf_size_t decoded_size;
+  pdf_size_t predictor;
+
+  for (predictor = 10; predictor <= 15; predictor++)
+    {
+      encoded = read_pred (PDF_STM_FILTER_PRED_ENC,
+                           predictor,
+                           image->decoded,
+                           image->decoded_size,
+                           &encoded_size);
+      fail_unless (encoded_size == image->encoded_size);
+      fail_unless (memcmp (encoded, image->encoded, encoded_size) == 0);
+
+      decoded = read_pred (PDF_STM_FILTER_PRED_DEC,
+                           predictor,
+                           (pdf_char_t *) encoded,
+                           encoded_size,
+                           &decoded_size);
+      fail_unless (decoded_size == image->decoded_size);
+      fail_unless (memcmp (decoded, image->decoded, decoded_size) == 0);
+
+      pdf_dealloc (decoded);
+      pdf_dealloc (encoded);
+    }
+}
+END_TEST
+
+/*
+ * Test case creation functions
+ */
+
+TCase *
+test_pdf_stm_rw_filter_pred (void)
+{
+  TCase *tc = tcase_create ("pdf_stm_rw_filter_pred");
+
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_001);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_002);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_003);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_004);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_005);
+
+  tcase_add_test (tc, pdf_stm_read_filter_pred_enc_001);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_enc_002);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_enc_003);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_enc_004);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_enc_005);
+
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_001);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_002);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_003);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_004);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_005);
+
+  tcase_add_test (tc, pdf_stm_write_filter_pred_enc_001);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_enc_002);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_enc_003);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_enc_004);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_enc_005);
+
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_cache_001);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_cache_002);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_cache_001);
+  tcase_add_test (tc, pdf_stm_write_filter_pred_dec_cache_002);
+
+  tcase_add_test (tc, pdf_stm_read_filter_pred_dec_invalid_001);
+  tcase_add_test (tc, pdf_stm_read_filter_pred_enc_png_001);
+
+  tcase_add_checked_fixture (tc,
+                             pdf_test_setup,
+                             pdf_test_teardown);
+  return tc;
+}
+
+/* End of pdf-stm-rw-filter-pred.c */
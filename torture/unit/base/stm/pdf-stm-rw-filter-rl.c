@@ -46,6 +46,16 @@ static const struct test_strings_s test_strings[] = {
     21, "\x00" "1" "\xff" "2" "\xfe" "3" "\xfd" "4" "\xfc" "5" "\xfb" "6" "\xfa" "7" "\xf9" "8" "\xf8" "9" "\x00" "\x00" "\x80",
     46, "122333444455555666666777777788888888999999999"
   },
+  /* Literals of several bytes, and a run longer than a block */
+  {
+    17, "\x01" "ab" "\x81" "c" "\xff" "c" "\x03" "defg" "\xff" "h" "\x00" "i" "\x80",
+    139,
+    "ab"
+    "cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc"
+    "cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc"
+    "cc"
+    "defghhi"
+  },
   { 0, NULL, 0, NULL }
 };
 
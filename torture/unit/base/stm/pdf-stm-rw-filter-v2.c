@@ -81,6 +81,15 @@ static const struct test_params_s tests_params[] = {
   {	 18,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_HALF,   0 },
   {	 19,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  0 },
   {	 20,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_DOUBLE, 0 },
+
+  {	 21,  TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    1 },
+  {	 22,  TEST_TYPE_DECODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    5 },
+  {	 23,  TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    1 },
+  {	 24,  TEST_TYPE_ENCODER, TEST_OP_READ,    LOOP_RW_SIZE_TWO,    5 },
+  {	 25,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  1 },
+  {	 26,  TEST_TYPE_DECODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  5 },
+  {	 27,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  1 },
+  {	 28,  TEST_TYPE_ENCODER, TEST_OP_WRITE,   LOOP_RW_SIZE_EXACT,  5 },
 };
 
 static void
@@ -171,6 +180,158 @@ START_TEST (pdf_stm_write_filter_v2_enc_003) { common_test_v2 (__FUNCTION__, 18)
 START_TEST (pdf_stm_write_filter_v2_enc_004) { common_test_v2 (__FUNCTION__, 19); } END_TEST
 START_TEST (pdf_stm_write_filter_v2_enc_005) { common_test_v2 (__FUNCTION__, 20); } END_TEST
 
+/*
+ * Test: pdf_stm_read_filter_v2_dec_cache_001-002
+ * Description:
+ *   Test V2 decoder filter with small stream caches
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_v2_dec_cache_001) { common_test_v2 (__FUNCTION__, 21); } END_TEST
+START_TEST (pdf_stm_read_filter_v2_dec_cache_002) { common_test_v2 (__FUNCTION__, 22); } END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_v2_enc_cache_001-002
+ * Description:
+ *   Test V2 encoder filter with small stream caches
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_v2_enc_cache_001) { common_test_v2 (__FUNCTION__, 23); } END_TEST
+START_TEST (pdf_stm_read_filter_v2_enc_cache_002) { common_test_v2 (__FUNCTION__, 24); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_v2_dec_cache_001-002
+ * Description:
+ *   Test V2 decoder filter with small stream caches
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_v2_dec_cache_001) { common_test_v2 (__FUNCTION__, 25); } END_TEST
+START_TEST (pdf_stm_write_filter_v2_dec_cache_002) { common_test_v2 (__FUNCTION__, 26); } END_TEST
+
+/*
+ * Test: pdf_stm_write_filter_v2_enc_cache_001-002
+ * Description:
+ *   Test V2 encoder filter with small stream caches
+ * Success condition:
+ *   The written data should be ok.
+ */
+START_TEST (pdf_stm_write_filter_v2_enc_cache_001) { common_test_v2 (__FUNCTION__, 27); } END_TEST
+START_TEST (pdf_stm_write_filter_v2_enc_cache_002) { common_test_v2 (__FUNCTION__, 28); } END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_v2_dec_chain_001
+ * Description:
+ *   Read V2 encrypted Flate data through a V2 decoder and a Flate
+ *   decoder with small stream caches. The input buffer of the Flate
+ *   decoder is larger than the cache, so the V2 decoder is called
+ *   with partially filled output buffers.
+ * Success condition:
+ *   The read data should be ok, for every cache size.
+ */
+START_TEST (pdf_stm_read_filter_v2_dec_chain_001)
+{
+  /* Flate encoded and then V2 encoded with key "Secret" */
+  const pdf_uchar_t encoded[] =
+    "\x7C\x0E\x76\xCD\xED\xA5\xFB\x69\x49\x77\xF0\x7F\x32\x9B\x7F\x8F"
+    "\x2E\x14\xDF\x80\x1D\xEB\x09\xD2\xA7\x77\xC8\xE0\x83\x1B\x69\xD3"
+    "\xBD\x25\xC6\x95\xE7\x28\xEB\xEA\x14\x57\x5B\x36\x7A\x17\x23\xB2"
+    "\x61\x78\xA4\xFC\xFE\x6D\x99\x0E\x20\x81\xBB\xAF\xFB\x9E\xE4\x8A"
+    "\xBD\x96\xDF\xDB\x5B";
+  const pdf_char_t *decoded =
+    "Attack at dawn, then hold the bridge until the relief column arrives.";
+  const pdf_size_t cache_sizes[] = { 1, 3, 5, 7, 0 };
+  int i;
+
+  for (i = 0; i < sizeof (cache_sizes) / sizeof (cache_sizes[0]); i++)
+    {
+      pdf_error_t *error = NULL;
+      pdf_hash_t *filter_params;
+      pdf_stm_t *stm;
+      pdf_uchar_t buf[128];
+      pdf_size_t read_bytes;
+
+      stm = pdf_stm_mem_new ((pdf_uchar_t *)encoded, sizeof (encoded) - 1,
+                             cache_sizes[i], PDF_STM_READ, &error);
+      fail_unless (stm != NULL);
+
+      filter_params = pdf_hash_new (NULL);
+      pdf_hash_add (filter_params, "Key", test_strings[0].key, NULL, NULL);
+      pdf_hash_add_size (filter_params, "KeySize", test_strings[0].key_size,
+                         NULL);
+      fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_V2_DEC,
+                                           filter_params,
+                                           &error) == PDF_TRUE);
+      fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_FLATE_DEC,
+                                           NULL,
+                                           &error) == PDF_TRUE);
+
+      fail_unless (pdf_stm_read (stm, buf, sizeof (buf), &read_bytes,
+                                 &error) == PDF_FALSE);
+      fail_if (error != NULL);
+      fail_unless (read_bytes == strlen (decoded));
+      fail_unless (memcmp (buf, decoded, read_bytes) == 0);
+
+      pdf_stm_destroy (stm);
+      pdf_hash_destroy (filter_params);
+    }
+}
+END_TEST
+
+/*
+ * Test: pdf_stm_read_filter_v2_dec_adaptive_001
+ * Description:
+ *   Read V2 encrypted data byte by byte through a V2 decoder in an
+ *   adaptive stream with a one byte cache. The cache grows while the
+ *   V2 decoder has pending input, so that it gets called with
+ *   partially consumed input and partially filled output buffers.
+ * Success condition:
+ *   The read data should be ok.
+ */
+START_TEST (pdf_stm_read_filter_v2_dec_adaptive_001)
+{
+  const pdf_uchar_t encoded[] =
+    "\x45\xA0\x1F\x64\x5F\xC3\x5B\x38\x35\x52\x54\x4B\x9B\xF5\x95\xB2"
+    "\x46\x79\xB1\x5B\x79\x27\x6F\x1B\x79\xE9\x6D\x37\x2D\x56\x92\xF5"
+    "\x9A\x11\x23\x19\x36\x58\x5C\x5A\xAC\x81\x8A\x65\xFE\xD3\x7F\xC8"
+    "\xA2\xB3\x17\x86\xB9\xEB\xA8\x30\xF6\x39\x1D\x80\xCA\x85\x5D\xA0"
+    "\x8B\xBD\xBB\xB1\x71";
+  const pdf_char_t *decoded =
+    "Attack at dawn, then hold the bridge until the relief column arrives.";
+  pdf_error_t *error = NULL;
+  pdf_hash_t *filter_params;
+  pdf_stm_t *stm;
+  pdf_uchar_t buf[128];
+  pdf_size_t read_bytes;
+  pdf_size_t total;
+
+  stm = pdf_stm_mem_new ((pdf_uchar_t *)encoded, sizeof (encoded) - 1, 1,
+                         PDF_STM_READ, &error);
+  fail_unless (stm != NULL);
+  pdf_stm_set_cache_policy (stm, PDF_STM_CACHE_ADAPTIVE, 0);
+
+  filter_params = pdf_hash_new (NULL);
+  pdf_hash_add (filter_params, "Key", test_strings[0].key, NULL, NULL);
+  pdf_hash_add_size (filter_params, "KeySize", test_strings[0].key_size,
+                     NULL);
+  fail_unless (pdf_stm_install_filter (stm, PDF_STM_FILTER_V2_DEC,
+                                       filter_params,
+                                       &error) == PDF_TRUE);
+
+  total = 0;
+  while (pdf_stm_read (stm, buf + total, 1, &read_bytes, &error))
+    total += read_bytes;
+  fail_if (error != NULL);
+
+  fail_unless (total == strlen (decoded));
+  fail_unless (memcmp (buf, decoded, total) == 0);
+
+  pdf_stm_destroy (stm);
+  pdf_hash_destroy (filter_params);
+}
+END_TEST
+
 /*
  * Test case creation functions
  */
@@ -204,6 +365,17 @@ test_pdf_stm_rw_filter_v2 (void)
   tcase_add_test (tc, pdf_stm_write_filter_v2_enc_004);
   tcase_add_test (tc, pdf_stm_write_filter_v2_enc_005);
 
+  tcase_add_test (tc, pdf_stm_read_filter_v2_dec_cache_001);
+  tcase_add_test (tc, pdf_stm_read_filter_v2_dec_cache_002);
+  tcase_add_test (tc, pdf_stm_read_filter_v2_enc_cache_001);
+  tcase_add_test (tc, pdf_stm_read_filter_v2_enc_cache_002);
+  tcase_add_test (tc, pdf_stm_write_filter_v2_dec_cache_001);
+  tcase_add_test (tc, pdf_stm_write_filter_v2_dec_cache_002);
+  tcase_add_test (tc, pdf_stm_write_filter_v2_enc_cache_001);
+  tcase_add_test (tc, pdf_stm_write_filter_v2_enc_cache_002);
+  tcase_add_test (tc, pdf_stm_read_filter_v2_dec_chain_001);
+  tcase_add_test (tc, pdf_stm_read_filter_v2_dec_adaptive_001);
+
   tcase_add_checked_fixture (tc,
                              pdf_test_setup,
                              pdf_test_teardown);
@@ -30,12 +30,24 @@
 
 extern TCase *test_pdf_stm_mem_new (void);
 extern TCase *test_pdf_stm_file_new (void);
+extern TCase *test_pdf_stm_mmap_new (void);
 extern TCase *test_pdf_stm_read_char (void);
 extern TCase *test_pdf_stm_peek_char (void);
+extern TCase *test_pdf_stm_read_view (void);
+extern TCase *test_pdf_stm_consume (void);
 extern TCase *test_pdf_stm_tell (void);
 extern TCase *test_pdf_stm_btell (void);
 extern TCase *test_pdf_stm_bseek (void);
 extern TCase *test_pdf_stm_get_mode (void);
+extern TCase *test_pdf_stm_get_copy_counters (void);
+extern TCase *test_pdf_stm_get_digest (void);
+extern TCase *test_pdf_stm_get_cache_stats (void);
+extern TCase *test_pdf_stm_get_stats (void);
+extern TCase *test_pdf_stm_decode_batch (void);
+extern TCase *test_pdf_stm_install_filter_chain (void);
+extern TCase *test_pdf_stm_reset (void);
+extern TCase *test_pdf_stm_mem_reset (void);
+extern TCase *test_pdf_stm_file_reset (void);
 extern TCase *test_pdf_stm_flush (void);
 extern TCase *test_pdf_stm_rw_filter_none (void);
 extern TCase *test_pdf_stm_rw_filter_null (void);
@@ -45,6 +57,10 @@ extern TCase *test_pdf_stm_rw_filter_a85 (void);
 extern TCase *test_pdf_stm_rw_filter_flate (void);
 extern TCase *test_pdf_stm_rw_filter_v2 (void);
 extern TCase *test_pdf_stm_rw_filter_aesv2 (void);
+extern TCase *test_pdf_stm_rw_filter_aesv3 (void);
+extern TCase *test_pdf_stm_rw_filter_lzw (void);
+extern TCase *test_pdf_stm_rw_filter_pred (void);
+extern TCase *test_pdf_stm_rw_filter_fax (void);
 
 Suite *
 tsuite_stm ()
@@ -55,12 +71,24 @@ tsuite_stm ()
 
   suite_add_tcase (s, test_pdf_stm_mem_new ());
   suite_add_tcase (s, test_pdf_stm_file_new ());
+  suite_add_tcase (s, test_pdf_stm_mmap_new ());
   suite_add_tcase (s, test_pdf_stm_read_char ());
   suite_add_tcase (s, test_pdf_stm_peek_char ());
+  suite_add_tcase (s, test_pdf_stm_read_view ());
+  suite_add_tcase (s, test_pdf_stm_consume ());
   suite_add_tcase (s, test_pdf_stm_tell ());
   suite_add_tcase (s, test_pdf_stm_btell ());
   suite_add_tcase (s, test_pdf_stm_bseek ());
   suite_add_tcase (s, test_pdf_stm_get_mode ());
+  suite_add_tcase (s, test_pdf_stm_get_copy_counters ());
+  suite_add_tcase (s, test_pdf_stm_get_digest ());
+  suite_add_tcase (s, test_pdf_stm_get_cache_stats ());
+  suite_add_tcase (s, test_pdf_stm_get_stats ());
+  suite_add_tcase (s, test_pdf_stm_decode_batch ());
+  suite_add_tcase (s, test_pdf_stm_install_filter_chain ());
+  suite_add_tcase (s, test_pdf_stm_reset ());
+  suite_add_tcase (s, test_pdf_stm_mem_reset ());
+  suite_add_tcase (s, test_pdf_stm_file_reset ());
   suite_add_tcase (s, test_pdf_stm_rw_filter_none ());
   suite_add_tcase (s, test_pdf_stm_rw_filter_null ());
   suite_add_tcase (s, test_pdf_stm_rw_filter_rl ());
@@ -69,6 +97,10 @@ tsuite_stm ()
   suite_add_tcase (s, test_pdf_stm_rw_filter_flate ());
   suite_add_tcase (s, test_pdf_stm_rw_filter_v2 ());
   suite_add_tcase (s, test_pdf_stm_rw_filter_aesv2 ());
+  suite_add_tcase (s, test_pdf_stm_rw_filter_aesv3 ());
+  suite_add_tcase (s, test_pdf_stm_rw_filter_lzw ());
+  suite_add_tcase (s, test_pdf_stm_rw_filter_pred ());
+  suite_add_tcase (s, test_pdf_stm_rw_filter_fax ());
   suite_add_tcase (s, test_pdf_stm_flush ());
 
   return s;
@@ -54,6 +54,27 @@ char *program_name;  /* Initialized in main() */
 char *jbig2dec_global_segments = NULL;
 pdf_size_t jbig2dec_global_segments_size = 0;
 
+pdf_bool_t print_stats = PDF_FALSE;
+
+/* Digest algorithms, as named in the command line and in the parameters
+ * of the digest filter */
+static const struct
+{
+  const char *name;
+  const pdf_char_t *param;
+  enum pdf_crypt_md_algo_e algorithm;
+} digest_names[] =
+  {
+    { "md5",    "MD5",    PDF_CRYPT_MD_MD5    },
+    { "sha1",   "SHA1",   PDF_CRYPT_MD_SHA1   },
+    { "sha256", "SHA256", PDF_CRYPT_MD_SHA256 }
+  };
+
+#define N_DIGEST_NAMES (sizeof (digest_names) / sizeof (digest_names[0]))
+
+/* Digests to print once the stream is processed */
+pdf_bool_t print_digest[N_DIGEST_NAMES];
+
 /*
  * Command line options management
  */
@@ -61,19 +82,31 @@ pdf_size_t jbig2dec_global_segments_size = 0;
 enum filter_arg
 {
   FILTER_INSTALL_NONE,
-  HELP_ARG,
+  /* Out of the range of the short options and of the '?' returned by
+   * getopt_long on errors */
+  HELP_ARG = 256,
   VERSION_ARG,
   READ_ARG,
   INFILE_ARG,
   OUTFILE_ARG,
   CACHE_ARG,
+  STATS_ARG,
   NULL_FILTER_ARG,
   ASCIIHEXDEC_FILTER_ARG,
   ASCIIHEXENC_FILTER_ARG,
   ASCII85DEC_FILTER_ARG,
   ASCII85ENC_FILTER_ARG,
-#if 0
   CCITTFAXDEC_FILTER_ARG,
+  CCITTFAX_K_ARG,
+  CCITTFAX_COLUMNS_ARG,
+  CCITTFAX_ROWS_ARG,
+  CCITTFAX_EOL_ARG,
+  CCITTFAX_BYTE_ALIGN_ARG,
+  CCITTFAX_NO_EOB_ARG,
+  CCITTFAX_BLACK_IS_1_ARG,
+  CCITTFAX_DAMAGED_ROWS_ARG,
+  CCITTFAXDEC_FILTER_INSTALL,
+#if 0
   JXPDEC_FILTER_ARG,
 #endif /* 0 */
   PRED_COLORS_ARG,
@@ -89,7 +122,16 @@ enum filter_arg
 #endif /* HAVE_LIBJPEG */
 #ifdef HAVE_LIBZ
   FLATEDEC_FILTER_ARG,
+  FLATE_LENGTH_ARG,
+  FLATEDEC_FILTER_INSTALL,
   FLATEENC_FILTER_ARG,
+  FLATE_LEVEL_ARG,
+  FLATE_STRATEGY_ARG,
+  FLATE_WINDOWBITS_ARG,
+  FLATE_MEMLEVEL_ARG,
+  FLATE_THREADS_ARG,
+  FLATE_BLOCKSIZE_ARG,
+  FLATEENC_FILTER_INSTALL,
 #endif /* HAVE_LIBZ */
   RUNLENGTHDEC_FILTER_ARG,
   RUNLENGTHENC_FILTER_ARG,
@@ -106,11 +148,16 @@ enum filter_arg
   LZWENC_FILTER_INSTALL,
   LZWDEC_FILTER_INSTALL,
   MD5ENC_FILTER_ARG,
+  DIGEST_FILTER_ARG,
   KEY_ARG,
   AESENC_FILTER_ARG,
   AESDEC_FILTER_ARG,
   AESENC_FILTER_INSTALL,
   AESDEC_FILTER_INSTALL,
+  AESV3ENC_FILTER_ARG,
+  AESV3DEC_FILTER_ARG,
+  AESV3ENC_FILTER_INSTALL,
+  AESV3DEC_FILTER_INSTALL,
   V2ENC_FILTER_ARG,
   V2DEC_FILTER_ARG,
   V2ENC_FILTER_INSTALL,
@@ -124,10 +171,27 @@ is_filter_arg (enum filter_arg arg)
           || arg == PRED_BITSPERCOMPONENT_ARG
           || arg == PRED_COLUMNS_ARG
           || arg == PRED_PREDICTOR_ARG
+          || arg == CCITTFAX_K_ARG
+          || arg == CCITTFAX_COLUMNS_ARG
+          || arg == CCITTFAX_ROWS_ARG
+          || arg == CCITTFAX_EOL_ARG
+          || arg == CCITTFAX_BYTE_ALIGN_ARG
+          || arg == CCITTFAX_NO_EOB_ARG
+          || arg == CCITTFAX_BLACK_IS_1_ARG
+          || arg == CCITTFAX_DAMAGED_ROWS_ARG
 #ifdef HAVE_LIBJBIG2DEC
           || arg == JBIG2DEC_GLOBAL_SEGMENTS_ARG
           || arg == JBIG2DEC_PAGE_SIZE
 #endif /* HAVE_LIBJBIG2DEC */
+#ifdef HAVE_LIBZ
+          || arg == FLATE_LENGTH_ARG
+          || arg == FLATE_LEVEL_ARG
+          || arg == FLATE_STRATEGY_ARG
+          || arg == FLATE_WINDOWBITS_ARG
+          || arg == FLATE_MEMLEVEL_ARG
+          || arg == FLATE_THREADS_ARG
+          || arg == FLATE_BLOCKSIZE_ARG
+#endif /* HAVE_LIBZ */
           || arg == LZW_EARLYCHANGE_ARG
           || arg == LZW_NO_EARLYCHANGE_ARG
           || arg == KEY_ARG);
@@ -142,6 +206,7 @@ static const struct option GNU_longOptions[] =
     {"input-file", required_argument, NULL, INFILE_ARG},
     {"output-file", required_argument, NULL, OUTFILE_ARG},
     {"cache", required_argument, NULL, CACHE_ARG},
+    {"stats", no_argument, NULL, STATS_ARG},
     {"null", no_argument, NULL, NULL_FILTER_ARG},
     {"ahexdec", no_argument, NULL, ASCIIHEXDEC_FILTER_ARG},
     {"ahexenc", no_argument, NULL, ASCIIHEXENC_FILTER_ARG},
@@ -157,8 +222,16 @@ static const struct option GNU_longOptions[] =
     {"pred-colors", required_argument, NULL, PRED_COLORS_ARG},
     {"pred-bpc", required_argument, NULL, PRED_BITSPERCOMPONENT_ARG},
     {"pred-columns", required_argument, NULL, PRED_COLUMNS_ARG},
-#if 0
     {"cfaxdec", no_argument, NULL, CCITTFAXDEC_FILTER_ARG},
+    {"cfax-k", required_argument, NULL, CCITTFAX_K_ARG},
+    {"cfax-columns", required_argument, NULL, CCITTFAX_COLUMNS_ARG},
+    {"cfax-rows", required_argument, NULL, CCITTFAX_ROWS_ARG},
+    {"cfax-eol", no_argument, NULL, CCITTFAX_EOL_ARG},
+    {"cfax-byte-align", no_argument, NULL, CCITTFAX_BYTE_ALIGN_ARG},
+    {"cfax-no-eob", no_argument, NULL, CCITTFAX_NO_EOB_ARG},
+    {"cfax-black-is-1", no_argument, NULL, CCITTFAX_BLACK_IS_1_ARG},
+    {"cfax-damaged-rows", required_argument, NULL, CCITTFAX_DAMAGED_ROWS_ARG},
+#if 0
     {"jxpdec", no_argument, NULL, JXPDEC_FILTER_ARG},
 #endif /* 0 */
 #ifdef PDF_HAVE_LIBJPEG
@@ -167,6 +240,13 @@ static const struct option GNU_longOptions[] =
 #ifdef PDF_HAVE_LIBZ
     {"flatedec", no_argument, NULL, FLATEDEC_FILTER_ARG},
     {"flateenc", no_argument, NULL, FLATEENC_FILTER_ARG},
+    {"flate-length", required_argument, NULL, FLATE_LENGTH_ARG},
+    {"flate-level", required_argument, NULL, FLATE_LEVEL_ARG},
+    {"flate-strategy", required_argument, NULL, FLATE_STRATEGY_ARG},
+    {"flate-windowbits", required_argument, NULL, FLATE_WINDOWBITS_ARG},
+    {"flate-memlevel", required_argument, NULL, FLATE_MEMLEVEL_ARG},
+    {"flate-threads", required_argument, NULL, FLATE_THREADS_ARG},
+    {"flate-blocksize", required_argument, NULL, FLATE_BLOCKSIZE_ARG},
 #endif /* PDF_HAVE_LIBZ */
     {"rldec", no_argument, NULL, RUNLENGTHDEC_FILTER_ARG},
     {"rlenc", no_argument, NULL, RUNLENGTHENC_FILTER_ARG},
@@ -175,9 +255,12 @@ static const struct option GNU_longOptions[] =
     {"jbig2dec-globals", required_argument, NULL, JBIG2DEC_GLOBAL_SEGMENTS_ARG},
 #endif /* PDF_HAVE_LIBJBIG2DEC */
     {"md5enc", no_argument, NULL, MD5ENC_FILTER_ARG},
+    {"digest", required_argument, NULL, DIGEST_FILTER_ARG},
     {"key", required_argument, NULL, KEY_ARG},
     {"aesenc", no_argument, NULL, AESENC_FILTER_ARG},
     {"aesdec", no_argument, NULL, AESDEC_FILTER_ARG},
+    {"aesv3enc", no_argument, NULL, AESV3ENC_FILTER_ARG},
+    {"aesv3dec", no_argument, NULL, AESV3DEC_FILTER_ARG},
     {"v2enc", no_argument, NULL, V2ENC_FILTER_ARG},
     {"v2dec", no_argument, NULL, V2DEC_FILTER_ARG},
     {NULL, 0, NULL, 0}
@@ -197,7 +280,9 @@ Mandatory arguments to long options are mandatory for short options too.\n\
                                        of write mode.\n\
   -i FILE, --input-file=FILE          Use a given file as the input.\n\
   -o FILE, --output-file=FILE         Use a given file as the output.\n\
-  --cache=NUM                         set the stream cache size.\n\n\
+  --cache=NUM                         set the stream cache size.\n\
+  --stats                             print the performance counters of the\n\
+                                       stream in the standard error.\n\n\
 filters\n\
   --null                              use the NULL filter\n\
   --ahexdec                           use the ASCII Hex decoder filter\n\
@@ -227,8 +312,14 @@ filters\n\
   --cfaxdec                           use the CCITT Fax decoder filter\n\
   --jbig2dec                          use the JBIG2 decoder filter\n\
   --md5enc                            use the MD5 encoder filter\n\
+  --digest=LIST                       use the digest filter, computing the\n\
+                                       comma-separated digests of LIST (md5,\n\
+                                       sha1, sha256) and printing them in\n\
+                                       the standard error\n\
   --aesenc                            use the AESv2 encoder filter\n\
   --aesdec                            use the AESv2 decoder filter\n\
+  --aesv3enc                          use the AESv3 encoder filter\n\
+  --aesv3dec                          use the AESv3 decoder filter\n\
   --v2enc                             use the V2 encoder filter\n\
   --v2dec                             use the V2 decoder filter\n\
   --help                              print a help message and exit\n\
@@ -239,9 +330,38 @@ Filter properties\n\
   --pred-colors=NUM                   next predictors colors per sample\n\
   --pred-bpc=NUM                      next predictors bits per color component\n\
   --pred-columns=NUM                  next predictors number of samples per row\n\
+  --cfax-k=NUM                        next CCITT Fax decoders coding scheme:\n\
+                                       0 for Group 3 1-D, >0 for Group 3 2-D,\n\
+                                       <0 for Group 4\n\
+  --cfax-columns=NUM                  next CCITT Fax decoders pixels per row\n\
+  --cfax-rows=NUM                     next CCITT Fax decoders number of rows\n\
+  --cfax-eol                          next CCITT Fax decoders expect end of\n\
+                                       line codes\n\
+  --cfax-byte-align                   next CCITT Fax decoders expect rows\n\
+                                       aligned on bytes\n\
+  --cfax-no-eob                       next CCITT Fax decoders don't expect an\n\
+                                       end of block code\n\
+  --cfax-black-is-1                   next CCITT Fax decoders write black\n\
+                                       pixels as 1 bits\n\
+  --cfax-damaged-rows=NUM             next CCITT Fax decoders number of damaged\n\
+                                       rows accepted\n\
   --lzw-earlychange                   enables earlychange for next lzw filters\n\
   --lzw-no-earlychange                disables earlychange for next lzw filters (default)\n\
-  --jbig2dec-globals=FILE             file containing global segments\n\
+  --jbig2dec-globals=FILE             file containing global segments\n"
+#ifdef PDF_HAVE_LIBZ
+"\
+  --flate-length=NUM                  next flate decoders size of the encoded\n\
+                                       data, decoded at once if given\n\
+  --flate-level=NUM                   next flate encoders compression level (0-9)\n\
+  --flate-strategy=NAME               next flate encoders strategy: default,\n\
+                                       filtered, huffman, rle or fixed\n\
+  --flate-windowbits=NUM              next flate encoders window size (8-15)\n\
+  --flate-memlevel=NUM                next flate encoders memory level (1-9)\n\
+  --flate-threads=NUM                 next flate encoders compress NUM blocks\n\
+                                       in parallel (0 for one per CPU)\n\
+  --flate-blocksize=NUM               next flate encoders parallel block size\n"
+#endif /* PDF_HAVE_LIBZ */
+"\
 \n"
   PDF_UTILS_HELP_FOOTER_DOC ("pdf-filter");
 
@@ -267,6 +387,12 @@ static void process_stream (pdf_stm_t  *stm,
 static pdf_fsys_file_t *open_file (pdf_char_t                *name,
                                    enum pdf_fsys_file_mode_e  mode);
 
+static void dump_stats (pdf_stm_t *stm);
+
+static pdf_bool_t digests_p (void);
+
+static void dump_digests (pdf_stm_t *stm);
+
 int
 main (int argc, char *argv[])
 {
@@ -293,8 +419,21 @@ main (int argc, char *argv[])
 
   stm = create_stream (argc, argv, &read_mode, &last_ci, &read_pdf_fsys,
                        &write_pdf_fsys, &fsys_stm);
+  if (print_stats)
+    pdf_stm_enable_stats (stm, PDF_TRUE);
   install_filters (argc, argv, stm, last_ci);
   process_stream (stm, read_mode, read_pdf_fsys, write_pdf_fsys, fsys_stm);
+
+  /* Finish the write stream now, so that the counters and the digests
+   * cover the whole output */
+  if ((print_stats || digests_p ()) && !read_mode)
+    pdf_stm_flush (stm, PDF_TRUE, NULL, NULL);
+
+  if (print_stats)
+    dump_stats (stm);
+  if (digests_p ())
+    dump_digests (stm);
+
   pdf_stm_destroy (stm);
 
   if (read_pdf_fsys || write_pdf_fsys)
@@ -324,25 +463,18 @@ static void process_stream (pdf_stm_t  *stm,
 
   if (read_mode)
     {
+      const pdf_uchar_t *data;
+      pdf_size_t data_size;
+
       /* Read from the buffer which will process anything on stdin
-         and push to stdout */
-      do
+         and push to stdout. The filtered data is taken directly from
+         the stream cache, so no intermediate copy is needed. */
+      while (pdf_stm_read_view (stm, &data, &data_size, &error))
         {
-          read_bytes = 0;
-          if (!pdf_stm_read (stm, buf, BUF_SIZE, &read_bytes, &error) &&
-              error)
-            {
-              pdf_error (pdf_error_get_status (error),
-                         stderr,
-                         "reading from stream: %s",
-                         pdf_error_get_message (error));
-              exit (EXIT_FAILURE);
-            }
-
           if (write_pdf_fsys)
             {
               written_bytes = 0;
-              if (!pdf_stm_write (fsys_stm, buf, read_bytes, &written_bytes, &error) &&
+              if (!pdf_stm_write (fsys_stm, data, data_size, &written_bytes, &error) &&
                   error)
                 {
                   pdf_error (pdf_error_get_status (error),
@@ -354,13 +486,23 @@ static void process_stream (pdf_stm_t  *stm,
             }
           else
             {
-              if (fwrite (buf, 1, read_bytes, stdout) != read_bytes)
+              if (fwrite (data, 1, data_size, stdout) != data_size)
                 {
-                  fprintf(stderr, "fwrite failed (%ld)", (long)read_bytes);
+                  fprintf(stderr, "fwrite failed (%ld)", (long)data_size);
                 }
             }
+
+          pdf_stm_consume (stm, data_size, NULL);
+        }
+
+      if (error)
+        {
+          pdf_error (pdf_error_get_status (error),
+                     stderr,
+                     "reading from stream: %s",
+                     pdf_error_get_message (error));
+          exit (EXIT_FAILURE);
         }
-      while (read_bytes == BUF_SIZE);
     }
   else
     {
@@ -416,7 +558,7 @@ create_stream (int          argc,
                pdf_stm_t  **fsys_stm)
 {
   int ci;
-  char c;
+  int c;
   pdf_status_t ret;
   pdf_size_t cache_size;
   pdf_stm_t *stm = NULL;
@@ -473,6 +615,11 @@ create_stream (int          argc,
 
             break;
           }
+        case STATS_ARG:
+          {
+            print_stats = PDF_TRUE;
+            break;
+          }
         case INFILE_ARG:
         case 'i':
           {
@@ -615,11 +762,40 @@ install_filters (int        argc,
   pdf_bool_t pred_colors_is_set = PDF_FALSE;
   pdf_bool_t pred_bpc_is_set = PDF_FALSE;
   pdf_bool_t pred_columns_set = PDF_FALSE;
+  /* parameters for CCITT Fax decoder filter */
+  int cfax_k;
+  int cfax_columns;
+  int cfax_rows;
+  int cfax_damaged_rows;
+  pdf_bool_t cfax_k_is_set = PDF_FALSE;
+  pdf_bool_t cfax_columns_is_set = PDF_FALSE;
+  pdf_bool_t cfax_rows_is_set = PDF_FALSE;
+  pdf_bool_t cfax_damaged_rows_is_set = PDF_FALSE;
+  pdf_bool_t cfax_eol = PDF_FALSE;
+  pdf_bool_t cfax_byte_align = PDF_FALSE;
+  pdf_bool_t cfax_eob = PDF_TRUE;
+  pdf_bool_t cfax_black_is_1 = PDF_FALSE;
+  /* parameters for flate decoder filter */
+  int flate_length;
+  pdf_bool_t flate_length_is_set = PDF_FALSE;
+  /* parameters for flate encoder filter */
+  int flate_level;
+  int flate_strategy;
+  int flate_windowbits;
+  int flate_memlevel;
+  int flate_threads;
+  int flate_blocksize;
+  pdf_bool_t flate_level_is_set = PDF_FALSE;
+  pdf_bool_t flate_strategy_is_set = PDF_FALSE;
+  pdf_bool_t flate_windowbits_is_set = PDF_FALSE;
+  pdf_bool_t flate_memlevel_is_set = PDF_FALSE;
+  pdf_bool_t flate_threads_is_set = PDF_FALSE;
+  pdf_bool_t flate_blocksize_is_set = PDF_FALSE;
 
   pdf_error_t *error = NULL;
-  char filter_to_install = FILTER_INSTALL_NONE;
+  int filter_to_install = FILTER_INSTALL_NONE;
   char *old_optarg = optarg;
-  char next_ci = getopt_long (argc, argv, "", GNU_longOptions, NULL);
+  int next_ci = getopt_long (argc, argv, "", GNU_longOptions, NULL);
 
   /* Install filters */
   do
@@ -732,11 +908,146 @@ install_filters (int        argc,
             break;
           }
 
-#if 0
         case CCITTFAXDEC_FILTER_ARG:
           {
+            filter_to_install = CCITTFAXDEC_FILTER_INSTALL;
+
+            /* set parameters as not set */
+            cfax_k_is_set = PDF_FALSE;
+            cfax_columns_is_set = PDF_FALSE;
+            cfax_rows_is_set = PDF_FALSE;
+            cfax_damaged_rows_is_set = PDF_FALSE;
+            cfax_eol = PDF_FALSE;
+            cfax_byte_align = PDF_FALSE;
+            cfax_eob = PDF_TRUE;
+            cfax_black_is_1 = PDF_FALSE;
+            break;
+          }
+        case CCITTFAX_K_ARG:
+          {
+            cfax_k = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0'))
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            cfax_k_is_set = PDF_TRUE;
+            break;
+          }
+        case CCITTFAX_COLUMNS_ARG:
+          {
+            cfax_columns = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0') || cfax_columns < 0)
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            cfax_columns_is_set = PDF_TRUE;
+            break;
+          }
+        case CCITTFAX_ROWS_ARG:
+          {
+            cfax_rows = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0') || cfax_rows < 0)
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            cfax_rows_is_set = PDF_TRUE;
+            break;
+          }
+        case CCITTFAX_DAMAGED_ROWS_ARG:
+          {
+            cfax_damaged_rows = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0') || cfax_damaged_rows < 0)
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            cfax_damaged_rows_is_set = PDF_TRUE;
+            break;
+          }
+        case CCITTFAX_EOL_ARG:
+          {
+            cfax_eol = PDF_TRUE;
+            break;
+          }
+        case CCITTFAX_BYTE_ALIGN_ARG:
+          {
+            cfax_byte_align = PDF_TRUE;
             break;
           }
+        case CCITTFAX_NO_EOB_ARG:
+          {
+            cfax_eob = PDF_FALSE;
+            break;
+          }
+        case CCITTFAX_BLACK_IS_1_ARG:
+          {
+            cfax_black_is_1 = PDF_TRUE;
+            break;
+          }
+        case CCITTFAXDEC_FILTER_INSTALL:
+          {
+            filter_params = pdf_hash_new (&error);
+            if (!filter_params)
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "couldn't create hash table: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            if ((cfax_k_is_set
+                 && !pdf_hash_add_i32 (filter_params, "K", cfax_k, &error))
+                || (cfax_columns_is_set
+                    && !pdf_hash_add_size (filter_params, "Columns",
+                                           cfax_columns, &error))
+                || (cfax_rows_is_set
+                    && !pdf_hash_add_size (filter_params, "Rows",
+                                           cfax_rows, &error))
+                || (cfax_damaged_rows_is_set
+                    && !pdf_hash_add_size (filter_params,
+                                           "DamagedRowsBeforeError",
+                                           cfax_damaged_rows, &error))
+                || !pdf_hash_add_bool (filter_params, "EndOfLine",
+                                       cfax_eol, &error)
+                || !pdf_hash_add_bool (filter_params, "EncodedByteAlign",
+                                       cfax_byte_align, &error)
+                || !pdf_hash_add_bool (filter_params, "EndOfBlock",
+                                       cfax_eob, &error)
+                || !pdf_hash_add_bool (filter_params, "BlackIs1",
+                                       cfax_black_is_1, &error))
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "while creating the CCITT Fax decoder filter: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            if (!pdf_stm_install_filter (stm,
+                                         PDF_STM_FILTER_CCITTFAX_DEC,
+                                         filter_params,
+                                         &error))
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "while installing the CCITT Fax decoder filter: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            pdf_hash_destroy (filter_params);
+
+            break;
+          }
+#if 0
         case JXPDEC_FILTER_ARG:
           {
             break;
@@ -964,9 +1275,52 @@ install_filters (int        argc,
 #ifdef PDF_HAVE_LIBZ
         case FLATEDEC_FILTER_ARG:
           {
+            filter_to_install = FLATEDEC_FILTER_INSTALL;
+
+            /* set parameters as not set */
+            flate_length_is_set = PDF_FALSE;
+            break;
+          }
+        case FLATE_LENGTH_ARG:
+          {
+            flate_length = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0') || flate_length < 0)
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_length_is_set = PDF_TRUE;
+            break;
+          }
+        case FLATEDEC_FILTER_INSTALL:
+          {
+            filter_params = pdf_hash_new (&error);
+            if (!filter_params)
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "couldn't create hash table: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            if (flate_length_is_set &&
+                !pdf_hash_add_size (filter_params,
+                                    "Length",
+                                    flate_length,
+                                    &error))
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "while creating the FLATE decoder filter: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
             if (!pdf_stm_install_filter (stm,
                                          PDF_STM_FILTER_FLATE_DEC,
-                                         NULL,
+                                         filter_params,
                                          &error))
               {
                 pdf_error (pdf_error_get_status (error),
@@ -976,14 +1330,158 @@ install_filters (int        argc,
                 exit (EXIT_FAILURE);
               }
 
+            pdf_hash_destroy (filter_params);
+
             break;
           }
 
+        case FLATE_LEVEL_ARG:
+          {
+            flate_level = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0'))
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_level_is_set = PDF_TRUE;
+            break;
+          }
+        case FLATE_STRATEGY_ARG:
+          {
+            /* Values of the zlib strategies */
+            if (strcmp (old_optarg, "default") == 0)
+              flate_strategy = 0;
+            else if (strcmp (old_optarg, "filtered") == 0)
+              flate_strategy = 1;
+            else if (strcmp (old_optarg, "huffman") == 0)
+              flate_strategy = 2;
+            else if (strcmp (old_optarg, "rle") == 0)
+              flate_strategy = 3;
+            else if (strcmp (old_optarg, "fixed") == 0)
+              flate_strategy = 4;
+            else
+              {
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_strategy_is_set = PDF_TRUE;
+            break;
+          }
+        case FLATE_WINDOWBITS_ARG:
+          {
+            flate_windowbits = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0'))
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_windowbits_is_set = PDF_TRUE;
+            break;
+          }
+        case FLATE_MEMLEVEL_ARG:
+          {
+            flate_memlevel = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0'))
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_memlevel_is_set = PDF_TRUE;
+            break;
+          }
+        case FLATE_THREADS_ARG:
+          {
+            flate_threads = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0') || flate_threads < 0)
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_threads_is_set = PDF_TRUE;
+            break;
+          }
+        case FLATE_BLOCKSIZE_ARG:
+          {
+            flate_blocksize = strtol (old_optarg, (char **) &endptr, 10);
+            if ((*endptr != '\0') || flate_blocksize < 0)
+              {
+                /* Error parsing the number */
+                fprintf (stdout, "%s\n", pdf_filter_help_msg);
+                exit (EXIT_FAILURE);
+              }
+            flate_blocksize_is_set = PDF_TRUE;
+            break;
+          }
         case FLATEENC_FILTER_ARG:
           {
+            filter_to_install = FLATEENC_FILTER_INSTALL;
+
+            /* set parameters as not set */
+            flate_level_is_set = PDF_FALSE;
+            flate_strategy_is_set = PDF_FALSE;
+            flate_windowbits_is_set = PDF_FALSE;
+            flate_memlevel_is_set = PDF_FALSE;
+            flate_threads_is_set = PDF_FALSE;
+            flate_blocksize_is_set = PDF_FALSE;
+            break;
+          }
+        case FLATEENC_FILTER_INSTALL:
+          {
+            filter_params = pdf_hash_new (&error);
+            if (!filter_params)
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "couldn't create hash table: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            if ((flate_level_is_set &&
+                 !pdf_hash_add_size (filter_params,
+                                     "Level",
+                                     flate_level,
+                                     &error)) ||
+                (flate_strategy_is_set &&
+                 !pdf_hash_add_size (filter_params,
+                                     "Strategy",
+                                     flate_strategy,
+                                     &error)) ||
+                (flate_windowbits_is_set &&
+                 !pdf_hash_add_size (filter_params,
+                                     "WindowBits",
+                                     flate_windowbits,
+                                     &error)) ||
+                (flate_memlevel_is_set &&
+                 !pdf_hash_add_size (filter_params,
+                                     "MemLevel",
+                                     flate_memlevel,
+                                     &error)) ||
+                (flate_threads_is_set &&
+                 !pdf_hash_add_size (filter_params,
+                                     "Threads",
+                                     flate_threads,
+                                     &error)) ||
+                (flate_blocksize_is_set &&
+                 !pdf_hash_add_size (filter_params,
+                                     "BlockSize",
+                                     flate_blocksize,
+                                     &error)))
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "while creating the FLATE encoder filter: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
             if (!pdf_stm_install_filter (stm,
                                          PDF_STM_FILTER_FLATE_ENC,
-                                         NULL,
+                                         filter_params,
                                          &error))
               {
                 pdf_error (pdf_error_get_status (error),
@@ -993,6 +1491,8 @@ install_filters (int        argc,
                 exit (EXIT_FAILURE);
               }
 
+            pdf_hash_destroy (filter_params);
+
             break;
           }
 #endif /* PDF_HAVE_LIBZ */
@@ -1146,6 +1646,77 @@ install_filters (int        argc,
             break;
           }
 
+        case DIGEST_FILTER_ARG:
+          {
+            const char *name = old_optarg;
+
+            filter_params = pdf_hash_new (&error);
+            if (!filter_params)
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "couldn't create hash table: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            while (*name != '\0')
+              {
+                size_t length = strcspn (name, ",");
+                size_t i;
+
+                for (i = 0; i < N_DIGEST_NAMES; i++)
+                  {
+                    if (strlen (digest_names[i].name) == length &&
+                        strncmp (name, digest_names[i].name, length) == 0)
+                      break;
+                  }
+
+                if (i == N_DIGEST_NAMES)
+                  {
+                    fprintf (stderr,
+                             "error: unknown digest algorithm in '%s'\n",
+                             old_optarg);
+                    exit (EXIT_FAILURE);
+                  }
+
+                if (!pdf_hash_key_p (filter_params, digest_names[i].param) &&
+                    !pdf_hash_add_bool (filter_params,
+                                        digest_names[i].param,
+                                        PDF_TRUE,
+                                        &error))
+                  {
+                    pdf_error (pdf_error_get_status (error),
+                               stderr,
+                               "while creating the digest filter: '%s'",
+                               pdf_error_get_message (error));
+                    exit (EXIT_FAILURE);
+                  }
+                print_digest[i] = PDF_TRUE;
+
+                name += length;
+                if (*name == ',')
+                  name++;
+              }
+
+            if (!pdf_stm_install_filter (stm,
+                                         PDF_STM_FILTER_DIGEST,
+                                         filter_params,
+                                         &error))
+              {
+                pdf_error (pdf_error_get_status (error),
+                           stderr,
+                           "while installing the digest filter: '%s'",
+                           pdf_error_get_message (error));
+                exit (EXIT_FAILURE);
+              }
+
+            pdf_hash_destroy (filter_params);
+            filter_params = NULL;
+
+            break;
+          }
+
         case KEY_ARG:
           {
             if (key != NULL)
@@ -1168,12 +1739,24 @@ install_filters (int        argc,
             filter_to_install = AESDEC_FILTER_INSTALL;
             break;
           }
-        case AESENC_FILTER_INSTALL: /* Note that both ENC and DEC go here */
-        case AESDEC_FILTER_INSTALL:
+        case AESV3ENC_FILTER_ARG:
+          {
+            filter_to_install = AESV3ENC_FILTER_INSTALL;
+            break;
+          }
+        case AESV3DEC_FILTER_ARG:
+          {
+            filter_to_install = AESV3DEC_FILTER_INSTALL;
+            break;
+          }
+        case AESENC_FILTER_INSTALL: /* Note that AESv2 and AESv3, both ENC */
+        case AESDEC_FILTER_INSTALL: /* and DEC, go here */
+        case AESV3ENC_FILTER_INSTALL:
+        case AESV3DEC_FILTER_INSTALL:
           {
             if (key == NULL)
               {
-                fprintf (stderr, "You should specify a key for the AESv2 filter.\n");
+                fprintf (stderr, "You should specify a key for the AES filter.\n");
                 exit (EXIT_FAILURE);
               }
 
@@ -1214,13 +1797,17 @@ install_filters (int        argc,
             if (!pdf_stm_install_filter (stm,
                                          (ci == AESENC_FILTER_INSTALL ?
                                           PDF_STM_FILTER_AESV2_ENC :
-                                          PDF_STM_FILTER_AESV2_DEC),
+                                          ci == AESDEC_FILTER_INSTALL ?
+                                          PDF_STM_FILTER_AESV2_DEC :
+                                          ci == AESV3ENC_FILTER_INSTALL ?
+                                          PDF_STM_FILTER_AESV3_ENC :
+                                          PDF_STM_FILTER_AESV3_DEC),
                                          filter_params,
                                          &error))
               {
                 pdf_error (pdf_error_get_status (error),
                            stderr,
-                           "while installing the AESv2 encoder filter: '%s'",
+                           "while installing the AES filter: '%s'",
                            pdf_error_get_message (error));
                 exit (EXIT_FAILURE);
               }
@@ -1380,4 +1967,105 @@ open_file (pdf_char_t                *name,
   return file;
 }
 
+static void
+dump_stats (pdf_stm_t *stm)
+{
+  struct pdf_stm_stats_s stats;
+  struct pdf_stm_filter_stats_s *filter_stats;
+  pdf_error_t *error = NULL;
+  pdf_size_t i;
+
+  /* Ask once for the number of filters */
+  if (!pdf_stm_get_stats (stm, &stats, NULL, 0, &error))
+    {
+      pdf_error (pdf_error_get_status (error),
+                 stderr,
+                 "while getting the stream statistics: %s",
+                 pdf_error_get_message (error));
+      exit (EXIT_FAILURE);
+    }
+
+  filter_stats = pdf_alloc (stats.n_filters * sizeof (filter_stats[0]));
+  if (!filter_stats)
+    {
+      fprintf (stderr, "error: not enough memory to dump the statistics\n");
+      exit (EXIT_FAILURE);
+    }
+  pdf_stm_get_stats (stm, &stats, filter_stats, stats.n_filters, NULL);
+
+  fprintf (stderr,
+           "backend: %lu reads (%lu bytes), %lu writes (%lu bytes), "
+           "%lu usecs\n",
+           (unsigned long) stats.n_be_reads,
+           (unsigned long) stats.be_read_bytes,
+           (unsigned long) stats.n_be_writes,
+           (unsigned long) stats.be_written_bytes,
+           (unsigned long) stats.be_usecs);
+
+  for (i = 0; i < stats.n_filters; i++)
+    {
+      fprintf (stderr,
+               "%s: %lu applies, %lu bytes in, %lu bytes out, "
+               "%lu input stalls, %lu output stalls, %lu usecs\n",
+               filter_stats[i].name,
+               (unsigned long) filter_stats[i].n_applies,
+               (unsigned long) filter_stats[i].bytes_in,
+               (unsigned long) filter_stats[i].bytes_out,
+               (unsigned long) filter_stats[i].n_no_input,
+               (unsigned long) filter_stats[i].n_no_output,
+               (unsigned long) filter_stats[i].apply_usecs);
+    }
+
+  pdf_dealloc (filter_stats);
+}
+
+static pdf_bool_t
+digests_p (void)
+{
+  size_t i;
+
+  for (i = 0; i < N_DIGEST_NAMES; i++)
+    {
+      if (print_digest[i])
+        return PDF_TRUE;
+    }
+  return PDF_FALSE;
+}
+
+static void
+dump_digests (pdf_stm_t *stm)
+{
+  pdf_char_t digest[PDF_CRYPT_MD_MAX_SIZE];
+  pdf_size_t digest_size;
+  pdf_error_t *error = NULL;
+  size_t i;
+  size_t j;
+
+  for (i = 0; i < N_DIGEST_NAMES; i++)
+    {
+      if (!print_digest[i])
+        continue;
+
+      if (!pdf_stm_get_digest (stm,
+                               digest_names[i].algorithm,
+                               digest,
+                               sizeof (digest),
+                               &digest_size,
+                               &error))
+        {
+          pdf_error (pdf_error_get_status (error),
+                     stderr,
+                     "while getting the %s digest: %s",
+                     digest_names[i].name,
+                     pdf_error_get_message (error));
+          exit (EXIT_FAILURE);
+        }
+
+      fprintf (stderr, "%s: ", digest_names[i].name);
+      for (j = 0; j < digest_size; j++)
+        fprintf (stderr, "%02x", (unsigned char) digest[j]);
+      fprintf (stderr, "\n");
+    }
+}
+
 /* End of pdf_filter.c */